@@ -13,26 +13,230 @@
 
 #include "MySqlExtBind.h"
 
+#include <numeric>
+#include <utility>
+#include <vector>
+
 std::string FaF::MySqlExtBind::m_leftDelimiter       { ":" };
 std::string FaF::MySqlExtBind::m_rightDelimiter      {};
 
+std::atomic<size_t> FaF::MySqlExtBind::m_globalSqlText    {};
+std::atomic<size_t> FaF::MySqlExtBind::m_globalNameTable  {};
+std::atomic<size_t> FaF::MySqlExtBind::m_globalBindArrays {};
+
+namespace
+{
+
+    // The parser's temporary containers use this stack buffer first, so usual commands don't need the heap.
+    constexpr size_t g_parseBufferSize { 2048 };
+
+    auto alignOffset( size_t offset, size_t alignment ) -> size_t
+    {
+
+        return ( offset + alignment - 1 ) / alignment * alignment;
+
+    }
+
+}
+
 namespace FaF
 {
 
     /**
      * Parse the SQL command and assure the delimiters can be processed by regex.
+     * The arena is allocated from <memoryResource>.
      *
      * @param mysqlStatementStruct
      * @param mysqlCommand
+     * @param memoryResource
+     */
+    MySqlExtBind::MySqlExtBind( MYSQL_STMT * mysqlStatementStruct, std::string_view mysqlCommand, std::pmr::memory_resource * memoryResource )
+    :
+        m_mysqlStatementStruct( mysqlStatementStruct ),
+        m_memoryResource      ( memoryResource       )
+    {
+
+        parseMysqlCommand( mysqlCommand );
+
+        accountMemoryUsage( memoryUsage(), true );
+
+    }
+
+    /**
+     * The copy gets its own arena from the same memory resource, including the already assigned bind data.
+     *
+     * @param otherExtBind
      */
-    MySqlExtBind::MySqlExtBind( MYSQL_STMT * mysqlStatementStruct, const std::string mysqlCommand )
+    MySqlExtBind::MySqlExtBind( const MySqlExtBind & otherExtBind )
+    :
+        m_mysqlStatementStruct( otherExtBind.m_mysqlStatementStruct ),
+        m_memoryResource      ( otherExtBind.m_memoryResource       )
+    {
+
+        if ( nullptr != otherExtBind.m_arena ) {
+
+            const size_t otherArenaSize = arenaSize( otherExtBind.header() );
+
+            m_arena = static_cast<char *>( m_memoryResource->allocate( otherArenaSize, alignof( std::max_align_t ) ) );
+            std::memcpy( m_arena, otherExtBind.m_arena, otherArenaSize );
+
+            accountMemoryUsage( memoryUsage(), true );
+
+        }
+
+    }
+
+    MySqlExtBind::MySqlExtBind( MYSQL_STMT * mysqlStatementStruct, std::pmr::memory_resource * memoryResource )
     :
         m_mysqlStatementStruct( mysqlStatementStruct ),
-        m_mysqlCommand        ( mysqlCommand         ),
-        m_adjustedMysqlCommand( mysqlCommand         )
+        m_memoryResource      ( memoryResource       )
+    {
+    }
+
+    MySqlExtBind::MySqlExtBind( MySqlExtBind && otherExtBind ) noexcept
+    :
+        m_mysqlStatementStruct( otherExtBind.m_mysqlStatementStruct ),
+        m_memoryResource      ( otherExtBind.m_memoryResource       ),
+        m_arena               ( std::exchange( otherExtBind.m_arena, nullptr ) )
+    {
+    }
+
+    MySqlExtBind & MySqlExtBind::operator=( MySqlExtBind otherExtBind ) noexcept
+    {
+
+        std::swap( m_mysqlStatementStruct, otherExtBind.m_mysqlStatementStruct );
+        std::swap( m_memoryResource,       otherExtBind.m_memoryResource       );
+        std::swap( m_arena,                otherExtBind.m_arena                );
+
+        return *this;
+
+    }
+
+    MySqlExtBind::~MySqlExtBind()
+    {
+
+        if ( nullptr != m_arena ) {
+
+            accountMemoryUsage( memoryUsage(), false );
+            m_memoryResource->deallocate( m_arena, arenaSize( header() ), alignof( std::max_align_t ) );
+
+        }
+
+    }
+
+    /**
+     * The parsed template part of the arena - see ArenaHeader. It contains no pointers, so it can be stored
+     * and turned into an instance again with fromTemplateImage(), without parsing the MySQL command.
+     * It's only valid for the same delimiters and the same templateImageVersion.
+     *
+     * @return
+     */
+    auto MySqlExtBind::templateImage() const -> std::string_view
     {
 
-        parseMysqlCommand();
+        return { m_arena, header().templateSize };
+
+    }
+
+    /**
+     * Creates an instance from a template image returned by templateImage() - the bind data is not assigned.
+     * Throws exception #14 if the image is damaged.
+     *
+     * @param mysqlStatementStruct
+     * @param templateImage
+     * @param memoryResource
+     * @return
+     */
+    auto MySqlExtBind::fromTemplateImage( MYSQL_STMT * mysqlStatementStruct, std::string_view templateImage,
+                                          std::pmr::memory_resource * memoryResource ) -> MySqlExtBind
+    {
+
+        ArenaHeader arenaHeader {};
+        if ( sizeof( arenaHeader ) <= templateImage.length() ) {
+
+            std::memcpy( &arenaHeader, templateImage.data(), sizeof( arenaHeader ) );
+
+        }
+
+        const size_t nameEntriesOffset = alignOffset( sizeof( ArenaHeader ), alignof( NameEntry ) );
+
+        bool damaged = templateImage.length() != arenaHeader.templateSize ||
+                       arenaHeader.namesCount > arenaHeader.bindVariablesCount ||
+                       nameEntriesOffset != arenaHeader.nameEntriesOffset ||
+                       nameEntriesOffset + size_t { arenaHeader.namesCount } * sizeof( NameEntry ) != arenaHeader.positionsOffset ||
+                       arenaHeader.positionsOffset + size_t { arenaHeader.bindVariablesCount } * sizeof( u_int ) != arenaHeader.adjustedMysqlCommandOffset ||
+                       size_t { arenaHeader.adjustedMysqlCommandOffset } + arenaHeader.adjustedMysqlCommandLength + 1 > arenaHeader.templateSize;
+
+        MySqlExtBind fafExtBind( mysqlStatementStruct, memoryResource );
+
+        if ( false == damaged ) {
+
+            const size_t totalSize = arenaSize( arenaHeader );
+
+            fafExtBind.m_arena = static_cast<char *>( memoryResource->allocate( totalSize, alignof( std::max_align_t ) ) );
+            std::memset( fafExtBind.m_arena, 0, totalSize );
+            std::memcpy( fafExtBind.m_arena, templateImage.data(), templateImage.length() );
+
+            // The names and positions are used without further checks - they must stay inside the template.
+            for ( u_int index = 0; index < arenaHeader.namesCount && false == damaged; index++ ) {
+
+                const NameEntry & nameEntry = fafExtBind.nameEntries() [index];
+
+                damaged = size_t { nameEntry.nameOffset } + nameEntry.nameLength > arenaHeader.templateSize ||
+                          size_t { nameEntry.firstPosition } + nameEntry.positionsCount > arenaHeader.bindVariablesCount;
+
+            }
+
+            for ( u_int index = 0; index < arenaHeader.bindVariablesCount && false == damaged; index++ ) {
+
+                damaged = fafExtBind.positions() [index] >= arenaHeader.bindVariablesCount;
+
+            }
+
+            if ( damaged ) {
+
+                memoryResource->deallocate( std::exchange( fafExtBind.m_arena, nullptr ), totalSize, alignof( std::max_align_t ) );
+
+            }
+
+        }
+
+        if ( damaged ) {
+
+            std::cerr << "Exception #14: The template image is damaged or has been created by another version." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        accountMemoryUsage( fafExtBind.memoryUsage(), true );
+
+        return fafExtBind;
+
+    }
+
+    /**
+     * Creates an instance from an already adjusted MySQL command, without parsing it - for callers which lex the
+     * command themselves, like MySqlExtBindShapes. <positionNames> has the name for each <?> in the adjusted command,
+     * in their order. Unlike the parsing constructor, no bind variable at all is fine.
+     *
+     * @param mysqlStatementStruct
+     * @param adjustedMysqlCommand
+     * @param positionNames
+     * @param memoryResource
+     * @return
+     */
+    auto MySqlExtBind::fromAdjustedCommand( MYSQL_STMT * mysqlStatementStruct, std::string_view adjustedMysqlCommand,
+                                            const std::vector<std::string_view> & positionNames,
+                                            std::pmr::memory_resource * memoryResource ) -> MySqlExtBind
+    {
+
+        MySqlExtBind fafExtBind( mysqlStatementStruct, memoryResource );
+
+        fafExtBind.buildArena( adjustedMysqlCommand, positionNames.data(), static_cast<u_int>( positionNames.size() ) );
+
+        accountMemoryUsage( fafExtBind.memoryUsage(), true );
+
+        return fafExtBind;
 
     }
 
@@ -56,53 +260,102 @@ namespace FaF
     }
 
     /**
-     * Looks for bind variables according to the current delimiters and prepares the internal array,
-     * so later each bind variable can set easily.
+     * True if the MySQL command has a bind variable with the current delimiters - the parsing constructor throws
+     * exception #1 otherwise. Commands without one can be taken as they are with fromAdjustedCommand().
      *
-     * @param runRegexTest
+     * @param mysqlCommand
      * @return
      */
-    auto MySqlExtBind::parseMysqlCommand() -> void
+    auto MySqlExtBind::hasBindVariables( std::string_view mysqlCommand ) -> bool
     {
 
-        // Needed only for the regex test.
-        bool anyMatchFound {};
+        // Compiled again only after the delimiters have changed - the check is cheap compared to the parsing.
+        thread_local std::string compiledPattern;
+        thread_local std::regex  regexPattern;
+
+        try {
+
+            if ( std::string resolvedPattern = bindVariablePattern(); compiledPattern != resolvedPattern ) {
+
+                regexPattern    = std::regex( resolvedPattern );
+                compiledPattern = std::move( resolvedPattern );
+
+            }
+
+            return std::regex_search( mysqlCommand.begin(), mysqlCommand.end(), regexPattern );
 
-        const std::string resolvedPattern {
-            MySqlExtBind::m_leftDelimiter +
-            R"~((\w+))~" +
-            MySqlExtBind::m_rightDelimiter
-                                          };
+        } catch ( std::regex_error const & ) {
+
+            // A fatal regex error - the delimiters are nonsense.
+            std::cerr << "Exception #2. Regex failed. Check the delimiters and if characters have been correctly escaped." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+    }
+
+    /**
+     * The regex of a bind variable with the current delimiters - the name is the first group.
+     *
+     * @return
+     */
+    auto MySqlExtBind::bindVariablePattern() -> std::string
+    {
+
+        return MySqlExtBind::m_leftDelimiter + R"~((\w+))~" + MySqlExtBind::m_rightDelimiter;
+
+    }
+
+    /**
+     * Looks for bind variables according to the current delimiters and builds the adjusted MySQL command in one pass.
+     * Finally, the arena is created, so later each bind variable can set easily.
+     *
+     * @param mysqlCommand
+     * @return
+     */
+    auto MySqlExtBind::parseMysqlCommand( std::string_view mysqlCommand ) -> void
+    {
+
+        const std::string resolvedPattern = bindVariablePattern();
+
+        char                                parseBuffer [g_parseBufferSize];
+        std::pmr::monotonic_buffer_resource parseResource( parseBuffer, sizeof( parseBuffer ), m_memoryResource );
+
+        std::pmr::string                      adjustedMysqlCommand( &parseResource );
+        std::pmr::vector<std::string_view>    positionNames       ( &parseResource );
+
+        adjustedMysqlCommand.reserve( mysqlCommand.length() );
 
         try {
 
             const std::regex regexPattern( resolvedPattern );
 
-            std::sregex_iterator currentRegexMatch( m_mysqlCommand.begin(), m_mysqlCommand.end(), regexPattern );
-            std::sregex_iterator endMarker;
+            std::cregex_iterator currentRegexMatch( mysqlCommand.data(), mysqlCommand.data() + mysqlCommand.length(), regexPattern );
+            std::cregex_iterator endMarker;
 
-            // The position is needed in order to construct the MYSQL_BIND array in the correct order.
-            m_bindVariablesCount = 0;
+            // The end of the previous match - the text in between is copied unchanged.
+            size_t copiedPosition {};
 
             while( currentRegexMatch != endMarker ) {
 
-                const std::string fullMatch { (*currentRegexMatch) [0] };
-                const std::string onlyMatch { (*currentRegexMatch) [1] };
+                const size_t matchPosition = static_cast<size_t>( currentRegexMatch->position( 0 ) );
 
-                // Add the found bind variable to the container. The MYSQL_BIND item is empty - it will be set in assignBindData().
-                m_bindNamesContainer.insert( MapContainer::value_type( onlyMatch, { m_bindVariablesCount++ } ) );
+                // The position in <positionNames> is needed in order to construct the MYSQL_BIND array in the correct order.
+                positionNames.push_back( mysqlCommand.substr( static_cast<size_t>( currentRegexMatch->position( 1 ) ),
+                                                              static_cast<size_t>( currentRegexMatch->length  ( 1 ) ) ) );
 
                 // Replace the bind placeholder by <?>.
-                m_adjustedMysqlCommand.replace( m_adjustedMysqlCommand.find(fullMatch), fullMatch.length(), "?" );
-
-                // Any match has been found, set the flag for the regex test.
-                anyMatchFound = true;
+                adjustedMysqlCommand.append( mysqlCommand.substr( copiedPosition, matchPosition - copiedPosition ) );
+                adjustedMysqlCommand.push_back( '?' );
+                copiedPosition = matchPosition + static_cast<size_t>( currentRegexMatch->length( 0 ) );
 
                 currentRegexMatch++;
 
             }
 
-            if ( false == anyMatchFound ) {
+            adjustedMysqlCommand.append( mysqlCommand.substr( std::min( copiedPosition, mysqlCommand.length() ) ) );
+
+            if ( positionNames.empty() ) {
 
                 // The pattern seems not to work. The test pattern hasn't been found. Throw an exception.
                 std::cerr
@@ -123,6 +376,106 @@ namespace FaF
 
         }
 
+        buildArena( adjustedMysqlCommand, positionNames.data(), static_cast<u_int>( positionNames.size() ) );
+
+    }
+
+    /**
+     * Allocates the arena with the exact size and fills the template part. The bind data part is zeroed.
+     * <positionNames> contains the name for each <?> in <adjustedMysqlCommand>. A name can be used several times.
+     *
+     * @param adjustedMysqlCommand
+     * @param positionNames
+     * @param bindVariablesCount
+     */
+    auto MySqlExtBind::buildArena( std::string_view adjustedMysqlCommand, const std::string_view * positionNames, u_int bindVariablesCount ) -> void
+    {
+
+        char                                sortBuffer [g_parseBufferSize];
+        std::pmr::monotonic_buffer_resource sortResource( sortBuffer, sizeof( sortBuffer ), m_memoryResource );
+
+        // The positions sorted by the name - equal names keep the order of their positions.
+        std::pmr::vector<u_int> sortedPositions( bindVariablesCount, &sortResource );
+        std::iota( sortedPositions.begin(), sortedPositions.end(), 0 );
+        std::stable_sort( sortedPositions.begin(), sortedPositions.end(), [positionNames]( u_int left, u_int right )
+        {
+
+            return positionNames [left] < positionNames [right];
+
+        } );
+
+        u_int  namesCount  {};
+        size_t namesLength {};
+        for ( u_int index = 0; index < bindVariablesCount; index++ ) {
+
+            if ( 0 == index || positionNames [sortedPositions [index]] != positionNames [sortedPositions [index - 1]] ) {
+
+                namesCount++;
+                namesLength += positionNames [sortedPositions [index]].length();
+
+            }
+
+        }
+
+        ArenaHeader arenaHeader {};
+        arenaHeader.bindVariablesCount         = bindVariablesCount;
+        arenaHeader.namesCount                 = namesCount;
+        arenaHeader.nameEntriesOffset          = static_cast<u_int>( alignOffset( sizeof( ArenaHeader ), alignof( NameEntry ) ) );
+        arenaHeader.positionsOffset            = static_cast<u_int>( arenaHeader.nameEntriesOffset + namesCount * sizeof( NameEntry ) );
+        arenaHeader.adjustedMysqlCommandOffset = static_cast<u_int>( arenaHeader.positionsOffset + bindVariablesCount * sizeof( u_int ) );
+        arenaHeader.adjustedMysqlCommandLength = static_cast<u_int>( adjustedMysqlCommand.length() );
+        arenaHeader.templateSize               = static_cast<u_int>( arenaHeader.adjustedMysqlCommandOffset + adjustedMysqlCommand.length() + 1 + namesLength );
+
+        const size_t totalSize = arenaSize( arenaHeader );
+
+        m_arena = static_cast<char *>( m_memoryResource->allocate( totalSize, alignof( std::max_align_t ) ) );
+        std::memset( m_arena, 0, totalSize );
+        std::memcpy( m_arena, &arenaHeader, sizeof( arenaHeader ) );
+
+        NameEntry * nameEntry          = reinterpret_cast<NameEntry *>( m_arena + arenaHeader.nameEntriesOffset ) - 1;
+        u_int *     positionsItem      = reinterpret_cast<u_int *>( m_arena + arenaHeader.positionsOffset );
+        char *      textItem           = m_arena + arenaHeader.adjustedMysqlCommandOffset;
+
+        std::memcpy( textItem, adjustedMysqlCommand.data(), adjustedMysqlCommand.length() );
+        textItem += adjustedMysqlCommand.length() + 1;
+
+        for ( u_int index = 0; index < bindVariablesCount; index++ ) {
+
+            const std::string_view positionName = positionNames [sortedPositions [index]];
+
+            if ( 0 == index || positionName != positionNames [sortedPositions [index - 1]] ) {
+
+                nameEntry++;
+                nameEntry->nameOffset    = static_cast<u_int>( textItem - m_arena );
+                nameEntry->nameLength    = static_cast<u_int>( positionName.length() );
+                nameEntry->firstPosition = index;
+
+                std::memcpy( textItem, positionName.data(), positionName.length() );
+                textItem += positionName.length();
+
+            }
+
+            nameEntry->positionsCount++;
+            positionsItem [index] = sortedPositions [index];
+
+        }
+
+    }
+
+    auto MySqlExtBind::bindArrayOffset( const ArenaHeader & arenaHeader ) -> size_t
+    {
+
+        return alignOffset( arenaHeader.templateSize, alignof( MYSQL_BIND ) );
+
+    }
+
+    auto MySqlExtBind::arenaSize( const ArenaHeader & arenaHeader ) -> size_t
+    {
+
+        return bindArrayOffset( arenaHeader ) +
+               arenaHeader.bindVariablesCount * ( sizeof( MYSQL_BIND ) + sizeof( const char * ) ) +
+               arenaHeader.namesCount * sizeof( bool );
+
     }
 
     /**
@@ -132,7 +485,7 @@ namespace FaF
      * @param bindName
      * @param originalMysqlBindItem
      */
-    auto MySqlExtBind::assignBindData( const std::string bindVariable, const MYSQL_BIND & originalMysqlBindItem ) -> void
+    auto MySqlExtBind::assignBindData( std::string_view bindVariable, const MYSQL_BIND & originalMysqlBindItem ) -> void
     {
 
         // Copy the structure item and throw an exception if <bindVariable> is not found.
@@ -153,12 +506,11 @@ namespace FaF
      * @return
      */
     auto MySqlExtBind::assignBindData(
-            const std::string bindVariable,
-            // m_finalMysqlBindArray is only a placeholder so we can access the MYSQL_BIND's members.
-            decltype( m_finalMysqlBindArray->buffer_type ) buffer_type,
-            decltype( m_finalMysqlBindArray->buffer      ) buffer,
-            decltype( m_finalMysqlBindArray->length      ) length,
-            decltype( m_finalMysqlBindArray->is_null     ) is_null
+            std::string_view bindVariable,
+            decltype( MYSQL_BIND::buffer_type ) buffer_type,
+            decltype( MYSQL_BIND::buffer      ) buffer,
+            decltype( MYSQL_BIND::length      ) length,
+            decltype( MYSQL_BIND::is_null     ) is_null
     ) -> void
     {
 
@@ -175,36 +527,77 @@ namespace FaF
     }
 
     /**
-     * Copies the provided entry into the already existing and internal MYSQL_BIND structure because we know now the position
-     * in the SQL command bin list.
+     * Copies the provided entry into the MYSQL_BIND array at each position where the bind variable is used
+     * in the SQL command.
      *
      * @param bindVariable
      * @param sourceBindStructure
      * @return
      */
-    auto MySqlExtBind::copyBindStructure( const std::string bindVariable, const MYSQL_BIND & sourceBindStructure ) -> void
+    auto MySqlExtBind::copyBindStructure( std::string_view bindVariable, const MYSQL_BIND & sourceBindStructure ) -> void
     {
 
-        try {
+        const NameEntry * foundEntry = findNameEntry( bindVariable );
 
-            auto & currenContainerItem = m_bindNamesContainer.at(bindVariable);
+        // Mark the item that the value has been set.
+        assignedFlags() [foundEntry - nameEntries()] = true;
 
-            // Mark the item that the value has been set.
-            currenContainerItem.assignBindData = true;
-            // Copy the MYSQL_BIND data.
-            currenContainerItem.mysqlBindItem  = sourceBindStructure;
+        // Copy the MYSQL_BIND data.
+        const u_int * positionsItem = positions() + foundEntry->firstPosition;
+        for ( u_int index = 0; index < foundEntry->positionsCount; index++ ) {
 
-        } catch ( std::out_of_range const & ) {
+            bindArray() [positionsItem [index]] = sourceBindStructure;
+
+        }
+
+    }
+
+    /**
+     * Searches the name binary and throws an exception if <bindVariable> is not found.
+     *
+     * @param bindVariable
+     * @return
+     */
+    auto MySqlExtBind::findNameEntry( std::string_view bindVariable ) const -> const NameEntry *
+    {
+
+        const NameEntry * firstEntry = nameEntries();
+        const NameEntry * lastEntry  = firstEntry + header().namesCount;
+
+        const NameEntry * foundEntry = std::lower_bound( firstEntry, lastEntry, bindVariable, [this]( const NameEntry & nameEntry, std::string_view searchedName )
+        {
+
+            return name( nameEntry ) < searchedName;
+
+        } );
+
+        if ( lastEntry == foundEntry || name( *foundEntry ) != bindVariable ) {
 
             using namespace std::string_literals;
 
             std::cerr
-                << "Exception #3: Bind variable ["s + bindVariable.c_str() + "] not found. Mostly a typo or an incorrect delimiters."s
+                << "Exception #3: Bind variable ["s + std::string( bindVariable ) + "] not found. Mostly a typo or an incorrect delimiters."s
                 << std::endl;
             throw FaF::Exception();
 
         }
 
+        return foundEntry;
+
+    }
+
+    /**
+     * The index of the first <?> of the bind variable in the adjusted MySQL command - it's also the index in the
+     * MYSQL_BIND array and in a BoundRow. Throws exception #3 if <bindVariable> is not found.
+     *
+     * @param bindVariable
+     * @return
+     */
+    auto MySqlExtBind::bindPosition( std::string_view bindVariable ) const -> u_int
+    {
+
+        return positions() [findNameEntry( bindVariable )->firstPosition];
+
     }
 
     /**
@@ -215,12 +608,13 @@ namespace FaF
     auto MySqlExtBind::prepareStatement() -> decltype( mysql_stmt_prepare( nullptr, nullptr, 0 ) )
     {
 
-        return mysql_stmt_prepare( m_mysqlStatementStruct, m_adjustedMysqlCommand.c_str(), strlen(m_adjustedMysqlCommand.c_str()) );
+        return mysql_stmt_prepare( m_mysqlStatementStruct, m_arena + header().adjustedMysqlCommandOffset, header().adjustedMysqlCommandLength );
 
     }
 
     /**
      * Calls mysql_stmt_bind_named_param() and with the provided bind values.
+     * The MYSQL_BIND array is already in the arena in the correct order, so nothing is allocated.
      * The return type is deducted from mysql_stmt_bind_named_param().
      *
      * @return
@@ -228,38 +622,79 @@ namespace FaF
     auto MySqlExtBind::executeBind() -> decltype( mysql_stmt_bind_named_param( nullptr, nullptr, 0, nullptr ) )
     {
 
-        const char ** mysqlNamed    = new const char * [m_bindVariablesCount]();
-        MYSQL_BIND * mysqlBindArray = new MYSQL_BIND   [m_bindVariablesCount]();
+        checkAssignedBindData();
+
+        // Run the original MySql bind function with the correctly prepared arrays.
+        return mysql_stmt_bind_named_param( m_mysqlStatementStruct, bindArray(), header().bindVariablesCount, bindNamesArray() );
+
+    }
+
+    /**
+     * Copies the bound values into a BoundRow, so the caller's buffers can be reused.
+     * Like executeBind(), it throws an exception if not all bind variables have been assigned.
+     *
+     * @return
+     */
+    auto MySqlExtBind::captureRow() -> BoundRow
+    {
 
-        for ( auto const & [bindVariable, bindItem] : m_bindNamesContainer ) {
+        return BoundRow( checkedBindArray(), header().bindVariablesCount );
 
-            // Avoid a warning which would be treated as an error.
-            (void) bindVariable;
+    }
 
-            /**
-             * Just copy to the index which corresponds the position of the bind variable in the SQL command
-             * the earlier provided MYSQL_BIND item.
-             */
-            mysqlBindArray [bindItem.bindNamePosition] = bindItem.mysqlBindItem;
+    /**
+     * Returns the MYSQL_BIND array in the order of the adjusted MySQL command - for callers which consume the
+     * bound values directly. Like executeBind(), it throws an exception if not all bind variables have been assigned.
+     *
+     * @return
+     */
+    auto MySqlExtBind::checkedBindArray() -> const MYSQL_BIND *
+    {
 
-        }
+        checkAssignedBindData();
+
+        return bindArray();
+
+    }
+
+    /**
+     * The MySQL command with the bind variables replaced by <?>.
+     *
+     * @return
+     */
+    auto MySqlExtBind::adjustedMysqlCommand() const -> std::string_view
+    {
+
+        return { m_arena + header().adjustedMysqlCommandOffset, header().adjustedMysqlCommandLength };
+
+    }
+
+    /**
+     * Throws an exception if assignBindData() hasn't been called for all bind variables.
+     * The flags are reset in any case for the next call in the same instance.
+     */
+    auto MySqlExtBind::checkAssignedBindData() -> void
+    {
+
+        const ArenaHeader & arenaHeader = header();
+        bool *              assigned    = assignedFlags();
 
         // Not all bind variables have been set using assignBindData().
-        std::string bindVariablesList {};
-        for ( auto & [bindVariable, bindItem] : m_bindNamesContainer ) {
+        if ( std::find( assigned, assigned + arenaHeader.namesCount, false ) != assigned + arenaHeader.namesCount ) {
 
-            if ( false == bindItem.assignBindData ) {
+            std::string bindVariablesList {};
+            for ( u_int index = 0; index < arenaHeader.namesCount; index++ ) {
 
-                bindVariablesList += ( 0 == bindVariablesList.length() ? "" : ", " ) + bindVariable;
+                if ( false == assigned [index] ) {
 
-            }
+                    bindVariablesList += ( 0 == bindVariablesList.length() ? "" : ", " ) + std::string( name( nameEntries() [index] ) );
 
-            // Reset it for the next call in the same instance.
-            bindItem.assignBindData = false;
+                }
 
-        }
+            }
 
-        if ( 0 != bindVariablesList.length() ) {
+            // Reset it for the next call in the same instance.
+            std::fill_n( assigned, arenaHeader.namesCount, false );
 
             std::cerr
                 << "Exception #4: For the bind variables in the below list assignBindData() has NOT been called." << std::endl
@@ -269,13 +704,186 @@ namespace FaF
 
         }
 
-        // Run the original MySql bind function with the correctly prepared arrays.
-        auto returnValue = mysql_stmt_bind_named_param( m_mysqlStatementStruct, mysqlBindArray, m_bindVariablesCount, mysqlNamed );
+        // Reset it for the next call in the same instance.
+        std::fill_n( assigned, arenaHeader.namesCount, false );
+
+    }
+
+    /**
+     * True if the item binds NULL: no buffer, the type MYSQL_TYPE_NULL or <is_null> is set.
+     *
+     * @param mysqlBindItem
+     * @return
+     */
+    auto BoundRow::isNullValue( const MYSQL_BIND & mysqlBindItem ) -> bool
+    {
+
+        return nullptr == mysqlBindItem.buffer || MYSQL_TYPE_NULL == mysqlBindItem.buffer_type ||
+               ( nullptr != mysqlBindItem.is_null && *mysqlBindItem.is_null );
+
+    }
+
+    /**
+     * The number of bytes the buffer of the item holds. Fixed size types have their size, all others *length -
+     * or buffer_length if <length> is not set. It's 0 for NULL.
+     *
+     * @param mysqlBindItem
+     * @return
+     */
+    auto BoundRow::valueLength( const MYSQL_BIND & mysqlBindItem ) -> size_t
+    {
+
+        if ( isNullValue( mysqlBindItem ) ) {
+
+            return 0;
+
+        }
+
+        switch ( mysqlBindItem.buffer_type ) {
+
+            case MYSQL_TYPE_TINY:       return 1;
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_YEAR:       return 2;
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_FLOAT:      return 4;
+            case MYSQL_TYPE_LONGLONG:
+            case MYSQL_TYPE_DOUBLE:     return 8;
+            case MYSQL_TYPE_TIME:
+            case MYSQL_TYPE_DATE:
+            case MYSQL_TYPE_DATETIME:
+            case MYSQL_TYPE_TIMESTAMP:  return sizeof( MYSQL_TIME );
+            default:                    return nullptr != mysqlBindItem.length ? *mysqlBindItem.length : mysqlBindItem.buffer_length;
+
+        }
+
+    }
+
+    /**
+     * Copies the MYSQL_BIND items and the values they point to into one allocation:
+     *   MYSQL_BIND    [bindVariablesCount]
+     *   unsigned long [bindVariablesCount] - the lengths,
+     *   bool          [bindVariablesCount] - the NULL flags,
+     *   the values, each aligned to 8 bytes.
+     * See valueLength() for the number of copied bytes.
+     *
+     * @param sourceBindArray
+     * @param bindVariablesCount
+     */
+    BoundRow::BoundRow( const MYSQL_BIND * sourceBindArray, u_int bindVariablesCount )
+    :
+        m_bindVariablesCount( bindVariablesCount )
+    {
+
+        const size_t valuesOffset = alignOffset( bindVariablesCount * ( sizeof( MYSQL_BIND ) + sizeof( unsigned long ) + sizeof( bool ) ), 8 );
+
+        size_t storageSize = valuesOffset;
+        for ( u_int index = 0; index < bindVariablesCount; index++ ) {
+
+            storageSize += alignOffset( valueLength( sourceBindArray [index] ), 8 );
+
+        }
+
+        m_storage = std::make_unique<char []>( storageSize );
+
+        MYSQL_BIND *    mysqlBindArray = bindArray();
+        unsigned long * lengths        = reinterpret_cast<unsigned long *>( mysqlBindArray + bindVariablesCount );
+        bool *          nullFlags      = reinterpret_cast<bool *>( lengths + bindVariablesCount );
+        char *          valueItem      = m_storage.get() + valuesOffset;
+
+        for ( u_int index = 0; index < bindVariablesCount; index++ ) {
+
+            const MYSQL_BIND & sourceBindItem = sourceBindArray [index];
+            const size_t       length         = valueLength( sourceBindItem );
+
+            lengths   [index] = static_cast<unsigned long>( length );
+            nullFlags [index] = isNullValue( sourceBindItem );
 
-        delete [] mysqlBindArray;
-        delete [] mysqlNamed;
+            if ( 0 != length ) {
 
-        return returnValue;
+                std::memcpy( valueItem, sourceBindItem.buffer, length );
+
+            }
+
+            MYSQL_BIND & mysqlBindItem = mysqlBindArray [index];
+            mysqlBindItem               = MYSQL_BIND {};
+            mysqlBindItem.buffer_type   = sourceBindItem.buffer_type;
+            mysqlBindItem.is_unsigned   = sourceBindItem.is_unsigned;
+            mysqlBindItem.buffer        = valueItem;
+            mysqlBindItem.buffer_length = static_cast<unsigned long>( length );
+            mysqlBindItem.length        = &lengths [index];
+            mysqlBindItem.is_null       = &nullFlags [index];
+
+            valueItem += alignOffset( length, 8 );
+
+        }
+
+    }
+
+    /**
+     * The memory used by this instance - it's the size of the arena:
+     * the adjusted SQL command, the names with their positions and the MYSQL_BIND array with its helper arrays.
+     *
+     * @return
+     */
+    auto MySqlExtBind::memoryUsage() const -> MemoryUsage
+    {
+
+        if ( nullptr == m_arena ) {
+
+            return MemoryUsage {};
+
+        }
+
+        const ArenaHeader & arenaHeader = header();
+        MemoryUsage         memoryUsage {};
+
+        memoryUsage.sqlText    = arenaHeader.adjustedMysqlCommandLength + 1;
+        memoryUsage.bindArrays = arenaSize( arenaHeader ) - bindArrayOffset( arenaHeader );
+        memoryUsage.nameTable  = arenaSize( arenaHeader ) - memoryUsage.sqlText - memoryUsage.bindArrays;
+
+        return memoryUsage;
+
+    }
+
+    /**
+     * The memory used by all existing instances.
+     *
+     * @return
+     */
+    auto MySqlExtBind::globalMemoryUsage() -> MemoryUsage
+    {
+
+        return MemoryUsage {
+            m_globalSqlText.load   ( std::memory_order_relaxed ),
+            m_globalNameTable.load ( std::memory_order_relaxed ),
+            m_globalBindArrays.load( std::memory_order_relaxed )
+        };
+
+    }
+
+    /**
+     * Adds <memoryUsage> to the global counters or removes it.
+     *
+     * @param memoryUsage
+     * @param add
+     */
+    auto MySqlExtBind::accountMemoryUsage( const MemoryUsage & memoryUsage, bool add ) -> void
+    {
+
+        if ( add ) {
+
+            m_globalSqlText.fetch_add   ( memoryUsage.sqlText,    std::memory_order_relaxed );
+            m_globalNameTable.fetch_add ( memoryUsage.nameTable,  std::memory_order_relaxed );
+            m_globalBindArrays.fetch_add( memoryUsage.bindArrays, std::memory_order_relaxed );
+
+        } else {
+
+            m_globalSqlText.fetch_sub   ( memoryUsage.sqlText,    std::memory_order_relaxed );
+            m_globalNameTable.fetch_sub ( memoryUsage.nameTable,  std::memory_order_relaxed );
+            m_globalBindArrays.fetch_sub( memoryUsage.bindArrays, std::memory_order_relaxed );
+
+        }
 
     }
 
@@ -10,13 +10,21 @@
  *
  */
 
+#ifndef FAF_MYSQL_EXT_BIND_H
+#define FAF_MYSQL_EXT_BIND_H
+
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <iostream>
-#include <map>
+#include <memory>
+#include <memory_resource>
 #include <regex>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 
 #include <mysql.h>
 
@@ -24,28 +32,115 @@ namespace FaF
 {
 
     /**
-     * The position in the MySQL command must be saved for each MYSQL_BIND item in order to create the final MYSQL_BIND array
-     * in the correct order according to the provided bind names.
-     * This type is the value in each std::map.
+     * The heap and object memory used by the extension, broken down into the SQL commands, the bind names container
+     * and the MYSQL_BIND items. See MySqlExtBind::memoryUsage() and MySqlExtBind::globalMemoryUsage().
      */
-    using MapItem = struct MapItem
+    using MemoryUsage = struct MemoryUsage
     {
 
-            u_int       bindNamePosition;
-            bool        assignBindData {};
-            MYSQL_BIND  mysqlBindItem  {};
+            size_t      sqlText    {};
+            size_t      nameTable  {};
+            size_t      bindArrays {};
+
+            auto total() const -> size_t { return sqlText + nameTable + bindArrays; }
 
     };
 
-    using MapContainer = std::map< const std::string, MapItem >;
+    /**
+     * A copy of all bound values of a statement in one allocation. The MYSQL_BIND items point into the allocation,
+     * <length> and <is_null> are always set. It's created by MySqlExtBind::captureRow(), so the caller can reuse
+     * the buffers immediately - for example while the row is waiting in a batch.
+     */
+    class BoundRow
+    {
+
+        public:
+
+            BoundRow() = default;
+
+            auto bindVariablesCount() const -> u_int        { return m_bindVariablesCount; }
+            auto bindArray()          const -> MYSQL_BIND * { return reinterpret_cast<MYSQL_BIND *>( m_storage.get() ); }
+
+            static auto isNullValue( const MYSQL_BIND & mysqlBindItem ) -> bool;
+            static auto valueLength( const MYSQL_BIND & mysqlBindItem ) -> size_t;
+
+        private:
+
+            friend class MySqlExtBind;
+
+            BoundRow( const MYSQL_BIND * sourceBindArray, u_int bindVariablesCount );
+
+            std::unique_ptr<char []>    m_storage;
+            u_int                       m_bindVariablesCount {};
+
+    };
 
     class MySqlExtBind
     {
 
         private:
 
-            auto parseMysqlCommand()                                                                            -> void;
-            auto copyBindStructure( const std::string bindVariable, const MYSQL_BIND & sourceBindStructure )    -> void;
+            /**
+             * All data of a statement is stored in one arena allocated after the MySQL command has been parsed.
+             * The arena does not contain any pointers, so it can be copied with memcpy().
+             *
+             * The first part is the parsed template - it depends only on the MySQL command:
+             *   ArenaHeader
+             *   NameEntry   [namesCount]          - sorted by the name, so it can be searched binary.
+             *   u_int       [bindVariablesCount]  - the positions of the bind variables, grouped by the NameEntry items.
+             *   char        [...]                 - the adjusted MySQL command, a '\0' and the names.
+             *
+             * The second part is the bind data of the instance:
+             *   MYSQL_BIND  [bindVariablesCount]  - in the order of the adjusted MySQL command.
+             *   const char *[bindVariablesCount]  - the names for mysql_stmt_bind_named_param() - all nullptr.
+             *   bool        [namesCount]          - set by assignBindData().
+             */
+            using ArenaHeader = struct ArenaHeader
+            {
+
+                    u_int   templateSize;
+                    u_int   bindVariablesCount;
+                    u_int   namesCount;
+                    u_int   nameEntriesOffset;
+                    u_int   positionsOffset;
+                    u_int   adjustedMysqlCommandOffset;
+                    u_int   adjustedMysqlCommandLength;
+
+            };
+
+            using NameEntry = struct NameEntry
+            {
+
+                    u_int   nameOffset;
+                    u_int   nameLength;
+                    u_int   firstPosition;
+                    u_int   positionsCount;
+
+            };
+
+            auto parseMysqlCommand( std::string_view mysqlCommand )                                             -> void;
+            auto buildArena( std::string_view adjustedMysqlCommand, const std::string_view * positionNames,
+                             u_int bindVariablesCount )                                                         -> void;
+            auto copyBindStructure( std::string_view bindVariable, const MYSQL_BIND & sourceBindStructure )     -> void;
+            auto findNameEntry( std::string_view bindVariable ) const                                           -> const NameEntry *;
+            auto checkAssignedBindData()                                                                        -> void;
+
+            // The arena accessors.
+            auto header()          const -> const ArenaHeader & { return *reinterpret_cast<const ArenaHeader *>( m_arena ); }
+            auto nameEntries()     const -> const NameEntry *   { return reinterpret_cast<const NameEntry *>( m_arena + header().nameEntriesOffset ); }
+            auto positions()       const -> const u_int *       { return reinterpret_cast<const u_int *>( m_arena + header().positionsOffset ); }
+            auto name( const NameEntry & nameEntry ) const -> std::string_view { return { m_arena + nameEntry.nameOffset, nameEntry.nameLength }; }
+            auto bindArray()       const -> MYSQL_BIND *        { return reinterpret_cast<MYSQL_BIND *>( m_arena + bindArrayOffset( header() ) ); }
+            auto bindNamesArray()  const -> const char **       { return reinterpret_cast<const char **>( bindArray() + header().bindVariablesCount ); }
+            auto assignedFlags()   const -> bool *              { return reinterpret_cast<bool *>( bindNamesArray() + header().bindVariablesCount ); }
+
+            // Leaves the arena empty - used by fromTemplateImage().
+            MySqlExtBind( MYSQL_STMT * _mysqlStatementStruct, std::pmr::memory_resource * _memoryResource );
+
+            static auto bindVariablePattern()                              -> std::string;
+            static auto bindArrayOffset( const ArenaHeader & arenaHeader ) -> size_t;
+            static auto arenaSize( const ArenaHeader & arenaHeader )       -> size_t;
+            static auto accountMemoryUsage( const MemoryUsage & memoryUsage, bool add ) -> void;
 
             // constructor initialiser list - respect the order.
 
@@ -53,40 +148,64 @@ namespace FaF
                  * The pointer to the MySQL statement - mysql_stmt_init() must have been already called, otherwise undefined behaviour.
                  * Do not call mysql_stmt_prepare() as it contains syntax errors due to the extended bind name format.
                  */
-                MYSQL_STMT *        m_mysqlStatementStruct;
-                const std::string   m_mysqlCommand;
-                std::string         m_adjustedMysqlCommand;
+                MYSQL_STMT *                m_mysqlStatementStruct;
+                std::pmr::memory_resource * m_memoryResource;
 
             // The left and right delimiter - can be overwritten any time using the static function ::setDelimiters()
             static std::string      m_leftDelimiter;
             static std::string      m_rightDelimiter;
 
-            // This container maps to each named bind variable the original MYSQL_BIND structure and the position in the SQL statement.
-            MapContainer            m_bindNamesContainer {};
-
-            // The MYSQL_BIND array which will be filled in the correct order once all bind variables have been processed.
-            MYSQL_BIND *            m_finalMysqlBindArray;
+            // The statement arena - see ArenaHeader.
+            char *                  m_arena {};
 
-            // How many bind variables does this statement have.
-            u_int                   m_bindVariablesCount {};
+            // The memory usage of all existing instances.
+            static std::atomic<size_t> m_globalSqlText;
+            static std::atomic<size_t> m_globalNameTable;
+            static std::atomic<size_t> m_globalBindArrays;
 
         public:
 
-            MySqlExtBind( MYSQL_STMT * _mysqlStatementStruct, const std::string _mysqlCommand );
+            MySqlExtBind( MYSQL_STMT * _mysqlStatementStruct, std::string_view _mysqlCommand,
+                          std::pmr::memory_resource * _memoryResource = std::pmr::get_default_resource() );
+            MySqlExtBind( const MySqlExtBind & otherExtBind );
+            MySqlExtBind( MySqlExtBind && otherExtBind ) noexcept;
+            MySqlExtBind & operator=( MySqlExtBind otherExtBind ) noexcept;
+            ~MySqlExtBind();
 
-            auto assignBindData( const std::string, const MYSQL_BIND & originalMysqlBindItem ) -> void;
+            auto assignBindData( std::string_view, const MYSQL_BIND & originalMysqlBindItem ) -> void;
             auto assignBindData(
-                    const std::string,
-                    // m_finalMysqlBindArray is only a placeholder so we can access the MYSQL_BIND's members.
-                    decltype( m_finalMysqlBindArray->buffer_type ),
-                    decltype( m_finalMysqlBindArray->buffer      ),
-                    decltype( m_finalMysqlBindArray->length      ) length  = nullptr,
-                    decltype( m_finalMysqlBindArray->is_null     ) is_null = nullptr
+                    std::string_view,
+                    decltype( MYSQL_BIND::buffer_type ),
+                    decltype( MYSQL_BIND::buffer      ),
+                    decltype( MYSQL_BIND::length      ) length  = nullptr,
+                    decltype( MYSQL_BIND::is_null     ) is_null = nullptr
             ) -> void;
             auto executeBind()      -> decltype( mysql_stmt_bind_named_param( nullptr, nullptr, 0, nullptr ) );
             auto prepareStatement() -> decltype( mysql_stmt_prepare( nullptr, nullptr, 0 ) );
+            auto captureRow()       -> BoundRow;
+            auto checkedBindArray() -> const MYSQL_BIND *;
+            auto replaceStatement( MYSQL_STMT * mysqlStatementStruct ) -> void { m_mysqlStatementStruct = mysqlStatementStruct; }
+
+            auto adjustedMysqlCommand() const -> std::string_view;
+            auto bindVariablesCount()   const -> u_int { return header().bindVariablesCount; }
+            auto bindPosition( std::string_view bindVariable ) const -> u_int;
+
+            // Changed whenever the layout of the template part of the arena changes - stored template images are invalid then.
+            static constexpr u_int templateImageVersion { 1 };
+
+            auto        templateImage() const -> std::string_view;
+            static auto fromTemplateImage( MYSQL_STMT * mysqlStatementStruct, std::string_view templateImage,
+                                           std::pmr::memory_resource * memoryResource = std::pmr::get_default_resource() ) -> MySqlExtBind;
+            static auto fromAdjustedCommand( MYSQL_STMT * mysqlStatementStruct, std::string_view adjustedMysqlCommand,
+                                             const std::vector<std::string_view> & positionNames,
+                                             std::pmr::memory_resource * memoryResource = std::pmr::get_default_resource() ) -> MySqlExtBind;
 
             static auto setDelimiters( const std::string leftDelimiter = ":", const std::string rightDelimiter = "" ) -> void;
+            static auto delimiters() -> std::pair<std::string_view, std::string_view> { return { m_leftDelimiter, m_rightDelimiter }; }
+            static auto hasBindVariables( std::string_view mysqlCommand ) -> bool;
+
+            auto        memoryUsage() const -> MemoryUsage;
+            static auto globalMemoryUsage() -> MemoryUsage;
 
     };
 
@@ -95,3 +214,5 @@ namespace FaF
     };
 
 }
+
+#endif
@@ -0,0 +1,342 @@
+/**
+ * MySqlExtBindAsync.cpp
+ *
+ * The I/O threads and the worker take their work from lock-free queues. An idle thread sleeps in
+ * std::atomic::wait() on a counter which the producers increment - it's woken by notify_one(),
+ * so neither handing over a call nor resuming a coroutine allocates or takes a lock.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindAsync.h"
+
+namespace
+{
+
+    /**
+     * Pushes <item> and wakes the consumer. Yields while the queue is full.
+     *
+     * @param queue
+     * @param item
+     * @param counter
+     */
+    template < typename Item >
+    auto pushAndNotify( FaF::MpscQueue<Item> & queue, Item item, std::atomic<u_int> & counter ) -> void
+    {
+
+        while ( false == queue.tryPush( std::move( item ) ) ) {
+
+            std::this_thread::yield();
+
+        }
+
+        counter.fetch_add( 1, std::memory_order_release );
+        counter.notify_one();
+
+    }
+
+    /**
+     * Pops the next item - waits until there is one. Returns false if <stop> is set and the queue is empty.
+     *
+     * @param queue
+     * @param item
+     * @param counter
+     * @param stop
+     * @return
+     */
+    template < typename Item >
+    auto waitAndPop( FaF::MpscQueue<Item> & queue, Item & item, std::atomic<u_int> & counter, const std::atomic<bool> & stop ) -> bool
+    {
+
+        while ( true ) {
+
+            const u_int observed = counter.load( std::memory_order_acquire );
+
+            if ( queue.tryPop( item ) ) {
+
+                return true;
+
+            }
+            if ( stop.load( std::memory_order_acquire ) ) {
+
+                return false;
+
+            }
+
+            // Returns immediately if an item has been pushed since <observed> has been read.
+            counter.wait( observed, std::memory_order_acquire );
+
+        }
+
+    }
+
+}
+
+namespace FaF
+{
+
+    MySqlExtBindWorker::MySqlExtBindWorker( u_int queueCapacity )
+    :
+        m_queue( queueCapacity )
+    {
+
+        m_workerThread = std::thread( &MySqlExtBindWorker::run, this );
+
+    }
+
+    /**
+     * The coroutines scheduled until then are resumed before the worker thread ends.
+     */
+    MySqlExtBindWorker::~MySqlExtBindWorker()
+    {
+
+        m_stop.store( true, std::memory_order_release );
+        m_scheduled.fetch_add( 1, std::memory_order_release );
+        m_scheduled.notify_one();
+        m_workerThread.join();
+
+    }
+
+    auto MySqlExtBindWorker::schedule( std::coroutine_handle<> coroutineHandle ) noexcept -> void
+    {
+
+        pushAndNotify( m_queue, coroutineHandle, m_scheduled );
+
+    }
+
+    auto MySqlExtBindWorker::run() -> void
+    {
+
+        std::coroutine_handle<> coroutineHandle;
+
+        while ( waitAndPop( m_queue, coroutineHandle, m_scheduled, m_stop ) ) {
+
+            coroutineHandle.resume();
+
+        }
+
+    }
+
+    /**
+     * @param mysqlConnection
+     * @param scheduler        Resumes the coroutines. If it's nullptr, they are resumed on the I/O thread - they
+     *                         must not block it then.
+     * @param queueCapacity    The number of calls which can wait for the I/O thread.
+     */
+    MySqlExtBindIoThread::MySqlExtBindIoThread( MYSQL * mysqlConnection, MySqlExtBindScheduler * scheduler, u_int queueCapacity )
+    :
+        m_mysqlConnection( mysqlConnection ),
+        m_scheduler      ( scheduler ),
+        m_queue          ( queueCapacity )
+    {
+
+        m_ioThread = std::thread( &MySqlExtBindIoThread::runOperations, this );
+
+    }
+
+    /**
+     * The calls submitted until then are run before the I/O thread ends.
+     */
+    MySqlExtBindIoThread::~MySqlExtBindIoThread()
+    {
+
+        m_stop.store( true, std::memory_order_release );
+        m_submitted.fetch_add( 1, std::memory_order_release );
+        m_submitted.notify_one();
+        m_ioThread.join();
+
+    }
+
+    /**
+     * Called by the awaitables - the awaiting coroutine is suspended already. A coroutine resumed on the I/O thread
+     * itself - without scheduler - would wait forever for room in a full queue, as only the I/O thread empties it.
+     * The call is run right away then and the coroutine isn't suspended.
+     *
+     * @param asyncOperation
+     * @return False if the call has been run already - the coroutine continues immediately.
+     */
+    auto MySqlExtBindIoThread::submit( MySqlExtBindAsyncOperation & asyncOperation ) -> bool
+    {
+
+        if ( std::this_thread::get_id() != m_ioThread.get_id() ) {
+
+            pushAndNotify( m_queue, &asyncOperation, m_submitted );
+            return true;
+
+        }
+
+        if ( m_queue.tryPush( &asyncOperation ) ) {
+
+            m_submitted.fetch_add( 1, std::memory_order_release );
+            return true;
+
+        }
+
+        asyncOperation.run();
+
+        return false;
+
+    }
+
+    auto MySqlExtBindIoThread::runOperations() -> void
+    {
+
+        MySqlExtBindAsyncOperation * asyncOperation {};
+
+        while ( waitAndPop( m_queue, asyncOperation, m_submitted, m_stop ) ) {
+
+            asyncOperation->run();
+
+            // The operation is gone as soon as the coroutine continues - don't touch it afterwards.
+            const std::coroutine_handle<> coroutineHandle = asyncOperation->m_coroutineHandle;
+
+            if ( nullptr != m_scheduler ) {
+
+                m_scheduler->schedule( coroutineHandle );
+
+            } else {
+
+                coroutineHandle.resume();
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Starts one I/O thread per connection.
+     *
+     * @param mysqlConnections
+     * @param scheduler
+     */
+    MySqlExtBindConnectionPool::MySqlExtBindConnectionPool( const std::vector<MYSQL *> & mysqlConnections, MySqlExtBindScheduler * scheduler )
+    {
+
+        m_ioThreads.reserve( mysqlConnections.size() );
+
+        for ( MYSQL * mysqlConnection : mysqlConnections ) {
+
+            m_ioThreads.push_back( std::make_unique<MySqlExtBindIoThread>( mysqlConnection, scheduler ) );
+
+        }
+
+    }
+
+    /**
+     * Round robin over the connections - for statements which may use any connection.
+     *
+     * @return
+     */
+    auto MySqlExtBindConnectionPool::nextIoThread() -> MySqlExtBindIoThread &
+    {
+
+        return *m_ioThreads [m_nextIndex.fetch_add( 1, std::memory_order_relaxed ) % m_ioThreads.size()];
+
+    }
+
+    MySqlExtBindAsyncRows::MySqlExtBindAsyncRows( MySqlExtBindIoThread & ioThread, MYSQL_STMT * mysqlStatement, MYSQL_BIND * resultBindArray )
+    :
+        m_ioThread       ( ioThread ),
+        m_mysqlStatement ( mysqlStatement ),
+        m_resultBindArray( resultBindArray )
+    {
+    }
+
+    /**
+     * Fetches the next stored row - no I/O. The result is freed after the last row.
+     *
+     * @return True if a row has been fetched.
+     */
+    auto MySqlExtBindAsyncRows::fetch() -> bool
+    {
+
+        m_status = mysql_stmt_fetch( m_mysqlStatement );
+
+        if ( 0 == m_status || MYSQL_DATA_TRUNCATED == m_status ) {
+
+            return true;
+
+        }
+
+        mysql_stmt_free_result( m_mysqlStatement );
+
+        return false;
+
+    }
+
+    /**
+     * Once the result is stored, the rows are fetched without suspending.
+     *
+     * @return
+     */
+    auto MySqlExtBindAsyncRows::NextRow::await_ready() -> bool
+    {
+
+        if ( false == m_asyncRows.m_stored ) {
+
+            return false;
+
+        }
+
+        m_hasRow = MYSQL_NO_DATA != m_asyncRows.m_status && 1 != m_asyncRows.m_status && m_asyncRows.fetch();
+
+        return true;
+
+    }
+
+    auto MySqlExtBindAsyncRows::NextRow::await_suspend( std::coroutine_handle<> coroutineHandle ) -> bool
+    {
+
+        m_coroutineHandle = coroutineHandle;
+        return m_asyncRows.m_ioThread.submit( *this );
+
+    }
+
+    /**
+     * Runs on the I/O thread: binds the result buffers, reads the complete result and fetches the first row.
+     */
+    auto MySqlExtBindAsyncRows::NextRow::run() noexcept -> void
+    {
+
+        m_asyncRows.m_stored = true;
+
+        if ( mysql_stmt_bind_result( m_asyncRows.m_mysqlStatement, m_asyncRows.m_resultBindArray ) ||
+             0 != mysql_stmt_store_result( m_asyncRows.m_mysqlStatement ) ) {
+
+            m_asyncRows.m_status = 1;
+            m_hasRow             = false;
+            return;
+
+        }
+
+        m_hasRow = m_asyncRows.fetch();
+
+    }
+
+    MySqlExtBindAsyncStatement::MySqlExtBindAsyncStatement( MySqlExtBindIoThread & ioThread, MySqlExtBind & fafExtBind,
+                                                            MYSQL_STMT * mysqlStatement )
+    :
+        m_ioThread      ( ioThread ),
+        m_fafExtBind    ( fafExtBind ),
+        m_mysqlStatement( mysqlStatement )
+    {
+    }
+
+    /**
+     * The statement must have been executed.
+     *
+     * @param resultBindArray
+     * @return
+     */
+    auto MySqlExtBindAsyncStatement::rows( MYSQL_BIND * resultBindArray ) -> MySqlExtBindAsyncRows
+    {
+
+        return MySqlExtBindAsyncRows( m_ioThread, m_mysqlStatement, resultBindArray );
+
+    }
+
+}
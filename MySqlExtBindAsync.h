@@ -0,0 +1,376 @@
+/**
+ * MySqlExtBindAsync.h
+ *
+ * Header for the C++20 coroutine interface: the blocking client calls of a connection are handed to the
+ * MySqlExtBindIoThread of the connection and the awaiting coroutine is resumed when the call returns -
+ * on the I/O thread or by a MySqlExtBindScheduler. Needs -std=c++20, the rest of the extension stays C++17.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_ASYNC_H
+#define FAF_MYSQL_EXT_BIND_ASYNC_H
+
+#if !defined( __cpp_impl_coroutine ) || 201902L > __cpp_impl_coroutine
+#error "MySqlExtBindAsync.h needs C++20 coroutines - compile with -std=c++20"
+#endif
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "MySqlExtBind.h"
+#include "MySqlExtBindQueue.h"
+
+namespace FaF
+{
+
+    /**
+     * Resumes the coroutines whose client call has returned. Implement it to resume them on the threads of
+     * an existing event loop - schedule() is called by the I/O threads and must not block.
+     */
+    class MySqlExtBindScheduler
+    {
+
+        public:
+
+            virtual ~MySqlExtBindScheduler() = default;
+
+            virtual auto schedule( std::coroutine_handle<> coroutineHandle ) noexcept -> void = 0;
+
+    };
+
+    /**
+     * A scheduler with one worker thread which resumes the coroutines of any number of I/O threads.
+     */
+    class MySqlExtBindWorker : public MySqlExtBindScheduler
+    {
+
+        public:
+
+            explicit MySqlExtBindWorker( u_int queueCapacity = 65536 );
+            ~MySqlExtBindWorker() override;
+
+            MySqlExtBindWorker( const MySqlExtBindWorker & )             = delete;
+            MySqlExtBindWorker & operator=( const MySqlExtBindWorker & ) = delete;
+
+            auto schedule( std::coroutine_handle<> coroutineHandle ) noexcept -> void override;
+
+        private:
+
+            auto run() -> void;
+
+            // constructor initialiser list - respect the order.
+
+                MpscQueue< std::coroutine_handle<> >    m_queue;
+
+            // Incremented with each scheduled coroutine - the idle worker thread waits for a change.
+            std::atomic<u_int>                          m_scheduled {};
+            std::atomic<bool>                           m_stop      {};
+            std::thread                                 m_workerThread;
+
+    };
+
+    /**
+     * A client call waiting for the I/O thread. It lives in the frame of the awaiting coroutine,
+     * so handing it over and resuming the coroutine doesn't allocate.
+     */
+    class MySqlExtBindAsyncOperation
+    {
+
+        public:
+
+            MySqlExtBindAsyncOperation( const MySqlExtBindAsyncOperation & )             = delete;
+            MySqlExtBindAsyncOperation & operator=( const MySqlExtBindAsyncOperation & ) = delete;
+
+        protected:
+
+            MySqlExtBindAsyncOperation()  = default;
+            ~MySqlExtBindAsyncOperation() = default;
+
+            virtual auto run() noexcept -> void = 0;
+
+            std::coroutine_handle<> m_coroutineHandle;
+
+            friend class MySqlExtBindIoThread;
+
+    };
+
+    template < typename Function >
+    class MySqlExtBindAwaitable;
+
+    /**
+     * Runs the client calls of one connection in the order they are submitted. The connection must not be used
+     * elsewhere while the I/O thread exists.
+     */
+    class MySqlExtBindIoThread
+    {
+
+        public:
+
+            explicit MySqlExtBindIoThread( MYSQL * mysqlConnection, MySqlExtBindScheduler * scheduler = nullptr,
+                                           u_int queueCapacity = 1024 );
+            ~MySqlExtBindIoThread();
+
+            MySqlExtBindIoThread( const MySqlExtBindIoThread & )             = delete;
+            MySqlExtBindIoThread & operator=( const MySqlExtBindIoThread & ) = delete;
+
+            /**
+             * co_await run( function ) calls <function> on the I/O thread and returns its result.
+             */
+            template < typename Function >
+            auto run( Function && function ) -> MySqlExtBindAwaitable< std::decay_t<Function> >
+            {
+
+                return MySqlExtBindAwaitable< std::decay_t<Function> >( *this, std::forward<Function>( function ) );
+
+            }
+
+            auto submit( MySqlExtBindAsyncOperation & asyncOperation ) -> bool;
+
+            auto connection() const -> MYSQL * { return m_mysqlConnection; }
+
+        private:
+
+            auto runOperations() -> void;
+
+            // constructor initialiser list - respect the order.
+
+                MYSQL *                                 m_mysqlConnection;
+                MySqlExtBindScheduler *                 m_scheduler;
+                MpscQueue< MySqlExtBindAsyncOperation * > m_queue;
+
+            std::atomic<u_int>                          m_submitted {};
+            std::atomic<bool>                           m_stop      {};
+            std::thread                                 m_ioThread;
+
+    };
+
+    /**
+     * The result of co_await MySqlExtBindIoThread::run(). If <function> throws, the exception is rethrown
+     * in the awaiting coroutine.
+     */
+    template < typename Function >
+    class MySqlExtBindAwaitable : public MySqlExtBindAsyncOperation
+    {
+
+        public:
+
+            using Result = std::invoke_result_t<Function &>;
+
+            MySqlExtBindAwaitable( MySqlExtBindIoThread & ioThread, Function function )
+            :
+                m_ioThread( ioThread ),
+                m_function( std::move( function ) )
+            {
+            }
+
+            auto await_ready() const noexcept -> bool { return false; }
+
+            auto await_suspend( std::coroutine_handle<> coroutineHandle ) -> bool
+            {
+
+                m_coroutineHandle = coroutineHandle;
+                return m_ioThread.submit( *this );
+
+            }
+
+            auto await_resume() -> Result
+            {
+
+                if ( m_exception ) {
+
+                    std::rethrow_exception( m_exception );
+
+                }
+                if constexpr ( false == std::is_void_v<Result> ) {
+
+                    return std::move( *m_result );
+
+                }
+
+            }
+
+        private:
+
+            auto run() noexcept -> void override
+            {
+
+                try {
+
+                    if constexpr ( std::is_void_v<Result> ) {
+
+                        m_function();
+
+                    } else {
+
+                        m_result.emplace( m_function() );
+
+                    }
+
+                } catch ( ... ) {
+
+                    m_exception = std::current_exception();
+
+                }
+
+            }
+
+            // constructor initialiser list - respect the order.
+
+                MySqlExtBindIoThread &  m_ioThread;
+                Function                m_function;
+
+            std::conditional_t< std::is_void_v<Result>, bool, std::optional<Result> > m_result {};
+            std::exception_ptr                                                     m_exception;
+
+    };
+
+    /**
+     * One I/O thread per connection, all of them resuming their coroutines through the same scheduler.
+     */
+    class MySqlExtBindConnectionPool
+    {
+
+        public:
+
+            MySqlExtBindConnectionPool( const std::vector<MYSQL *> & mysqlConnections, MySqlExtBindScheduler * scheduler = nullptr );
+
+            auto size()                    const -> size_t                 { return m_ioThreads.size(); }
+            auto ioThread( size_t index )        -> MySqlExtBindIoThread & { return *m_ioThreads [index]; }
+            auto nextIoThread()                  -> MySqlExtBindIoThread &;
+
+        private:
+
+            std::vector< std::unique_ptr<MySqlExtBindIoThread> >  m_ioThreads;
+            std::atomic<size_t>                                   m_nextIndex {};
+
+    };
+
+    /**
+     * Fetches the rows of an executed statement into <resultBindArray>. The first next() stores the complete
+     * result on the I/O thread, the following ones read from the client buffer without suspending.
+     * Read the rows until next() returns false - the result is freed then.
+     *
+     *     MySqlExtBindAsyncRows rows = asyncStatement.rows( resultBindArray );
+     *     while ( co_await rows.next() ) { ... }
+     */
+    class MySqlExtBindAsyncRows
+    {
+
+        public:
+
+            MySqlExtBindAsyncRows( MySqlExtBindIoThread & ioThread, MYSQL_STMT * mysqlStatement, MYSQL_BIND * resultBindArray );
+
+            MySqlExtBindAsyncRows( const MySqlExtBindAsyncRows & )             = delete;
+            MySqlExtBindAsyncRows & operator=( const MySqlExtBindAsyncRows & ) = delete;
+
+            class NextRow : public MySqlExtBindAsyncOperation
+            {
+
+                public:
+
+                    explicit NextRow( MySqlExtBindAsyncRows & asyncRows ) : m_asyncRows( asyncRows ) {}
+
+                    auto await_ready()                                           -> bool;
+                    auto await_suspend( std::coroutine_handle<> coroutineHandle ) -> bool;
+                    auto await_resume() const                                    -> bool { return m_hasRow; }
+
+                private:
+
+                    auto run() noexcept -> void override;
+
+                    // constructor initialiser list - respect the order.
+
+                        MySqlExtBindAsyncRows & m_asyncRows;
+
+                    bool                        m_hasRow {};
+
+            };
+
+            auto next() -> NextRow { return NextRow( *this ); }
+
+            // The return code of the last mysql_stmt_fetch() - or the error of mysql_stmt_store_result().
+            auto status() const -> int { return m_status; }
+
+        private:
+
+            auto fetch() -> bool;
+
+            // constructor initialiser list - respect the order.
+
+                MySqlExtBindIoThread &  m_ioThread;
+                MYSQL_STMT *            m_mysqlStatement;
+                MYSQL_BIND *            m_resultBindArray;
+
+            bool                        m_stored {};
+            int                         m_status {};
+
+    };
+
+    /**
+     * The coroutine version of prepareStatement() and executeBind() plus mysql_stmt_execute().
+     * The bind data is assigned on the calling thread as usual.
+     */
+    class MySqlExtBindAsyncStatement
+    {
+
+        public:
+
+            MySqlExtBindAsyncStatement( MySqlExtBindIoThread & ioThread, MySqlExtBind & fafExtBind, MYSQL_STMT * mysqlStatement );
+
+            /**
+             * co_await prepare() returns the result of MySqlExtBind::prepareStatement().
+             */
+            auto prepare()
+            {
+
+                return m_ioThread.run( [this]() { return m_fafExtBind.prepareStatement(); } );
+
+            }
+
+            /**
+             * co_await execute() returns the MySQL error code - 0 if the statement has been executed.
+             */
+            auto execute()
+            {
+
+                return m_ioThread.run( [this]() -> unsigned int
+                {
+
+                    if ( m_fafExtBind.executeBind() || 0 != mysql_stmt_execute( m_mysqlStatement ) ) {
+
+                        return mysql_stmt_errno( m_mysqlStatement );
+
+                    }
+
+                    return 0;
+
+                } );
+
+            }
+
+            auto rows( MYSQL_BIND * resultBindArray ) -> MySqlExtBindAsyncRows;
+
+        private:
+
+            // constructor initialiser list - respect the order.
+
+                MySqlExtBindIoThread &  m_ioThread;
+                MySqlExtBind &          m_fafExtBind;
+                MYSQL_STMT *            m_mysqlStatement;
+
+    };
+
+}
+
+#endif
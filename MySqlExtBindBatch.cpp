@@ -0,0 +1,838 @@
+/**
+ * MySqlExtBindBatch.cpp
+ *
+ * Collects rows bound with MySqlExtBind and executes them as multi-row INSERT statements:
+ *   INSERT INTO foo (a, b) VALUES (?, ?), (?, ?), (?, ?) ...
+ * One statement is prepared per rows count and cached. Full statements have <maxRowsPerStatement> rows,
+ * the rest is split into powers of 2, so at most log2(maxRowsPerStatement) + 2 statements are prepared.
+ *
+ * Concurrent batches which lock the same rows in different orders deadlock. With orderByKey() all batches
+ * lock them in the order of the key, and with bisectLockErrors() a statement which timed out waiting for a lock,
+ * or lost a deadlock in autocommit mode, is split in halves - the other rows don't fail with it.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindBatch.h"
+
+#include <algorithm>
+#include <cctype>
+#include <numeric>
+
+#include <errmsg.h>
+#include <mysqld_error.h>
+
+namespace
+{
+
+    // MySQL accepts at most 65535 placeholders per statement.
+    constexpr u_int g_maxPlaceholders { 65535 };
+
+    /**
+     * Returns the position after the quoted string, identifier or comment starting at <position>,
+     * or <position> if there is none. Comments are #, -- and C style.
+     *
+     * @param mysqlCommand
+     * @param position
+     * @return
+     */
+    auto skipQuoted( std::string_view mysqlCommand, size_t position ) -> size_t
+    {
+
+        const char character = mysqlCommand [position];
+
+        if ( '\'' == character || '"' == character || '`' == character ) {
+
+            for ( size_t index = position + 1; index < mysqlCommand.length(); index++ ) {
+
+                if ( '\\' == mysqlCommand [index] && '`' != character ) {
+
+                    index++;
+
+                } else if ( character == mysqlCommand [index] ) {
+
+                    return index + 1;
+
+                }
+
+            }
+
+            return mysqlCommand.length();
+
+        }
+
+        if ( 0 == mysqlCommand.compare( position, 2, "/*" ) ) {
+
+            const size_t commentEnd = mysqlCommand.find( "*/", position + 2 );
+            return std::string_view::npos == commentEnd ? mysqlCommand.length() : commentEnd + 2;
+
+        }
+
+        // -- is only a comment if a blank follows - 1--1 is an expression.
+        if ( '#' == character || ( 0 == mysqlCommand.compare( position, 2, "--" ) &&
+                                   ( position + 2 == mysqlCommand.length() || std::isspace( static_cast<unsigned char>( mysqlCommand [position + 2] ) ) ) ) ) {
+
+            const size_t lineEnd = mysqlCommand.find( '\n', position );
+            return std::string_view::npos == lineEnd ? mysqlCommand.length() : lineEnd + 1;
+
+        }
+
+        return position;
+
+    }
+
+    auto isWordCharacter( char character ) -> bool
+    {
+
+        return std::isalnum( static_cast<unsigned char>( character ) ) || '_' == character || '$' == character;
+
+    }
+
+    /**
+     * Returns the position after the name which starts at <position> - words, quoted identifiers and the dots
+     * of a qualified name like `db`.t - or <position> if there is none.
+     *
+     * @param mysqlCommand
+     * @param position
+     * @return
+     */
+    auto skipName( std::string_view mysqlCommand, size_t position ) -> size_t
+    {
+
+        while ( position < mysqlCommand.length() ) {
+
+            if ( '`' == mysqlCommand [position] ) {
+
+                position = skipQuoted( mysqlCommand, position );
+
+            } else if ( isWordCharacter( mysqlCommand [position] ) || '.' == mysqlCommand [position] ) {
+
+                position++;
+
+            } else {
+
+                break;
+
+            }
+
+        }
+
+        return position;
+
+    }
+
+    /**
+     * True if <word> is the upper case <keyword> - case-insensitive.
+     *
+     * @param word
+     * @param keyword
+     * @return
+     */
+    auto isKeyword( std::string_view word, std::string_view keyword ) -> bool
+    {
+
+        if ( word.length() != keyword.length() ) {
+
+            return false;
+
+        }
+
+        for ( size_t index = 0; index < keyword.length(); index++ ) {
+
+            if ( std::toupper( static_cast<unsigned char>( word [index] ) ) != keyword [index] ) {
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    // The words of INSERT and REPLACE in front of the table name.
+    auto isInsertKeyword( std::string_view word ) -> bool
+    {
+
+        for ( const std::string_view keyword : { "INSERT", "REPLACE", "INTO", "IGNORE", "LOW_PRIORITY", "DELAYED", "HIGH_PRIORITY" } ) {
+
+            if ( isKeyword( word, keyword ) ) {
+
+                return true;
+
+            }
+
+        }
+
+        return false;
+
+    }
+
+    /**
+     * True if orderKey() holds the whole value - the numbers and the temporal values.
+     *
+     * @param bufferType
+     * @return
+     */
+    auto isOrderedByKey( enum_field_types bufferType ) -> bool
+    {
+
+        switch ( bufferType ) {
+
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_YEAR:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONGLONG:
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE:
+            case MYSQL_TYPE_TIME:
+            case MYSQL_TYPE_DATE:
+            case MYSQL_TYPE_DATETIME:
+            case MYSQL_TYPE_TIMESTAMP:  return true;
+            default:                    return false;
+
+        }
+
+    }
+
+    /**
+     * An unsigned number in the order of the value - unsigned numbers are compared as they are, for the signed
+     * numbers the sign bit is flipped. Strings and other byte values are represented by their first 8 bytes.
+     * NULL is 0.
+     *
+     * @param mysqlBindItem
+     * @return
+     */
+    auto orderKey( const MYSQL_BIND & mysqlBindItem ) -> uint64_t
+    {
+
+        if ( FaF::BoundRow::isNullValue( mysqlBindItem ) ) {
+
+            return 0;
+
+        }
+
+        constexpr uint64_t signBit { uint64_t { 1 } << 63 };
+
+        const auto integerKey = [&mysqlBindItem]( auto value ) -> uint64_t
+        {
+
+            std::memcpy( &value, mysqlBindItem.buffer, sizeof( value ) );
+
+            return mysqlBindItem.is_unsigned ? static_cast<uint64_t>( static_cast<std::make_unsigned_t<decltype( value )>>( value ) ) :
+                                               static_cast<uint64_t>( static_cast<int64_t>( value ) ) ^ signBit;
+
+        };
+
+        const auto floatingKey = []( double value ) -> uint64_t
+        {
+
+            uint64_t bits {};
+            std::memcpy( &bits, &value, sizeof( bits ) );
+
+            return 0 != ( bits & signBit ) ? ~bits : bits | signBit;
+
+        };
+
+        switch ( mysqlBindItem.buffer_type ) {
+
+            case MYSQL_TYPE_TINY:       return integerKey( int8_t  {} );
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_YEAR:       return integerKey( int16_t {} );
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_INT24:      return integerKey( int32_t {} );
+            case MYSQL_TYPE_LONGLONG:   return integerKey( int64_t {} );
+
+            case MYSQL_TYPE_FLOAT: {
+
+                float value {};
+                std::memcpy( &value, mysqlBindItem.buffer, sizeof( value ) );
+                return floatingKey( value );
+
+            }
+
+            case MYSQL_TYPE_DOUBLE: {
+
+                double value {};
+                std::memcpy( &value, mysqlBindItem.buffer, sizeof( value ) );
+                return floatingKey( value );
+
+            }
+
+            case MYSQL_TYPE_TIME:
+            case MYSQL_TYPE_DATE:
+            case MYSQL_TYPE_DATETIME:
+            case MYSQL_TYPE_TIMESTAMP: {
+
+                MYSQL_TIME mysqlTime {};
+                std::memcpy( &mysqlTime, mysqlBindItem.buffer, sizeof( mysqlTime ) );
+
+                // Mixed radix - even the year 9999 with 838 hours fits into 64 bits.
+                const uint64_t timeValue =
+                    ( ( ( ( ( uint64_t { mysqlTime.year } * 13 + mysqlTime.month ) * 32 + mysqlTime.day ) * 839 + mysqlTime.hour ) * 60 +
+                        mysqlTime.minute ) * 60 + mysqlTime.second ) * 1000000 + mysqlTime.second_part;
+
+                if ( MYSQL_TYPE_TIME == mysqlBindItem.buffer_type ) {
+
+                    return mysqlTime.neg ? signBit - timeValue : signBit + timeValue;
+
+                }
+
+                return timeValue;
+
+            }
+
+            default: {
+
+                const size_t valueLength = FaF::BoundRow::valueLength( mysqlBindItem );
+                const auto * valueBytes  = static_cast<const unsigned char *>( mysqlBindItem.buffer );
+
+                uint64_t keyPrefix {};
+                for ( size_t index = 0; index < sizeof( keyPrefix ); index++ ) {
+
+                    keyPrefix = keyPrefix << 8 | ( index < valueLength ? valueBytes [index] : 0 );
+
+                }
+
+                return keyPrefix;
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Compares 2 values of the same bind variable - NULL is the lowest value, byte values are compared byte by byte.
+     *
+     * @param firstBindItem
+     * @param secondBindItem
+     * @return <0, 0 or >0 like memcmp().
+     */
+    auto compareValues( const MYSQL_BIND & firstBindItem, const MYSQL_BIND & secondBindItem ) -> int
+    {
+
+        const bool firstNull  = FaF::BoundRow::isNullValue( firstBindItem  );
+        const bool secondNull = FaF::BoundRow::isNullValue( secondBindItem );
+
+        if ( firstNull || secondNull ) {
+
+            return static_cast<int>( secondNull ) - static_cast<int>( firstNull );
+
+        }
+
+        const uint64_t firstKey  = orderKey( firstBindItem  );
+        const uint64_t secondKey = orderKey( secondBindItem );
+
+        if ( firstKey != secondKey || isOrderedByKey( firstBindItem.buffer_type ) ) {
+
+            return ( firstKey > secondKey ) - ( firstKey < secondKey );
+
+        }
+
+        const size_t firstLength  = FaF::BoundRow::valueLength( firstBindItem  );
+        const size_t secondLength = FaF::BoundRow::valueLength( secondBindItem );
+
+        const int bytesCompared = std::memcmp( firstBindItem.buffer, secondBindItem.buffer, std::min( firstLength, secondLength ) );
+        if ( 0 != bytesCompared ) {
+
+            return bytesCompared;
+
+        }
+
+        return ( firstLength > secondLength ) - ( firstLength < secondLength );
+
+    }
+
+    /**
+     * True if the next statement is a transaction of its own - autocommit is on and no transaction has been started.
+     *
+     * @param mysqlConnection
+     * @return
+     */
+    auto isOwnTransaction( const MYSQL * mysqlConnection ) -> bool
+    {
+
+        return 0 != ( SERVER_STATUS_AUTOCOMMIT & mysqlConnection->server_status ) &&
+               0 == ( SERVER_STATUS_IN_TRANS   & mysqlConnection->server_status );
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * Parses the MySQL command and splits it around the VALUES tuple. An exception is thrown if the command
+     * has no VALUES tuple or if bind variables are used outside of it - such a command cannot be repeated per row.
+     *
+     * @param mysqlConnection
+     * @param mysqlCommand
+     * @param maxRowsPerStatement
+     */
+    MySqlExtBindBatch::MySqlExtBindBatch( MYSQL * mysqlConnection, std::string_view mysqlCommand, u_int maxRowsPerStatement )
+    :
+        m_mysqlConnection    ( mysqlConnection ),
+        m_templateExtBind    ( nullptr, mysqlCommand ),
+        m_bindVariablesCount ( m_templateExtBind.bindVariablesCount() ),
+        m_maxRowsPerStatement( std::max( 1U, std::min( maxRowsPerStatement, g_maxPlaceholders / m_bindVariablesCount ) ) )
+    {
+
+        const std::optional<ValuesClause> valuesClause = findValuesClause( m_templateExtBind.adjustedMysqlCommand() );
+
+        if ( false == valuesClause.has_value() ) {
+
+            std::cerr
+                << "Exception #5: The MySQL command cannot be executed as multi-row statement. All bind variables must be in "
+                << "one VALUES (...) tuple." << std::endl
+                << "[" << mysqlCommand << "]" << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        m_prefix = valuesClause->prefix;
+        m_tuple  = valuesClause->tuple;
+        m_suffix = valuesClause->suffix;
+
+    }
+
+    MySqlExtBindBatch::~MySqlExtBindBatch()
+    {
+
+        for ( auto & [rowsCount, mysqlStatement] : m_statements ) {
+
+            // Avoid a warning which would be treated as an error.
+            (void) rowsCount;
+
+            mysql_stmt_close( mysqlStatement );
+
+        }
+
+    }
+
+    /**
+     * Looks for the VALUES or VALUE keyword and the following tuple outside of quotes and comments. The keyword only
+     * counts outside of parentheses, after the column list or directly after the table name - so a column called
+     * value isn't taken for it. Returns nothing if there is no tuple or if a <?> is outside of the tuple.
+     *
+     * @param adjustedMysqlCommand
+     * @return
+     */
+    auto MySqlExtBindBatch::findValuesClause( std::string_view adjustedMysqlCommand ) -> std::optional<ValuesClause>
+    {
+
+        size_t tupleBegin { std::string_view::npos };
+        size_t tupleEnd   { std::string_view::npos };
+        int    depth      {};
+
+        // The two names in front of the current position and if a ')' at depth 0 has been the last token.
+        std::string_view lastName;
+        std::string_view nameBefore;
+        bool             afterParenthesis {};
+
+        for ( size_t position = 0; position < adjustedMysqlCommand.length(); position++ ) {
+
+            const char character = adjustedMysqlCommand [position];
+
+            if ( std::string_view::npos == tupleBegin && ( '`' == character || isWordCharacter( character ) ) ) {
+
+                const size_t           nameEnd = skipName( adjustedMysqlCommand, position );
+                const std::string_view name    = adjustedMysqlCommand.substr( position, nameEnd - position );
+                const bool             isTable = false == lastName.empty() && false == isInsertKeyword( lastName ) && isInsertKeyword( nameBefore );
+
+                position = nameEnd - 1;
+
+                if ( 0 < depth || ( false == isKeyword( name, "VALUES" ) && false == isKeyword( name, "VALUE" ) ) ||
+                     ( false == afterParenthesis && false == isTable ) ) {
+
+                    nameBefore       = lastName;
+                    lastName         = name;
+                    afterParenthesis = false;
+                    continue;
+
+                }
+
+                position = nameEnd;
+                while ( position < adjustedMysqlCommand.length() && std::isspace( static_cast<unsigned char>( adjustedMysqlCommand [position] ) ) ) {
+
+                    position++;
+
+                }
+
+                if ( position == adjustedMysqlCommand.length() || '(' != adjustedMysqlCommand [position] ) {
+
+                    return std::nullopt;
+
+                }
+
+                tupleBegin = position;
+                depth      = 1;
+                continue;
+
+            }
+
+            const size_t skippedPosition = skipQuoted( adjustedMysqlCommand, position );
+            if ( skippedPosition != position ) {
+
+                position = skippedPosition - 1;
+                continue;
+
+            }
+
+            if ( std::string_view::npos == tupleBegin ) {
+
+                if ( '?' == character ) {
+
+                    return std::nullopt;
+
+                }
+
+                if ( std::isspace( static_cast<unsigned char>( character ) ) ) {
+
+                    continue;
+
+                }
+
+                depth            += ( '(' == character ) - ( ')' == character );
+                afterParenthesis  = ')' == character && 0 == depth;
+                lastName          = {};
+                nameBefore        = {};
+
+            } else if ( std::string_view::npos == tupleEnd ) {
+
+                depth += ( '(' == character ) - ( ')' == character );
+                if ( 0 == depth ) {
+
+                    tupleEnd = position + 1;
+
+                }
+
+            } else if ( '?' == character ) {
+
+                return std::nullopt;
+
+            }
+
+        }
+
+        if ( std::string_view::npos == tupleEnd ) {
+
+            return std::nullopt;
+
+        }
+
+        return ValuesClause {
+            adjustedMysqlCommand.substr( 0,          tupleBegin ),
+            adjustedMysqlCommand.substr( tupleBegin, tupleEnd - tupleBegin ),
+            adjustedMysqlCommand.substr( tupleEnd )
+        };
+
+    }
+
+    /**
+     * Captures the bound values of <boundExtBind> - it must have been constructed with the same MySQL command.
+     *
+     * @param boundExtBind
+     */
+    auto MySqlExtBindBatch::add( MySqlExtBind & boundExtBind ) -> void
+    {
+
+        add( boundExtBind.captureRow() );
+
+    }
+
+    auto MySqlExtBindBatch::add( BoundRow && boundRow ) -> void
+    {
+
+        checkRow( boundRow );
+        m_pendingRows.push_back( std::move( boundRow ) );
+
+    }
+
+    /**
+     * Throws an exception if <boundRow> does not have the bind variables count of the MySQL command.
+     *
+     * @param boundRow
+     */
+    auto MySqlExtBindBatch::checkRow( const BoundRow & boundRow ) const -> void
+    {
+
+        if ( boundRow.bindVariablesCount() != m_bindVariablesCount ) {
+
+            std::cerr
+                << "Exception #6: The row has " << boundRow.bindVariablesCount() << " bind variables, but the MySQL command has "
+                << m_bindVariablesCount << "." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+    }
+
+    /**
+     * The pending rows are executed in the order of the values of <keyVariables> - the first one is compared first.
+     * An empty vector restores the order of add(). Throws exception #3 if a bind variable is not used in the command.
+     *
+     * @param keyVariables
+     */
+    auto MySqlExtBindBatch::orderByKey( const std::vector<std::string> & keyVariables ) -> void
+    {
+
+        std::vector<u_int> keyPositions;
+        for ( const std::string & keyVariable : keyVariables ) {
+
+            keyPositions.push_back( m_templateExtBind.bindPosition( keyVariable ) );
+
+        }
+
+        m_keyPositions = std::move( keyPositions );
+
+    }
+
+    /**
+     * Executes all pending rows. Returns the MySQL error code for each row in the order of add() - 0 if it has
+     * been inserted. A failed statement fails all its rows - with bisectLockErrors() a lock wait timeout, or a deadlock
+     * in autocommit mode, only fails the rows which still fail in a statement of their own. The pending rows are
+     * removed in any case.
+     *
+     * @return
+     */
+    auto MySqlExtBindBatch::execute() -> std::vector<unsigned int>
+    {
+
+        std::vector<unsigned int> errorCodes( m_pendingRows.size() );
+
+        orderRows();
+        executeRange( 0, m_pendingRows.size(), errorCodes );
+
+        m_pendingRows.clear();
+
+        return errorCodes;
+
+    }
+
+    /**
+     * Sets m_rowOrder. Only the SortEntry items are moved while sorting - the rows are read for equal key prefixes only.
+     * Equal keys keep the order of add(), so the result is the same for the same rows.
+     */
+    auto MySqlExtBindBatch::orderRows() -> void
+    {
+
+        m_rowOrder.resize( m_pendingRows.size() );
+
+        if ( m_keyPositions.empty() ) {
+
+            std::iota( m_rowOrder.begin(), m_rowOrder.end(), size_t {} );
+            return;
+
+        }
+
+        const u_int firstKeyPosition = m_keyPositions.front();
+
+        m_sortEntries.clear();
+        for ( size_t rowIndex = 0; rowIndex < m_pendingRows.size(); rowIndex++ ) {
+
+            m_sortEntries.push_back( { orderKey( m_pendingRows [rowIndex].bindArray() [firstKeyPosition] ), rowIndex } );
+
+        }
+
+        std::sort( m_sortEntries.begin(), m_sortEntries.end(), [this]( const SortEntry & firstEntry, const SortEntry & secondEntry )
+        {
+
+            if ( firstEntry.keyPrefix != secondEntry.keyPrefix ) {
+
+                return firstEntry.keyPrefix < secondEntry.keyPrefix;
+
+            }
+
+            const int keysCompared = compareKeys( firstEntry.rowIndex, secondEntry.rowIndex );
+
+            return 0 != keysCompared ? keysCompared < 0 : firstEntry.rowIndex < secondEntry.rowIndex;
+
+        } );
+
+        std::transform( m_sortEntries.begin(), m_sortEntries.end(), m_rowOrder.begin(), []( const SortEntry & sortEntry )
+        {
+
+            return sortEntry.rowIndex;
+
+        } );
+
+    }
+
+    auto MySqlExtBindBatch::compareKeys( size_t firstRow, size_t secondRow ) const -> int
+    {
+
+        const MYSQL_BIND * firstBindArray  = m_pendingRows [firstRow ].bindArray();
+        const MYSQL_BIND * secondBindArray = m_pendingRows [secondRow].bindArray();
+
+        for ( const u_int keyPosition : m_keyPositions ) {
+
+            const int valuesCompared = compareValues( firstBindArray [keyPosition], secondBindArray [keyPosition] );
+            if ( 0 != valuesCompared ) {
+
+                return valuesCompared;
+
+            }
+
+        }
+
+        return 0;
+
+    }
+
+    /**
+     * Executes <rowsCount> rows of m_rowOrder starting at <firstRow> and sets their error codes.
+     *
+     * @param firstRow
+     * @param rowsCount
+     * @param errorCodes
+     */
+    auto MySqlExtBindBatch::executeRange( size_t firstRow, size_t rowsCount, std::vector<unsigned int> & errorCodes ) -> void
+    {
+
+        const size_t lastRow = firstRow + rowsCount;
+
+        while ( firstRow < lastRow ) {
+
+            const size_t remainingRows  = lastRow - firstRow;
+            u_int        statementRows  = m_maxRowsPerStatement;
+
+            if ( remainingRows < m_maxRowsPerStatement ) {
+
+                // The largest power of 2 which fits.
+                statementRows = 1;
+                while ( statementRows * 2 <= remainingRows ) {
+
+                    statementRows *= 2;
+
+                }
+
+            }
+
+            const bool         ownTransaction = isOwnTransaction( m_mysqlConnection );
+            const unsigned int errorCode      = executeRows( firstRow, statementRows );
+
+            // A lock wait timeout rolls back the statement, a deadlock the whole transaction - that is only the
+            // statement if it ran in autocommit mode. Then its halves are executed on their own.
+            if ( m_bisectLockErrors && 1 < statementRows &&
+                 ( ER_LOCK_WAIT_TIMEOUT == errorCode || ( ER_LOCK_DEADLOCK == errorCode && ownTransaction ) ) ) {
+
+                executeRange( firstRow,                     statementRows / 2,                 errorCodes );
+                executeRange( firstRow + statementRows / 2, statementRows - statementRows / 2, errorCodes );
+
+            } else {
+
+                for ( size_t rowIndex = firstRow; rowIndex < firstRow + statementRows; rowIndex++ ) {
+
+                    errorCodes [m_rowOrder [rowIndex]] = errorCode;
+
+                }
+
+            }
+
+            firstRow += statementRows;
+
+        }
+
+    }
+
+    /**
+     * Binds <rowsCount> rows of m_rowOrder starting at <firstRow> to the cached statement and executes it.
+     *
+     * @param firstRow
+     * @param rowsCount
+     * @return The MySQL error code.
+     */
+    auto MySqlExtBindBatch::executeRows( size_t firstRow, u_int rowsCount ) -> unsigned int
+    {
+
+        unsigned int errorCode      {};
+        MYSQL_STMT * mysqlStatement = statement( rowsCount, errorCode );
+        if ( nullptr == mysqlStatement ) {
+
+            return errorCode;
+
+        }
+
+        m_bindArray.clear();
+        for ( size_t rowIndex = firstRow; rowIndex < firstRow + rowsCount; rowIndex++ ) {
+
+            const BoundRow & boundRow = m_pendingRows [m_rowOrder [rowIndex]];
+            m_bindArray.insert( m_bindArray.end(), boundRow.bindArray(), boundRow.bindArray() + m_bindVariablesCount );
+
+        }
+        m_bindNamesArray.assign( m_bindArray.size(), nullptr );
+
+        if ( mysql_stmt_bind_named_param( mysqlStatement, m_bindArray.data(), static_cast<unsigned>( m_bindArray.size() ), m_bindNamesArray.data() ) ||
+             0 != mysql_stmt_execute( mysqlStatement ) ) {
+
+            return mysql_stmt_errno( mysqlStatement );
+
+        }
+
+        return 0;
+
+    }
+
+    /**
+     * Returns the prepared statement for <rowsCount> rows - it's prepared on first use.
+     * Returns nullptr if it cannot be prepared - <errorCode> has the reason. It's taken from the statement before
+     * mysql_stmt_close(), which clears the error of the connection.
+     *
+     * @param rowsCount
+     * @param errorCode Set if nullptr is returned - never 0.
+     * @return
+     */
+    auto MySqlExtBindBatch::statement( u_int rowsCount, unsigned int & errorCode ) -> MYSQL_STMT *
+    {
+
+        if ( auto foundStatement = m_statements.find( rowsCount ); m_statements.end() != foundStatement ) {
+
+            return foundStatement->second;
+
+        }
+
+        std::string mysqlCommand;
+        mysqlCommand.reserve( m_prefix.length() + rowsCount * ( m_tuple.length() + 2 ) + m_suffix.length() );
+
+        mysqlCommand += m_prefix;
+        for ( u_int rowIndex = 0; rowIndex < rowsCount; rowIndex++ ) {
+
+            mysqlCommand += ( 0 == rowIndex ? "" : ", " );
+            mysqlCommand += m_tuple;
+
+        }
+        mysqlCommand += m_suffix;
+
+        MYSQL_STMT * mysqlStatement = mysql_stmt_init( m_mysqlConnection );
+        if ( nullptr == mysqlStatement ) {
+
+            errorCode = CR_OUT_OF_MEMORY;
+            return nullptr;
+
+        }
+
+        if ( 0 != mysql_stmt_prepare( mysqlStatement, mysqlCommand.c_str(), mysqlCommand.length() ) ) {
+
+            errorCode = mysql_stmt_errno( mysqlStatement );
+            errorCode = 0 == errorCode ? CR_UNKNOWN_ERROR : errorCode;
+
+            mysql_stmt_close( mysqlStatement );
+            return nullptr;
+
+        }
+
+        m_statements.emplace( rowsCount, mysqlStatement );
+
+        return mysqlStatement;
+
+    }
+
+}
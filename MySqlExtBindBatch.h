@@ -0,0 +1,117 @@
+/**
+ * MySqlExtBindBatch.h
+ *
+ * Header for the MySqlExtBindBatch class - executes many rows of an INSERT ... VALUES (...) command
+ * as multi-row statements.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_BATCH_H
+#define FAF_MYSQL_EXT_BIND_BATCH_H
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "MySqlExtBind.h"
+
+namespace FaF
+{
+
+    /**
+     * The parts of an adjusted MySQL command around the VALUES tuple:
+     *   INSERT INTO foo (a, b) VALUES (?, ?) ON DUPLICATE KEY UPDATE b = VALUES(b)
+     *   |------------ prefix ---------|tuple-|---------------- suffix --------------|
+     */
+    using ValuesClause = struct ValuesClause
+    {
+
+            std::string_view prefix;
+            std::string_view tuple;
+            std::string_view suffix;
+
+    };
+
+    class MySqlExtBindBatch
+    {
+
+        public:
+
+            MySqlExtBindBatch( MYSQL * mysqlConnection, std::string_view mysqlCommand, u_int maxRowsPerStatement = 1000 );
+            ~MySqlExtBindBatch();
+
+            MySqlExtBindBatch( const MySqlExtBindBatch & )             = delete;
+            MySqlExtBindBatch & operator=( const MySqlExtBindBatch & ) = delete;
+
+            auto add( MySqlExtBind & boundExtBind ) -> void;
+            auto add( BoundRow && boundRow )        -> void;
+            auto checkRow( const BoundRow & boundRow ) const -> void;
+            auto pendingRows() const                -> size_t { return m_pendingRows.size(); }
+            auto execute()                          -> std::vector<unsigned int>;
+
+            auto orderByKey( const std::vector<std::string> & keyVariables ) -> void;
+            auto bisectLockErrors( bool bisect )    -> void { m_bisectLockErrors = bisect; }
+
+            static auto findValuesClause( std::string_view adjustedMysqlCommand ) -> std::optional<ValuesClause>;
+
+        private:
+
+            /**
+             * A pending row in the sort by the key - the first 8 bytes of the key are compared without touching the row.
+             */
+            using SortEntry = struct SortEntry
+            {
+
+                    uint64_t        keyPrefix;
+                    size_t          rowIndex;
+
+            };
+
+            auto statement( u_int rowsCount, unsigned int & errorCode ) -> MYSQL_STMT *;
+            auto orderRows()                                      -> void;
+            auto compareKeys( size_t firstRow, size_t secondRow ) const -> int;
+            auto executeRange( size_t firstRow, size_t rowsCount, std::vector<unsigned int> & errorCodes ) -> void;
+            auto executeRows( size_t firstRow, u_int rowsCount )  -> unsigned int;
+
+            // constructor initialiser list - respect the order.
+
+                MYSQL *             m_mysqlConnection;
+                // Only used to parse the MySQL command.
+                MySqlExtBind        m_templateExtBind;
+                u_int               m_bindVariablesCount;
+                u_int               m_maxRowsPerStatement;
+
+            std::string             m_prefix;
+            std::string             m_tuple;
+            std::string             m_suffix;
+
+            std::vector<BoundRow>   m_pendingRows;
+
+            // The positions of the key bind variables - the rows are executed in the order of their values.
+            std::vector<u_int>      m_keyPositions;
+            // A statement failed by a deadlock or a lock wait timeout is executed again in halves.
+            bool                    m_bisectLockErrors {};
+
+            // The indexes in m_pendingRows in the order of execution.
+            std::vector<size_t>     m_rowOrder;
+            std::vector<SortEntry>  m_sortEntries;
+
+            // The prepared statements per rows count - full statements and the powers of 2 for the rest.
+            std::map<u_int, MYSQL_STMT *> m_statements;
+
+            // Reused for each execution.
+            std::vector<MYSQL_BIND>   m_bindArray;
+            std::vector<const char *> m_bindNamesArray;
+
+    };
+
+}
+
+#endif
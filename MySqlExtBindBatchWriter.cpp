@@ -0,0 +1,159 @@
+/**
+ * MySqlExtBindBatchWriter.cpp
+ *
+ * The producers capture the bound values and push them into a lock-free queue - they never wait for the server.
+ * The writer thread drains the queue into a MySqlExtBindBatch and executes it when it's full or old enough.
+ * In between it sleeps until the next row is pushed or the oldest row is due - see MpscWaitQueue.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindBatchWriter.h"
+
+namespace FaF
+{
+
+    /**
+     * The connection is used by the writer thread only - it must not be used elsewhere until the writer is destroyed.
+     *
+     * @param mysqlConnection
+     * @param mysqlCommand
+     * @param batchWriterOptions
+     */
+    MySqlExtBindBatchWriter::MySqlExtBindBatchWriter( MYSQL * mysqlConnection, std::string_view mysqlCommand,
+                                                      const BatchWriterOptions & batchWriterOptions )
+    :
+        m_batchWriterOptions( batchWriterOptions ),
+        m_batch             ( mysqlConnection, mysqlCommand, batchWriterOptions.maxBatchRows ),
+        m_queue             ( batchWriterOptions.queueCapacity )
+    {
+
+        m_batch.orderByKey( m_batchWriterOptions.orderKeyVariables );
+        m_batch.bisectLockErrors( m_batchWriterOptions.bisectLockErrors );
+
+        m_completions.reserve( m_batchWriterOptions.maxBatchRows );
+        m_writerThread = std::thread( &MySqlExtBindBatchWriter::run, this );
+
+    }
+
+    /**
+     * All submitted rows are written before the writer thread ends.
+     */
+    MySqlExtBindBatchWriter::~MySqlExtBindBatchWriter()
+    {
+
+        m_stop.store( true, std::memory_order_release );
+        m_queue.wake();
+        m_writerThread.join();
+
+    }
+
+    /**
+     * Copies the bound values of <boundExtBind> - the caller can reuse its buffers as soon as the function returns.
+     * The future gets the MySQL error code of the row - 0 if it has been inserted.
+     * Blocks while the queue is full.
+     *
+     * @param boundExtBind
+     * @return
+     */
+    auto MySqlExtBindBatchWriter::submit( MySqlExtBind & boundExtBind ) -> std::future<unsigned int>
+    {
+
+        Entry entry { boundExtBind.captureRow(), std::promise<unsigned int> {} };
+        // Checked here, so the writer thread cannot fail.
+        m_batch.checkRow( entry.row );
+
+        std::future<unsigned int> completion = entry.completion->get_future();
+
+        m_queue.push( std::move( entry ) );
+
+        return completion;
+
+    }
+
+    auto MySqlExtBindBatchWriter::run() -> void
+    {
+
+        std::chrono::steady_clock::time_point oldestRow;
+        Entry entry;
+
+        while ( true ) {
+
+            // Read both before draining - rows pushed before the destructor was called are then always seen,
+            // and a row pushed while draining ends the wait immediately.
+            const size_t observed = m_queue.observe();
+            const bool   stop     = m_stop.load( std::memory_order_acquire );
+            const size_t drained  = m_completions.size();
+
+            while ( m_batch.pendingRows() < m_batchWriterOptions.maxBatchRows && m_queue.tryPop( entry ) ) {
+
+                if ( 0 == m_batch.pendingRows() ) {
+
+                    oldestRow = std::chrono::steady_clock::now();
+
+                }
+
+                m_batch.add( std::move( entry.row ) );
+                m_completions.push_back( std::move( *entry.completion ) );
+
+            }
+
+            if ( drained < m_completions.size() ) {
+
+                m_queue.popped();
+
+            }
+
+            const bool full = m_batch.pendingRows() >= m_batchWriterOptions.maxBatchRows;
+
+            if ( full || ( 0 < m_batch.pendingRows() && ( stop || std::chrono::steady_clock::now() - oldestRow >= m_batchWriterOptions.flushInterval ) ) ) {
+
+                flush();
+
+            }
+
+            if ( full ) {
+
+                continue;
+
+            }
+
+            if ( stop && 0 == m_batch.pendingRows() ) {
+
+                break;
+
+            }
+
+            if ( 0 == m_batch.pendingRows() ) {
+
+                m_queue.wait( observed );
+
+            } else {
+
+                m_queue.waitUntil( observed, oldestRow + m_batchWriterOptions.flushInterval );
+
+            }
+
+        }
+
+    }
+
+    auto MySqlExtBindBatchWriter::flush() -> void
+    {
+
+        const std::vector<unsigned int> errorCodes = m_batch.execute();
+
+        for ( size_t rowIndex = 0; rowIndex < errorCodes.size(); rowIndex++ ) {
+
+            m_completions [rowIndex].set_value( errorCodes [rowIndex] );
+
+        }
+
+        m_completions.clear();
+
+    }
+
+}
@@ -0,0 +1,90 @@
+/**
+ * MySqlExtBindBatchWriter.h
+ *
+ * Header for the MySqlExtBindBatchWriter class - a background thread which collects the rows submitted by
+ * any number of threads and writes them with MySqlExtBindBatch.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_BATCH_WRITER_H
+#define FAF_MYSQL_EXT_BIND_BATCH_WRITER_H
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "MySqlExtBindBatch.h"
+#include "MySqlExtBindQueue.h"
+
+namespace FaF
+{
+
+    /**
+     * A batch is written when it has <maxBatchRows> rows or when its oldest row has waited <flushInterval>.
+     * Submitting blocks while <queueCapacity> rows are waiting.
+     * See MySqlExtBindBatch::orderByKey() and MySqlExtBindBatch::bisectLockErrors() for the other options.
+     */
+    using BatchWriterOptions = struct BatchWriterOptions
+    {
+
+            u_int                       maxBatchRows  { 1000 };
+            std::chrono::microseconds   flushInterval { 1000 };
+            size_t                      queueCapacity { 65536 };
+            std::vector<std::string>    orderKeyVariables;
+            bool                        bisectLockErrors {};
+
+    };
+
+    class MySqlExtBindBatchWriter
+    {
+
+        public:
+
+            MySqlExtBindBatchWriter( MYSQL * mysqlConnection, std::string_view mysqlCommand,
+                                     const BatchWriterOptions & batchWriterOptions = BatchWriterOptions {} );
+            ~MySqlExtBindBatchWriter();
+
+            MySqlExtBindBatchWriter( const MySqlExtBindBatchWriter & )             = delete;
+            MySqlExtBindBatchWriter & operator=( const MySqlExtBindBatchWriter & ) = delete;
+
+            auto submit( MySqlExtBind & boundExtBind ) -> std::future<unsigned int>;
+
+        private:
+
+            using Entry = struct Entry
+            {
+
+                    BoundRow                    row;
+                    // Engaged by submit() - a queue cell doesn't allocate the shared state of a promise up front.
+                    std::optional<std::promise<unsigned int>> completion;
+
+            };
+
+            auto run()   -> void;
+            auto flush() -> void;
+
+            // constructor initialiser list - respect the order.
+
+                BatchWriterOptions          m_batchWriterOptions;
+                MySqlExtBindBatch           m_batch;
+                MpscWaitQueue<Entry>        m_queue;
+
+            // The completions of the rows in <m_batch>.
+            std::vector<std::promise<unsigned int>> m_completions;
+
+            std::atomic<bool>           m_stop {};
+            std::thread                 m_writerThread;
+
+    };
+
+}
+
+#endif
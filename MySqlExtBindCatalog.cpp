@@ -0,0 +1,407 @@
+/**
+ * MySqlExtBindCatalog.cpp
+ *
+ * A catalog file has named entries - each one starts with a comment line with its name, followed by the command:
+ *
+ *   -- name: findCustomer
+ *   SELECT * FROM customers
+ *    WHERE id = :id
+ *
+ * The command ends before the next name line or at the end of the file. Leading and trailing blanks and a final
+ * ';' are removed. Text before the first name line is ignored. The names must be unique in all files of a catalog.
+ *
+ * The files are mapped into memory and stay mapped as long as the catalog exists - the commands are not copied.
+ * The entries of all files are parsed in parallel: each thread takes the next entry which hasn't been parsed yet.
+ * An entry without bind variables - SELECT NOW() - is taken as it is instead of being parsed.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindCatalog.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+
+    constexpr std::string_view g_namePrefix { "-- name:" };
+    constexpr std::string_view g_blanks     { " \t\r\n" };
+
+    auto trim( std::string_view text ) -> std::string_view
+    {
+
+        const size_t first = text.find_first_not_of( g_blanks );
+
+        if ( std::string_view::npos == first ) {
+
+            return {};
+
+        }
+
+        return text.substr( first, text.find_last_not_of( g_blanks ) - first + 1 );
+
+    }
+
+}
+
+namespace FaF
+{
+
+    MySqlExtBindCatalog::~MySqlExtBindCatalog()
+    {
+
+        // The parsed statements don't reference the mapped files, but the names and commands do.
+        m_entryIndexes.clear();
+        m_entries.clear();
+
+        for ( const MappedFile & mappedFile : m_mappedFiles ) {
+
+            munmap( const_cast<char *>( mappedFile.address ), mappedFile.length );
+
+        }
+
+    }
+
+    /**
+     * Adds the entries of the files and parses them in parallel - see the description at the top.
+     * Throws exception #12 if a file cannot be read or has a bad entry. A command which cannot be parsed throws
+     * the exception of the MySqlExtBind constructor. The catalog is unchanged after an exception.
+     * Don't look up statements while load() is running.
+     *
+     * @param catalogPaths
+     * @param threadsCount The number of parsing threads - 0 uses one thread per core.
+     */
+    auto MySqlExtBindCatalog::load( const std::vector<std::string> & catalogPaths, u_int threadsCount ) -> void
+    {
+
+        const size_t firstEntry      = m_entries.size();
+        const size_t firstMappedFile = m_mappedFiles.size();
+
+        try {
+
+            for ( const std::string & catalogPath : catalogPaths ) {
+
+                m_mappedFiles.push_back( mapFile( catalogPath ) );
+                splitEntries( m_mappedFiles.back() );
+
+            }
+
+            parseEntries( firstEntry, 0 != threadsCount ? threadsCount : std::max( 1U, std::thread::hardware_concurrency() ) );
+
+        } catch ( ... ) {
+
+            for ( size_t index = firstEntry; index < m_entries.size(); index++ ) {
+
+                m_entryIndexes.erase( m_entries [index].entryName );
+
+            }
+            m_entries.resize( firstEntry );
+
+            for ( size_t index = firstMappedFile; index < m_mappedFiles.size(); index++ ) {
+
+                munmap( const_cast<char *>( m_mappedFiles [index].address ), m_mappedFiles [index].length );
+
+            }
+            m_mappedFiles.resize( firstMappedFile );
+
+            throw;
+
+        }
+
+    }
+
+    auto MySqlExtBindCatalog::contains( std::string_view entryName ) const -> bool
+    {
+
+        return m_entryIndexes.end() != m_entryIndexes.find( entryName );
+
+    }
+
+    /**
+     * The names of all entries in the order of the files.
+     *
+     * @return
+     */
+    auto MySqlExtBindCatalog::entryNames() const -> std::vector<std::string_view>
+    {
+
+        std::vector<std::string_view> entryNames;
+        entryNames.reserve( m_entries.size() );
+
+        for ( const Entry & catalogEntry : m_entries ) {
+
+            entryNames.push_back( catalogEntry.entryName );
+
+        }
+
+        return entryNames;
+
+    }
+
+    /**
+     * The command of the entry as it's written in the file. Throws exception #13 if there is no entry with this name.
+     *
+     * @param entryName
+     * @return
+     */
+    auto MySqlExtBindCatalog::command( std::string_view entryName ) const -> std::string_view
+    {
+
+        return entry( entryName ).mysqlCommand;
+
+    }
+
+    /**
+     * The parsed command - it has no MYSQL_STMT and must not be executed. Use statement() to execute it.
+     *
+     * @param entryName
+     * @return
+     */
+    auto MySqlExtBindCatalog::parsed( std::string_view entryName ) const -> const MySqlExtBind &
+    {
+
+        return *entry( entryName ).parsedExtBind;
+
+    }
+
+    /**
+     * A copy of the parsed command for the statement - nothing is parsed again. The statement isn't prepared.
+     *
+     * @param entryName
+     * @param mysqlStatement
+     * @return
+     */
+    auto MySqlExtBindCatalog::statement( std::string_view entryName, MYSQL_STMT * mysqlStatement ) const -> MySqlExtBind
+    {
+
+        MySqlExtBind fafExtBind( parsed( entryName ) );
+        fafExtBind.replaceStatement( mysqlStatement );
+
+        return fafExtBind;
+
+    }
+
+    /**
+     * Registers the parsed command in the statement cache - see MySqlExtBindStatementCache::statement().
+     *
+     * @param entryName
+     * @param statementCache
+     * @return
+     */
+    auto MySqlExtBindCatalog::statement( std::string_view entryName, MySqlExtBindStatementCache & statementCache ) const -> MySqlExtBind &
+    {
+
+        const Entry & foundEntry = entry( entryName );
+
+        return statementCache.statement( foundEntry.mysqlCommand, *foundEntry.parsedExtBind );
+
+    }
+
+    /**
+     * Maps the whole file read-only into memory.
+     *
+     * @param catalogPath
+     * @return
+     */
+    auto MySqlExtBindCatalog::mapFile( const std::string & catalogPath ) -> MappedFile
+    {
+
+        const int fileDescriptor = open( catalogPath.c_str(), O_RDONLY | O_CLOEXEC );
+        if ( 0 > fileDescriptor ) {
+
+            throwCatalogException( "cannot open " + catalogPath );
+
+        }
+
+        struct stat fileStatus {};
+        MappedFile  mappedFile;
+
+        if ( 0 == fstat( fileDescriptor, &fileStatus ) && 0 < fileStatus.st_size ) {
+
+            mappedFile.length = static_cast<size_t>( fileStatus.st_size );
+
+            void * address = mmap( nullptr, mappedFile.length, PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+            mappedFile.address = MAP_FAILED != address ? static_cast<const char *>( address ) : nullptr;
+
+        }
+
+        close( fileDescriptor );
+
+        if ( nullptr == mappedFile.address ) {
+
+            throwCatalogException( "cannot map " + catalogPath + " - it must not be empty" );
+
+        }
+
+        return mappedFile;
+
+    }
+
+    /**
+     * Adds the named entries of the file - they are parsed later.
+     *
+     * @param mappedFile
+     */
+    auto MySqlExtBindCatalog::splitEntries( const MappedFile & mappedFile ) -> void
+    {
+
+        const std::string_view fileContent( mappedFile.address, mappedFile.length );
+
+        Entry * currentEntry  {};
+        size_t  commandStart  {};
+
+        const auto finishEntry = [&currentEntry, &commandStart, &fileContent]( size_t commandEnd ) {
+
+            if ( nullptr == currentEntry ) {
+
+                return;
+
+            }
+
+            std::string_view mysqlCommand = trim( fileContent.substr( commandStart, commandEnd - commandStart ) );
+            if ( false == mysqlCommand.empty() && ';' == mysqlCommand.back() ) {
+
+                mysqlCommand = trim( mysqlCommand.substr( 0, mysqlCommand.length() - 1 ) );
+
+            }
+
+            if ( mysqlCommand.empty() ) {
+
+                throwCatalogException( "the entry '" + std::string( currentEntry->entryName ) + "' has no command" );
+
+            }
+
+            currentEntry->mysqlCommand = mysqlCommand;
+
+        };
+
+        for ( size_t lineStart = 0; lineStart < fileContent.length(); ) {
+
+            const size_t lineEnd = std::min( fileContent.find( '\n', lineStart ), fileContent.length() );
+            const std::string_view line = trim( fileContent.substr( lineStart, lineEnd - lineStart ) );
+
+            if ( 0 == line.compare( 0, g_namePrefix.length(), g_namePrefix ) ) {
+
+                finishEntry( lineStart );
+
+                const std::string_view entryName = trim( line.substr( g_namePrefix.length() ) );
+                if ( entryName.empty() || false == m_entryIndexes.emplace( entryName, m_entries.size() ).second ) {
+
+                    throwCatalogException( "the entry name '" + std::string( entryName ) + "' is empty or not unique" );
+
+                }
+
+                currentEntry = &m_entries.emplace_back( Entry { entryName, {}, {} } );
+                commandStart = lineEnd;
+
+            }
+
+            lineStart = lineEnd + 1;
+
+        }
+
+        finishEntry( fileContent.length() );
+
+    }
+
+    /**
+     * Parses the entries from <firstEntry> on with <threadsCount> threads. The first exception is thrown again.
+     *
+     * @param firstEntry
+     * @param threadsCount
+     */
+    auto MySqlExtBindCatalog::parseEntries( size_t firstEntry, u_int threadsCount ) -> void
+    {
+
+        std::atomic<size_t> nextEntry { firstEntry };
+        std::exception_ptr  firstException;
+        std::atomic<bool>   failed    {};
+
+        const auto parse = [this, &nextEntry, &firstException, &failed]() {
+
+            for ( size_t index = nextEntry++; index < m_entries.size() && false == failed.load( std::memory_order_relaxed ); index = nextEntry++ ) {
+
+                const std::string_view mysqlCommand = m_entries [index].mysqlCommand;
+
+                try {
+
+                    // Without bind variables the command is already the adjusted one.
+                    m_entries [index].parsedExtBind = MySqlExtBind::hasBindVariables( mysqlCommand )
+                                                    ? std::make_unique<MySqlExtBind>( nullptr, mysqlCommand )
+                                                    : std::make_unique<MySqlExtBind>( MySqlExtBind::fromAdjustedCommand( nullptr, mysqlCommand, {} ) );
+
+                } catch ( ... ) {
+
+                    if ( false == failed.exchange( true ) ) {
+
+                        firstException = std::current_exception();
+
+                    }
+
+                }
+
+            }
+
+        };
+
+        const size_t entriesCount = m_entries.size() - firstEntry;
+        std::vector<std::thread> parseThreads;
+
+        for ( u_int index = 1; index < threadsCount && index < entriesCount; index++ ) {
+
+            parseThreads.emplace_back( parse );
+
+        }
+
+        parse();
+
+        for ( std::thread & parseThread : parseThreads ) {
+
+            parseThread.join();
+
+        }
+
+        if ( failed ) {
+
+            std::rethrow_exception( firstException );
+
+        }
+
+    }
+
+    auto MySqlExtBindCatalog::entry( std::string_view entryName ) const -> const Entry &
+    {
+
+        const auto foundIndex = m_entryIndexes.find( entryName );
+
+        if ( m_entryIndexes.end() == foundIndex ) {
+
+            std::cerr << "Exception #13: The SQL catalog has no entry with the name '" << entryName << "'." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        return m_entries [foundIndex->second];
+
+    }
+
+    auto MySqlExtBindCatalog::throwCatalogException( std::string_view reason ) -> void
+    {
+
+        std::cerr << "Exception #12: The SQL catalog cannot be loaded - " << reason << "." << std::endl;
+        throw FaF::Exception();
+
+    }
+
+}
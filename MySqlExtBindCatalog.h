@@ -0,0 +1,85 @@
+/**
+ * MySqlExtBindCatalog.h
+ *
+ * Header for the MySqlExtBindCatalog class - the named SQL commands of .sql files, parsed once at startup,
+ * so the commands don't have to live in C++ string literals.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_CATALOG_H
+#define FAF_MYSQL_EXT_BIND_CATALOG_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MySqlExtBindStatementCache.h"
+
+namespace FaF
+{
+
+    class MySqlExtBindCatalog
+    {
+
+        public:
+
+            MySqlExtBindCatalog() = default;
+            ~MySqlExtBindCatalog();
+
+            MySqlExtBindCatalog( const MySqlExtBindCatalog & )             = delete;
+            MySqlExtBindCatalog & operator=( const MySqlExtBindCatalog & ) = delete;
+
+            auto load( const std::vector<std::string> & catalogPaths, u_int threadsCount = 0 ) -> void;
+
+            auto contains( std::string_view entryName ) const -> bool;
+            auto entryNames()                           const -> std::vector<std::string_view>;
+            auto command( std::string_view entryName )  const -> std::string_view;
+            auto parsed( std::string_view entryName )   const -> const MySqlExtBind &;
+
+            auto statement( std::string_view entryName, MYSQL_STMT * mysqlStatement ) const                     -> MySqlExtBind;
+            auto statement( std::string_view entryName, MySqlExtBindStatementCache & statementCache ) const    -> MySqlExtBind &;
+
+            auto size() const -> size_t { return m_entries.size(); }
+
+        private:
+
+            using MappedFile = struct MappedFile
+            {
+
+                    const char *                address {};
+                    size_t                      length  {};
+
+            };
+
+            using Entry = struct Entry
+            {
+
+                    std::string_view                entryName;
+                    // Points into the mapped file.
+                    std::string_view                mysqlCommand;
+                    std::unique_ptr<MySqlExtBind>   parsedExtBind;
+
+            };
+
+            auto mapFile( const std::string & catalogPath ) -> MappedFile;
+            auto splitEntries( const MappedFile & mappedFile ) -> void;
+            auto parseEntries( size_t firstEntry, u_int threadsCount ) -> void;
+            auto entry( std::string_view entryName ) const -> const Entry &;
+
+            [[noreturn]] static auto throwCatalogException( std::string_view reason ) -> void;
+
+            std::vector<MappedFile>                             m_mappedFiles;
+            std::vector<Entry>                                  m_entries;
+            std::unordered_map<std::string_view, size_t>        m_entryIndexes;
+
+    };
+
+}
+
+#endif
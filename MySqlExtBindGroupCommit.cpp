@@ -0,0 +1,392 @@
+/**
+ * MySqlExtBindGroupCommit.cpp
+ *
+ * The callers push their transactions into a lock-free queue. The committer thread collects them for a short
+ * window and executes the whole group between one START TRANSACTION and one COMMIT. In between it sleeps until
+ * the next transaction is pushed or the window has passed - see MpscWaitQueue.
+ * If a statement fails, the group is rolled back and each transaction is executed again in its own server
+ * transaction - so each caller gets the outcome of its own transaction. A failed COMMIT is not retried: after a lost
+ * connection the group may have been committed, so all callers get the error as it is.
+ * The prepared statements are shared by all groups. They are closed after a lost connection or when the server has
+ * invalidated them, and prepared again by their next use.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindGroupCommit.h"
+
+#include <errmsg.h>
+#include <mysqld_error.h>
+
+namespace FaF
+{
+
+    /**
+     * Captures the bound values of <boundExtBind> as the next statement of the transaction.
+     *
+     * @param boundExtBind
+     */
+    auto MySqlExtBindTransaction::add( MySqlExtBind & boundExtBind ) -> void
+    {
+
+        m_steps.push_back( Step { std::string( boundExtBind.adjustedMysqlCommand() ), boundExtBind.captureRow() } );
+
+    }
+
+    /**
+     * The connection is used by the committer thread only - it must not be used elsewhere until the instance is destroyed.
+     *
+     * @param mysqlConnection
+     * @param groupCommitOptions
+     */
+    MySqlExtBindGroupCommit::MySqlExtBindGroupCommit( MYSQL * mysqlConnection, const GroupCommitOptions & groupCommitOptions )
+    :
+        m_mysqlConnection   ( mysqlConnection ),
+        m_groupCommitOptions( groupCommitOptions ),
+        m_queue             ( groupCommitOptions.queueCapacity )
+    {
+
+        m_group.reserve( m_groupCommitOptions.maxTransactions );
+        m_committerThread = std::thread( &MySqlExtBindGroupCommit::run, this );
+
+    }
+
+    /**
+     * All transactions passed to commit() are executed before the committer thread ends.
+     */
+    MySqlExtBindGroupCommit::~MySqlExtBindGroupCommit()
+    {
+
+        m_stop.store( true, std::memory_order_release );
+        m_queue.wake();
+        m_committerThread.join();
+
+        for ( auto & [adjustedMysqlCommand, mysqlStatement] : m_statements ) {
+
+            // Avoid a warning which would be treated as an error.
+            (void) adjustedMysqlCommand;
+
+            mysql_stmt_close( mysqlStatement );
+
+        }
+
+    }
+
+    /**
+     * Hands the transaction over to the committer thread. The future gets the MySQL error code of the
+     * transaction - 0 if it has been committed. Blocks while the queue is full.
+     *
+     * @param transaction
+     * @return
+     */
+    auto MySqlExtBindGroupCommit::commit( MySqlExtBindTransaction && transaction ) -> std::future<unsigned int>
+    {
+
+        Entry entry { std::move( transaction ), std::promise<unsigned int> {} };
+        std::future<unsigned int> completion = entry.completion->get_future();
+
+        m_queue.push( std::move( entry ) );
+
+        return completion;
+
+    }
+
+    auto MySqlExtBindGroupCommit::run() -> void
+    {
+
+        std::chrono::steady_clock::time_point firstTransaction;
+        Entry entry;
+
+        while ( true ) {
+
+            // Read both before draining - transactions committed before the destructor was called are then always seen,
+            // and a transaction committed while draining ends the wait immediately.
+            const size_t observed = m_queue.observe();
+            const bool   stop     = m_stop.load( std::memory_order_acquire );
+            const size_t drained  = m_group.size();
+
+            while ( m_group.size() < m_groupCommitOptions.maxTransactions && m_queue.tryPop( entry ) ) {
+
+                if ( m_group.empty() ) {
+
+                    firstTransaction = std::chrono::steady_clock::now();
+
+                }
+
+                m_group.push_back( std::move( entry ) );
+
+            }
+
+            if ( drained < m_group.size() ) {
+
+                m_queue.popped();
+
+            }
+
+            const bool full = m_group.size() >= m_groupCommitOptions.maxTransactions;
+
+            if ( full || ( false == m_group.empty() && ( stop || std::chrono::steady_clock::now() - firstTransaction >= m_groupCommitOptions.window ) ) ) {
+
+                commitGroup();
+
+            }
+
+            if ( full ) {
+
+                continue;
+
+            }
+
+            if ( stop && m_group.empty() ) {
+
+                break;
+
+            }
+
+            if ( m_group.empty() ) {
+
+                m_queue.wait( observed );
+
+            } else {
+
+                m_queue.waitUntil( observed, firstTransaction + m_groupCommitOptions.window );
+
+            }
+
+        }
+
+    }
+
+    auto MySqlExtBindGroupCommit::commitGroup() -> void
+    {
+
+        bool               retryEach {};
+        const unsigned int errorCode = 1 == m_group.size() ? executeTransaction( m_group.front().transaction ) : executeMerged( retryEach );
+
+        if ( false == retryEach ) {
+
+            for ( Entry & groupEntry : m_group ) {
+
+                groupEntry.completion->set_value( errorCode );
+
+            }
+
+        } else {
+
+            // A statement has failed and the merged transaction has been rolled back - retry each transaction on its own.
+            for ( Entry & groupEntry : m_group ) {
+
+                groupEntry.completion->set_value( executeTransaction( groupEntry.transaction ) );
+
+            }
+
+        }
+
+        m_group.clear();
+
+    }
+
+    /**
+     * Executes all transactions of the group in one server transaction. Sets <retryEach> if a statement has failed -
+     * then nothing has been committed and the transactions can be executed again. If START TRANSACTION or COMMIT fails,
+     * the error is the outcome of all transactions: CR_SERVER_LOST or CR_SERVER_GONE_ERROR on COMMIT doesn't tell
+     * whether the server has committed them.
+     *
+     * @param retryEach
+     * @return The MySQL error code.
+     */
+    auto MySqlExtBindGroupCommit::executeMerged( bool & retryEach ) -> unsigned int
+    {
+
+        if ( const unsigned int errorCode = query( "START TRANSACTION" ); 0 != errorCode ) {
+
+            return errorCode;
+
+        }
+
+        for ( const Entry & groupEntry : m_group ) {
+
+            if ( const unsigned int errorCode = executeSteps( groupEntry.transaction ); 0 != errorCode ) {
+
+                query( "ROLLBACK" );
+                retryEach = true;
+                return errorCode;
+
+            }
+
+        }
+
+        return query( "COMMIT" );
+
+    }
+
+    /**
+     * Executes one transaction in its own server transaction.
+     *
+     * @param transaction
+     * @return The MySQL error code - the transaction has been rolled back if it's not 0.
+     */
+    auto MySqlExtBindGroupCommit::executeTransaction( const MySqlExtBindTransaction & transaction ) -> unsigned int
+    {
+
+        if ( const unsigned int errorCode = query( "START TRANSACTION" ); 0 != errorCode ) {
+
+            return errorCode;
+
+        }
+
+        if ( const unsigned int errorCode = executeSteps( transaction ); 0 != errorCode ) {
+
+            query( "ROLLBACK" );
+            return errorCode;
+
+        }
+
+        return query( "COMMIT" );
+
+    }
+
+    /**
+     * Executes the statements of the transaction until the first one fails.
+     *
+     * @param transaction
+     * @return The MySQL error code of the failed statement or 0.
+     */
+    auto MySqlExtBindGroupCommit::executeSteps( const MySqlExtBindTransaction & transaction ) -> unsigned int
+    {
+
+        for ( const MySqlExtBindTransaction::Step & step : transaction.m_steps ) {
+
+            unsigned int errorCode      {};
+            MYSQL_STMT * mysqlStatement = statement( step.adjustedMysqlCommand, errorCode );
+            if ( nullptr == mysqlStatement ) {
+
+                return errorCode;
+
+            }
+
+            if ( m_bindNamesArray.size() < step.row.bindVariablesCount() ) {
+
+                m_bindNamesArray.resize( step.row.bindVariablesCount(), nullptr );
+
+            }
+
+            if ( mysql_stmt_bind_named_param( mysqlStatement, step.row.bindArray(), step.row.bindVariablesCount(), m_bindNamesArray.data() ) ||
+                 0 != mysql_stmt_execute( mysqlStatement ) ) {
+
+                errorCode = mysql_stmt_errno( mysqlStatement );
+                closeStatements( errorCode, &step.adjustedMysqlCommand );
+                return errorCode;
+
+            }
+
+            if ( 0 != mysql_stmt_field_count( mysqlStatement ) ) {
+
+                mysql_stmt_free_result( mysqlStatement );
+
+            }
+
+        }
+
+        return 0;
+
+    }
+
+    auto MySqlExtBindGroupCommit::query( const char * mysqlCommand ) -> unsigned int
+    {
+
+        if ( 0 == mysql_query( m_mysqlConnection, mysqlCommand ) ) {
+
+            return 0;
+
+        }
+
+        const unsigned int errorCode = mysql_errno( m_mysqlConnection );
+        closeStatements( errorCode, nullptr );
+
+        return errorCode;
+
+    }
+
+    /**
+     * Closes the prepared statements which <errorCode> has invalidated, so the next use prepares them again:
+     * all of them after a lost connection, the one of <adjustedMysqlCommand> after ER_NEED_REPREPARE or
+     * ER_UNKNOWN_STMT_HANDLER.
+     *
+     * @param errorCode
+     * @param adjustedMysqlCommand nullptr if the error isn't the one of a statement.
+     */
+    auto MySqlExtBindGroupCommit::closeStatements( unsigned int errorCode, const std::string * adjustedMysqlCommand ) -> void
+    {
+
+        if ( CR_SERVER_LOST == errorCode || CR_SERVER_GONE_ERROR == errorCode ) {
+
+            for ( auto & [preparedMysqlCommand, mysqlStatement] : m_statements ) {
+
+                // Avoid a warning which would be treated as an error.
+                (void) preparedMysqlCommand;
+
+                mysql_stmt_close( mysqlStatement );
+
+            }
+            m_statements.clear();
+
+        } else if ( ( ER_NEED_REPREPARE == errorCode || ER_UNKNOWN_STMT_HANDLER == errorCode ) && nullptr != adjustedMysqlCommand ) {
+
+            if ( auto foundStatement = m_statements.find( *adjustedMysqlCommand ); m_statements.end() != foundStatement ) {
+
+                mysql_stmt_close( foundStatement->second );
+                m_statements.erase( foundStatement );
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Returns the prepared statement for the adjusted MySQL command - it's prepared on first use.
+     * Returns nullptr if it cannot be prepared - <errorCode> has the reason. It's taken from the statement before
+     * mysql_stmt_close(), which clears the error of the connection.
+     *
+     * @param adjustedMysqlCommand
+     * @param errorCode Set if nullptr is returned - never 0.
+     * @return
+     */
+    auto MySqlExtBindGroupCommit::statement( const std::string & adjustedMysqlCommand, unsigned int & errorCode ) -> MYSQL_STMT *
+    {
+
+        if ( auto foundStatement = m_statements.find( adjustedMysqlCommand ); m_statements.end() != foundStatement ) {
+
+            return foundStatement->second;
+
+        }
+
+        MYSQL_STMT * mysqlStatement = mysql_stmt_init( m_mysqlConnection );
+        if ( nullptr == mysqlStatement ) {
+
+            errorCode = CR_OUT_OF_MEMORY;
+            return nullptr;
+
+        }
+
+        if ( 0 != mysql_stmt_prepare( mysqlStatement, adjustedMysqlCommand.c_str(), adjustedMysqlCommand.length() ) ) {
+
+            errorCode = mysql_stmt_errno( mysqlStatement );
+            errorCode = 0 == errorCode ? CR_UNKNOWN_ERROR : errorCode;
+
+            mysql_stmt_close( mysqlStatement );
+            return nullptr;
+
+        }
+
+        m_statements.emplace( adjustedMysqlCommand, mysqlStatement );
+
+        return mysqlStatement;
+
+    }
+
+}
@@ -0,0 +1,124 @@
+/**
+ * MySqlExtBindGroupCommit.h
+ *
+ * Header for the MySqlExtBindGroupCommit class - merges small transactions of concurrent callers into one
+ * server transaction, so they share one COMMIT round trip and one log flush.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_GROUP_COMMIT_H
+#define FAF_MYSQL_EXT_BIND_GROUP_COMMIT_H
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "MySqlExtBind.h"
+#include "MySqlExtBindQueue.h"
+
+namespace FaF
+{
+
+    /**
+     * A group is committed when it has <maxTransactions> transactions or when its first transaction has waited <window>.
+     * Committing blocks while <queueCapacity> transactions are waiting.
+     */
+    using GroupCommitOptions = struct GroupCommitOptions
+    {
+
+            std::chrono::microseconds   window          { 500 };
+            u_int                       maxTransactions { 64 };
+            size_t                      queueCapacity   { 4096 };
+
+    };
+
+    /**
+     * The statements of one transaction with their bound values. The statements must not return a result set.
+     */
+    class MySqlExtBindTransaction
+    {
+
+        public:
+
+            auto add( MySqlExtBind & boundExtBind ) -> void;
+            auto statementsCount() const            -> size_t { return m_steps.size(); }
+
+        private:
+
+            friend class MySqlExtBindGroupCommit;
+
+            using Step = struct Step
+            {
+
+                    std::string     adjustedMysqlCommand;
+                    BoundRow        row;
+
+            };
+
+            std::vector<Step>   m_steps;
+
+    };
+
+    class MySqlExtBindGroupCommit
+    {
+
+        public:
+
+            MySqlExtBindGroupCommit( MYSQL * mysqlConnection, const GroupCommitOptions & groupCommitOptions = GroupCommitOptions {} );
+            ~MySqlExtBindGroupCommit();
+
+            MySqlExtBindGroupCommit( const MySqlExtBindGroupCommit & )             = delete;
+            MySqlExtBindGroupCommit & operator=( const MySqlExtBindGroupCommit & ) = delete;
+
+            auto commit( MySqlExtBindTransaction && transaction ) -> std::future<unsigned int>;
+
+        private:
+
+            using Entry = struct Entry
+            {
+
+                    MySqlExtBindTransaction     transaction;
+                    // Engaged by commit() - a queue cell doesn't allocate the shared state of a promise up front.
+                    std::optional<std::promise<unsigned int>> completion;
+
+            };
+
+            auto run()                                                      -> void;
+            auto commitGroup()                                              -> void;
+            auto executeMerged( bool & retryEach )                          -> unsigned int;
+            auto executeTransaction( const MySqlExtBindTransaction & transaction ) -> unsigned int;
+            auto executeSteps( const MySqlExtBindTransaction & transaction ) -> unsigned int;
+            auto query( const char * mysqlCommand )                         -> unsigned int;
+            auto closeStatements( unsigned int errorCode, const std::string * adjustedMysqlCommand ) -> void;
+            auto statement( const std::string & adjustedMysqlCommand, unsigned int & errorCode ) -> MYSQL_STMT *;
+
+            // constructor initialiser list - respect the order.
+
+                MYSQL *                 m_mysqlConnection;
+                GroupCommitOptions      m_groupCommitOptions;
+                MpscWaitQueue<Entry>    m_queue;
+
+            // The transactions of the current group.
+            std::vector<Entry>          m_group;
+
+            // The prepared statements per adjusted MySQL command - shared by all transactions.
+            std::unordered_map<std::string, MYSQL_STMT *> m_statements;
+            std::vector<const char *>   m_bindNamesArray;
+
+            std::atomic<bool>           m_stop {};
+            std::thread                 m_committerThread;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,565 @@
+/**
+ * MySqlExtBindLoader.cpp
+ *
+ * Turns an INSERT ... (columns) VALUES (...) command into a LOAD DATA LOCAL INFILE command and streams the
+ * bound rows to the server through the mysql_set_local_infile_handler() callbacks - no file is written.
+ * The rows are formatted in the default LOAD DATA text format: tab separated fields, newline terminated lines,
+ * backslash escapes and \N for NULL.
+ * A bind variable used directly as column value is loaded into the column, one used in an expression
+ * is loaded into a user variable @fafN and assigned in the SET clause.
+ * load() pulls the rows from a callback while the client library reads, so only about one read buffer of formatted
+ * rows is held however many rows are loaded.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindLoader.h"
+#include "MySqlExtBindBatch.h"
+
+#include <cctype>
+#include <charconv>
+#include <cstdio>
+#include <vector>
+
+#include <errmsg.h>
+
+namespace
+{
+
+    auto trim( std::string_view text ) -> std::string_view
+    {
+
+        const size_t first = text.find_first_not_of( " \t\r\n" );
+        if ( std::string_view::npos == first ) {
+
+            return {};
+
+        }
+
+        return text.substr( first, text.find_last_not_of( " \t\r\n" ) - first + 1 );
+
+    }
+
+    /**
+     * Splits a comma separated list at the top level - commas in brackets, quoted strings and identifiers are skipped.
+     *
+     * @param list
+     * @return The trimmed items.
+     */
+    auto splitList( std::string_view list ) -> std::vector<std::string_view>
+    {
+
+        std::vector<std::string_view> items;
+        size_t itemBegin {};
+        int    depth     {};
+        char   quote     {};
+
+        for ( size_t index = 0; index < list.length(); index++ ) {
+
+            const char character = list [index];
+
+            if ( 0 != quote ) {
+
+                if ( '\\' == character && '`' != quote ) {
+
+                    index++;
+
+                } else if ( quote == character ) {
+
+                    quote = 0;
+
+                }
+
+            } else if ( '\'' == character || '"' == character || '`' == character ) {
+
+                quote = character;
+
+            } else if ( '(' == character ) {
+
+                depth++;
+
+            } else if ( ')' == character ) {
+
+                depth--;
+
+            } else if ( ',' == character && 0 == depth ) {
+
+                items.push_back( trim( list.substr( itemBegin, index - itemBegin ) ) );
+                itemBegin = index + 1;
+
+            }
+
+        }
+
+        items.push_back( trim( list.substr( itemBegin ) ) );
+
+        return items;
+
+    }
+
+    /**
+     * Replaces each <?> outside of quotes by the user variable @fafN - N counts from <placeholderIndex> on.
+     *
+     * @param expression
+     * @param placeholderIndex
+     * @param fields           The user variables are appended as fields.
+     * @return
+     */
+    auto replacePlaceholders( std::string_view expression, u_int & placeholderIndex, std::string & fields ) -> std::string
+    {
+
+        std::string replacedExpression;
+        char        quote {};
+
+        for ( size_t index = 0; index < expression.length(); index++ ) {
+
+            const char character = expression [index];
+
+            if ( 0 != quote ) {
+
+                if ( '\\' == character && '`' != quote && index + 1 < expression.length() ) {
+
+                    // Keep the escaped character - it cannot end the quote.
+                    replacedExpression += expression [index++];
+
+                } else if ( quote == character ) {
+
+                    quote = 0;
+
+                }
+
+            } else if ( '\'' == character || '"' == character || '`' == character ) {
+
+                quote = character;
+
+            } else if ( '?' == character ) {
+
+                const std::string userVariable = "@faf" + std::to_string( placeholderIndex++ );
+
+                fields.append( fields.empty() ? "" : ", " ).append( userVariable );
+                replacedExpression += userVariable;
+                continue;
+
+            }
+
+            replacedExpression += expression [index];
+
+        }
+
+        return replacedExpression;
+
+    }
+
+    template < typename Number >
+    auto appendNumber( std::string & data, Number number ) -> void
+    {
+
+        char numberText [32];
+        const auto result = std::to_chars( std::begin( numberText ), std::end( numberText ), number );
+        data.append( numberText, result.ptr );
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * The MySQL command must be an INSERT or REPLACE, optionally with LOW_PRIORITY, DELAYED or HIGH_PRIORITY and IGNORE,
+     * with a column list and one VALUES tuple:
+     *   INSERT INTO foo (a, b, c) VALUES (:a, :b, UPPER(:c))
+     * LOW_PRIORITY is passed on to LOAD DATA, which has no DELAYED or HIGH_PRIORITY - they are dropped.
+     * LOAD DATA has no ON DUPLICATE KEY UPDATE, so nothing may follow the tuple.
+     * The connection must allow LOCAL INFILE - set MYSQL_OPT_LOCAL_INFILE before connecting.
+     *
+     * @param mysqlConnection
+     * @param mysqlCommand
+     */
+    MySqlExtBindLoader::MySqlExtBindLoader( MYSQL * mysqlConnection, std::string_view mysqlCommand )
+    :
+        m_mysqlConnection( mysqlConnection )
+    {
+
+        // Only used to parse the MySQL command.
+        const MySqlExtBind templateExtBind( nullptr, mysqlCommand );
+        m_bindVariablesCount = templateExtBind.bindVariablesCount();
+
+        static const std::regex prefixRegex(
+            R"(^\s*(INSERT|REPLACE)(?:\s+(LOW_PRIORITY|DELAYED|HIGH_PRIORITY))?(\s+IGNORE)?\s+(?:INTO\s+)?(.+?)\s*\(([^()]*)\)\s*VALUES?\s*$)", std::regex::icase );
+
+        const std::optional<ValuesClause> valuesClause = MySqlExtBindBatch::findValuesClause( templateExtBind.adjustedMysqlCommand() );
+        std::match_results<std::string_view::const_iterator> prefixMatch;
+
+        std::vector<std::string_view> columns;
+        std::vector<std::string_view> expressions;
+
+        if ( valuesClause.has_value() && trim( valuesClause->suffix ).empty() &&
+             std::regex_match( valuesClause->prefix.begin(), valuesClause->prefix.end(), prefixMatch, prefixRegex ) ) {
+
+            const std::string_view prefix = valuesClause->prefix;
+            columns     = splitList( prefix.substr( static_cast<size_t>( prefixMatch.position( 5 ) ), static_cast<size_t>( prefixMatch.length( 5 ) ) ) );
+            expressions = splitList( valuesClause->tuple.substr( 1, valuesClause->tuple.length() - 2 ) );
+
+        }
+
+        if ( columns.empty() || columns.size() != expressions.size() ) {
+
+            std::cerr
+                << "Exception #7: The MySQL command cannot be executed as LOAD DATA. Use INSERT INTO table (columns) VALUES (...) "
+                << "with one value per column and nothing after the VALUES tuple." << std::endl
+                << "[" << mysqlCommand << "]" << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        std::string fields;
+        std::string assignments;
+        u_int       placeholderIndex {};
+
+        for ( size_t index = 0; index < columns.size(); index++ ) {
+
+            if ( "?" == expressions [index] ) {
+
+                fields.append( fields.empty() ? "" : ", " ).append( columns [index] );
+                placeholderIndex++;
+
+            } else {
+
+                assignments.append( assignments.empty() ? "" : ", " ).append( columns [index] ).append( " = " )
+                           .append( replacePlaceholders( expressions [index], placeholderIndex, fields ) );
+
+            }
+
+        }
+
+        const bool isReplace     = 'R' == std::toupper( static_cast<unsigned char>( *prefixMatch [1].first ) );
+        const bool isLowPriority = prefixMatch [2].matched && 'L' == std::toupper( static_cast<unsigned char>( *prefixMatch [2].first ) );
+
+        m_loadDataCommand
+            .append( isLowPriority ? "LOAD DATA LOW_PRIORITY LOCAL INFILE 'MySqlExtBindLoader' " : "LOAD DATA LOCAL INFILE 'MySqlExtBindLoader' " )
+            .append( isReplace ? "REPLACE " : prefixMatch [3].matched ? "IGNORE " : "" )
+            .append( "INTO TABLE " ).append( prefixMatch.str( 4 ) )
+            .append( " CHARACTER SET binary FIELDS TERMINATED BY '\\t' ESCAPED BY '\\\\' LINES TERMINATED BY '\\n' (" )
+            .append( fields ).append( ")" );
+
+        if ( false == assignments.empty() ) {
+
+            m_loadDataCommand.append( " SET " ).append( assignments );
+
+        }
+
+    }
+
+    /**
+     * Formats the bound values of <boundExtBind> - it must have been constructed with the same MySQL command.
+     * The caller can reuse its buffers as soon as the function returns.
+     *
+     * @param boundExtBind
+     */
+    auto MySqlExtBindLoader::add( MySqlExtBind & boundExtBind ) -> void
+    {
+
+        appendRow( boundExtBind.checkedBindArray(), boundExtBind.bindVariablesCount() );
+
+    }
+
+    auto MySqlExtBindLoader::add( const BoundRow & boundRow ) -> void
+    {
+
+        appendRow( boundRow.bindArray(), boundRow.bindVariablesCount() );
+
+    }
+
+    /**
+     * Runs the LOAD DATA command - the server reads the pending rows through the local infile callbacks.
+     * The pending rows are removed in any case. All rows are held in memory until then - use load() for large volumes.
+     *
+     * @return The MySQL error code - 0 if the rows have been loaded.
+     */
+    auto MySqlExtBindLoader::execute() -> unsigned int
+    {
+
+        if ( 0 == m_pendingRows ) {
+
+            return 0;
+
+        }
+
+        return loadData();
+
+    }
+
+    /**
+     * Runs the LOAD DATA command and streams the rows: whenever less than one read buffer of formatted rows is left,
+     * <addRows> is called from the read callback of the client library. It adds the next rows with add() and returns
+     * false when there are no more - it must not call execute() or load(). Rows added before are loaded first.
+     * If <addRows> throws, the LOAD DATA command is aborted and the exception is rethrown - the server may have
+     * loaded the rows sent so far.
+     *
+     * @param addRows
+     * @return The MySQL error code - 0 if the rows have been loaded.
+     */
+    auto MySqlExtBindLoader::load( const std::function<bool( MySqlExtBindLoader & loader )> & addRows ) -> unsigned int
+    {
+
+        m_addRows = &addRows;
+
+        const unsigned int errorCode = loadData();
+
+        m_addRows = nullptr;
+
+        if ( nullptr != m_addRowsException ) {
+
+            std::rethrow_exception( std::exchange( m_addRowsException, nullptr ) );
+
+        }
+
+        return errorCode;
+
+    }
+
+    auto MySqlExtBindLoader::loadData() -> unsigned int
+    {
+
+        mysql_set_local_infile_handler( m_mysqlConnection, localInfileInit, localInfileRead, localInfileEnd, localInfileError, this );
+
+        const unsigned int errorCode = 0 == mysql_query( m_mysqlConnection, m_loadDataCommand.c_str() ) ? 0 : mysql_errno( m_mysqlConnection );
+
+        mysql_set_local_infile_default( m_mysqlConnection );
+
+        m_data.clear();
+        m_pendingRows  = 0;
+        m_readPosition = 0;
+
+        return errorCode;
+
+    }
+
+    auto MySqlExtBindLoader::appendRow( const MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount ) -> void
+    {
+
+        if ( bindVariablesCount != m_bindVariablesCount ) {
+
+            std::cerr
+                << "Exception #6: The row has " << bindVariablesCount << " bind variables, but the MySQL command has "
+                << m_bindVariablesCount << "." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        for ( u_int index = 0; index < bindVariablesCount; index++ ) {
+
+            if ( 0 != index ) {
+
+                m_data += '\t';
+
+            }
+            appendValue( mysqlBindArray [index] );
+
+        }
+
+        m_data += '\n';
+        m_pendingRows++;
+
+    }
+
+    /**
+     * Appends the value in the LOAD DATA text format. Numbers and temporal values are converted to text,
+     * all other types are appended byte for byte with the escapes.
+     *
+     * @param mysqlBindItem
+     */
+    auto MySqlExtBindLoader::appendValue( const MYSQL_BIND & mysqlBindItem ) -> void
+    {
+
+        if ( BoundRow::isNullValue( mysqlBindItem ) ) {
+
+            m_data += "\\N";
+            return;
+
+        }
+
+        const void * buffer     = mysqlBindItem.buffer;
+        const bool   isUnsigned = mysqlBindItem.is_unsigned;
+
+        switch ( mysqlBindItem.buffer_type ) {
+
+            case MYSQL_TYPE_TINY:
+                isUnsigned ? appendNumber( m_data, *static_cast<const unsigned char *>( buffer ) )
+                           : appendNumber( m_data, *static_cast<const signed char *>( buffer ) );
+                break;
+
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_YEAR:
+                isUnsigned ? appendNumber( m_data, *static_cast<const unsigned short *>( buffer ) )
+                           : appendNumber( m_data, *static_cast<const short *>( buffer ) );
+                break;
+
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_INT24:
+                isUnsigned ? appendNumber( m_data, *static_cast<const unsigned int *>( buffer ) )
+                           : appendNumber( m_data, *static_cast<const int *>( buffer ) );
+                break;
+
+            case MYSQL_TYPE_LONGLONG:
+                isUnsigned ? appendNumber( m_data, *static_cast<const unsigned long long *>( buffer ) )
+                           : appendNumber( m_data, *static_cast<const long long *>( buffer ) );
+                break;
+
+            case MYSQL_TYPE_FLOAT:
+                appendNumber( m_data, *static_cast<const float *>( buffer ) );
+                break;
+
+            case MYSQL_TYPE_DOUBLE:
+                appendNumber( m_data, *static_cast<const double *>( buffer ) );
+                break;
+
+            case MYSQL_TYPE_TIME:
+            case MYSQL_TYPE_DATE:
+            case MYSQL_TYPE_DATETIME:
+            case MYSQL_TYPE_TIMESTAMP: {
+
+                const MYSQL_TIME & mysqlTime = *static_cast<const MYSQL_TIME *>( buffer );
+                char               timeText [64];
+                int                length {};
+
+                if ( MYSQL_TYPE_TIME == mysqlBindItem.buffer_type ) {
+
+                    length = std::snprintf( timeText, sizeof( timeText ), "%s%u:%02u:%02u", mysqlTime.neg ? "-" : "",
+                                            mysqlTime.day * 24 + mysqlTime.hour, mysqlTime.minute, mysqlTime.second );
+
+                } else {
+
+                    length = std::snprintf( timeText, sizeof( timeText ), "%04u-%02u-%02u", mysqlTime.year, mysqlTime.month, mysqlTime.day );
+                    if ( MYSQL_TYPE_DATE != mysqlBindItem.buffer_type ) {
+
+                        length += std::snprintf( timeText + length, sizeof( timeText ) - static_cast<size_t>( length ), " %02u:%02u:%02u",
+                                                 mysqlTime.hour, mysqlTime.minute, mysqlTime.second );
+
+                    }
+
+                }
+
+                if ( MYSQL_TYPE_DATE != mysqlBindItem.buffer_type && 0 != mysqlTime.second_part ) {
+
+                    length += std::snprintf( timeText + length, sizeof( timeText ) - static_cast<size_t>( length ), ".%06lu", mysqlTime.second_part );
+
+                }
+
+                m_data.append( timeText, static_cast<size_t>( length ) );
+                break;
+
+            }
+
+            default:
+                appendEscaped( static_cast<const char *>( buffer ), BoundRow::valueLength( mysqlBindItem ) );
+                break;
+
+        }
+
+    }
+
+    /**
+     * Escapes the characters which would end the field or the line and the escape character itself.
+     *
+     * @param value
+     * @param length
+     */
+    auto MySqlExtBindLoader::appendEscaped( const char * value, size_t length ) -> void
+    {
+
+        for ( size_t index = 0; index < length; index++ ) {
+
+            switch ( value [index] ) {
+
+                case '\\':  m_data += "\\\\"; break;
+                case '\t':  m_data += "\\t";  break;
+                case '\n':  m_data += "\\n";  break;
+                case '\r':  m_data += "\\r";  break;
+                case '\0':  m_data += "\\0";  break;
+                default:    m_data += value [index]; break;
+
+            }
+
+        }
+
+    }
+
+    auto MySqlExtBindLoader::localInfileInit( void ** handle, const char *, void * userData ) -> int
+    {
+
+        *handle = userData;
+        static_cast<MySqlExtBindLoader *>( userData )->m_readPosition = 0;
+
+        return 0;
+
+    }
+
+    /**
+     * Hands the next part of the pending rows to the client library. While load() runs, the rows which have been
+     * handed over are dropped and the callback adds rows until one buffer is filled or it has none left.
+     *
+     * @param handle
+     * @param buffer
+     * @param bufferLength
+     * @return The number of bytes - 0 at the end, -1 if the callback of load() has thrown.
+     */
+    auto MySqlExtBindLoader::localInfileRead( void * handle, char * buffer, unsigned int bufferLength ) -> int
+    {
+
+        MySqlExtBindLoader * loader = static_cast<MySqlExtBindLoader *>( handle );
+
+        if ( nullptr != loader->m_addRows ) {
+
+            loader->m_data.erase( 0, loader->m_readPosition );
+            loader->m_readPosition = 0;
+
+            try {
+
+                while ( nullptr != loader->m_addRows && loader->m_data.size() < bufferLength ) {
+
+                    if ( false == ( *loader->m_addRows )( *loader ) ) {
+
+                        loader->m_addRows = nullptr;
+
+                    }
+
+                }
+
+            } catch ( ... ) {
+
+                // An exception must not pass the client library.
+                loader->m_addRows          = nullptr;
+                loader->m_addRowsException = std::current_exception();
+                return -1;
+
+            }
+
+        }
+
+        const size_t length = std::min<size_t>( bufferLength, loader->m_data.size() - loader->m_readPosition );
+        std::memcpy( buffer, loader->m_data.data() + loader->m_readPosition, length );
+        loader->m_readPosition += length;
+
+        return static_cast<int>( length );
+
+    }
+
+    auto MySqlExtBindLoader::localInfileEnd( void * ) -> void
+    {
+    }
+
+    auto MySqlExtBindLoader::localInfileError( void *, char * message, unsigned int messageLength ) -> int
+    {
+
+        std::snprintf( message, messageLength, "MySqlExtBindLoader: reading the rows failed" );
+
+        return CR_UNKNOWN_ERROR;
+
+    }
+
+}
@@ -0,0 +1,81 @@
+/**
+ * MySqlExtBindLoader.h
+ *
+ * Header for the MySqlExtBindLoader class - loads the rows of an INSERT ... VALUES (...) command
+ * with LOAD DATA LOCAL INFILE.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_LOADER_H
+#define FAF_MYSQL_EXT_BIND_LOADER_H
+
+#include <exception>
+#include <functional>
+#include <string>
+#include <string_view>
+
+#include "MySqlExtBind.h"
+
+namespace FaF
+{
+
+    class MySqlExtBindLoader
+    {
+
+        public:
+
+            MySqlExtBindLoader( MYSQL * mysqlConnection, std::string_view mysqlCommand );
+
+            MySqlExtBindLoader( const MySqlExtBindLoader & )             = delete;
+            MySqlExtBindLoader & operator=( const MySqlExtBindLoader & ) = delete;
+
+            auto add( MySqlExtBind & boundExtBind )  -> void;
+            auto add( const BoundRow & boundRow )    -> void;
+            auto pendingRows()  const                -> size_t { return m_pendingRows; }
+            auto pendingBytes() const                -> size_t { return m_data.size() - m_readPosition; }
+            auto execute()                           -> unsigned int;
+
+            auto load( const std::function<bool( MySqlExtBindLoader & loader )> & addRows ) -> unsigned int;
+
+            auto loadDataCommand() const -> const std::string & { return m_loadDataCommand; }
+
+        private:
+
+            auto loadData()                                                               -> unsigned int;
+            auto appendRow( const MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount ) -> void;
+            auto appendValue( const MYSQL_BIND & mysqlBindItem )                          -> void;
+            auto appendEscaped( const char * value, size_t length )                       -> void;
+
+            // The callbacks for mysql_set_local_infile_handler() - <userData> is the instance.
+            static auto localInfileInit( void ** handle, const char * fileName, void * userData ) -> int;
+            static auto localInfileRead( void * handle, char * buffer, unsigned int bufferLength ) -> int;
+            static auto localInfileEnd( void * handle )                                            -> void;
+            static auto localInfileError( void * handle, char * message, unsigned int messageLength ) -> int;
+
+            // constructor initialiser list - respect the order.
+
+                MYSQL *         m_mysqlConnection;
+
+            u_int               m_bindVariablesCount {};
+            std::string         m_loadDataCommand;
+
+            // The pending rows in the LOAD DATA text format and the position up to which the server has read them.
+            // While load() runs, it holds only the rows which haven't been handed to the client library yet.
+            std::string         m_data;
+            size_t              m_pendingRows {};
+            size_t              m_readPosition {};
+
+            // The callback of load() - called by localInfileRead() when <m_data> runs low.
+            const std::function<bool( MySqlExtBindLoader & loader )> * m_addRows {};
+            // Thrown by the callback of load() - rethrown after the LOAD DATA command has ended.
+            std::exception_ptr  m_addRowsException;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,348 @@
+/**
+ * MySqlExtBindNonblocking.cpp
+ *
+ * Each connection runs one query at a time, the submitted queries wait in a queue. A query goes through the
+ * steps of the nonblocking API - mysql_real_query_nonblocking(), mysql_store_result_nonblocking(),
+ * mysql_fetch_row_nonblocking() and mysql_free_result_nonblocking(). A step is called again when the socket of
+ * the connection is ready, until it doesn't return NET_ASYNC_NOT_READY any more.
+ * The API doesn't tell whether a step waits for reading or writing, so the socket is watched for both,
+ * edge-triggered - a writable socket doesn't wake the poller again and again.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindNonblocking.h"
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+namespace
+{
+
+    // The number of sockets handled per epoll_wait() call.
+    constexpr int g_maxEvents { 64 };
+
+    [[noreturn]] auto throwEpollException() -> void
+    {
+
+        std::cerr << "Exception #10: The connection socket cannot be watched with epoll." << std::endl;
+        throw FaF::Exception();
+
+    }
+
+}
+
+namespace FaF
+{
+
+    MySqlExtBindPoller::MySqlExtBindPoller()
+    :
+        m_epollDescriptor( epoll_create1( EPOLL_CLOEXEC ) )
+    {
+
+        if ( 0 > m_epollDescriptor ) {
+
+            throwEpollException();
+
+        }
+
+    }
+
+    /**
+     * The queries which are still pending are not completed - the connections are in an undefined state then.
+     */
+    MySqlExtBindPoller::~MySqlExtBindPoller()
+    {
+
+        close( m_epollDescriptor );
+
+    }
+
+    /**
+     * Renders the statement with the bound values and queues it - the bound buffers can be reused immediately.
+     *
+     * @param mysqlConnection
+     * @param boundExtBind
+     * @param queryCompletion
+     */
+    auto MySqlExtBindPoller::submit( MYSQL * mysqlConnection, MySqlExtBind & boundExtBind, QueryCompletion queryCompletion ) -> void
+    {
+
+        std::string mysqlCommand;
+        MySqlExtBindRender::render( mysqlConnection, boundExtBind, mysqlCommand );
+
+        submit( mysqlConnection, std::move( mysqlCommand ), std::move( queryCompletion ) );
+
+    }
+
+    /**
+     * Queues the command - it's started by the next poll(). <queryCompletion> is called by poll() when it's done.
+     * The connection must have been connected and must not be used elsewhere until it's removed.
+     *
+     * @param mysqlConnection
+     * @param mysqlCommand    One SQL statement.
+     * @param queryCompletion
+     */
+    auto MySqlExtBindPoller::submit( MYSQL * mysqlConnection, std::string mysqlCommand, QueryCompletion queryCompletion ) -> void
+    {
+
+        ConnectionState & state = connectionState( mysqlConnection );
+
+        if ( Step::idle == state.step && state.pendingQueries.empty() ) {
+
+            m_startableConnections.push_back( &state );
+
+        }
+
+        state.pendingQueries.push_back( PendingQuery { std::move( mysqlCommand ), std::move( queryCompletion ) } );
+        m_pendingQueries++;
+
+    }
+
+    /**
+     * Stops watching the connection. It must not have pending queries and must not be removed by a completion.
+     *
+     * @param mysqlConnection
+     */
+    auto MySqlExtBindPoller::removeConnection( MYSQL * mysqlConnection ) -> void
+    {
+
+        if ( 0 < m_connections.erase( mysqlConnection ) ) {
+
+            epoll_ctl( m_epollDescriptor, EPOLL_CTL_DEL, mysqlConnection->net.fd, nullptr );
+
+        }
+
+    }
+
+    /**
+     * Starts the queued queries and continues the queries whose sockets are ready. Waits up to <timeoutMilliseconds>
+     * if nothing can be done immediately - -1 waits until a socket is ready.
+     *
+     * @param timeoutMilliseconds
+     * @return The number of completed queries.
+     */
+    auto MySqlExtBindPoller::poll( int timeoutMilliseconds ) -> size_t
+    {
+
+        size_t completedQueries {};
+
+        std::vector<ConnectionState *> startableConnections;
+        startableConnections.swap( m_startableConnections );
+
+        for ( ConnectionState * state : startableConnections ) {
+
+            completedQueries += advance( *state );
+
+        }
+
+        if ( 0 == m_pendingQueries ) {
+
+            return completedQueries;
+
+        }
+
+        epoll_event readyEvents [g_maxEvents];
+        const bool  mustNotWait = 0 < completedQueries || false == m_startableConnections.empty();
+        const int   readyCount  = epoll_wait( m_epollDescriptor, readyEvents, g_maxEvents, mustNotWait ? 0 : timeoutMilliseconds );
+
+        for ( int index = 0; index < readyCount; index++ ) {
+
+            completedQueries += advance( *static_cast<ConnectionState *>( readyEvents [index].data.ptr ) );
+
+        }
+
+        return completedQueries;
+
+    }
+
+    /**
+     * Returns the state of the connection - a new connection is added to epoll.
+     *
+     * @param mysqlConnection
+     * @return
+     */
+    auto MySqlExtBindPoller::connectionState( MYSQL * mysqlConnection ) -> ConnectionState &
+    {
+
+        const auto [connection, inserted] = m_connections.try_emplace( mysqlConnection );
+        ConnectionState & state = connection->second;
+
+        if ( inserted ) {
+
+            state.mysqlConnection = mysqlConnection;
+
+            epoll_event socketEvent {};
+            socketEvent.events   = EPOLLIN | EPOLLOUT | EPOLLET;
+            socketEvent.data.ptr = &state;
+
+            if ( 0 != epoll_ctl( m_epollDescriptor, EPOLL_CTL_ADD, mysqlConnection->net.fd, &socketEvent ) ) {
+
+                m_connections.erase( connection );
+                throwEpollException();
+
+            }
+
+        }
+
+        return state;
+
+    }
+
+    /**
+     * Runs the steps of the current query until one isn't ready, then starts the next query.
+     *
+     * @param state
+     * @return The number of completed queries.
+     */
+    auto MySqlExtBindPoller::advance( ConnectionState & state ) -> size_t
+    {
+
+        size_t completedQueries {};
+
+        while ( true ) {
+
+            switch ( state.step ) {
+
+                case Step::idle:
+                    if ( state.pendingQueries.empty() ) {
+
+                        return completedQueries;
+
+                    }
+                    state.queryResult = QueryResult {};
+                    state.step        = Step::query;
+                    break;
+
+                case Step::query: {
+
+                    const std::string & mysqlCommand = state.pendingQueries.front().mysqlCommand;
+                    const net_async_status asyncStatus = mysql_real_query_nonblocking( state.mysqlConnection, mysqlCommand.data(),
+                                                                                       mysqlCommand.length() );
+                    if ( NET_ASYNC_NOT_READY == asyncStatus ) {
+
+                        return completedQueries;
+
+                    }
+
+                    if ( NET_ASYNC_ERROR == asyncStatus || 0 == mysql_field_count( state.mysqlConnection ) ) {
+
+                        state.queryResult.affectedRows = NET_ASYNC_ERROR == asyncStatus ? 0 : mysql_affected_rows( state.mysqlConnection );
+                        state.queryResult.lastInsertId = NET_ASYNC_ERROR == asyncStatus ? 0 : mysql_insert_id( state.mysqlConnection );
+                        complete( state );
+                        completedQueries++;
+                        break;
+
+                    }
+
+                    state.step = Step::storeResult;
+                    break;
+
+                }
+
+                case Step::storeResult: {
+
+                    const net_async_status asyncStatus = mysql_store_result_nonblocking( state.mysqlConnection, &state.mysqlResult );
+                    if ( NET_ASYNC_NOT_READY == asyncStatus ) {
+
+                        return completedQueries;
+
+                    }
+
+                    if ( NET_ASYNC_ERROR == asyncStatus || nullptr == state.mysqlResult ) {
+
+                        state.mysqlResult = nullptr;
+                        complete( state );
+                        completedQueries++;
+                        break;
+
+                    }
+
+                    state.step = Step::fetchRows;
+                    break;
+
+                }
+
+                case Step::fetchRows: {
+
+                    MYSQL_ROW              mysqlRow    {};
+                    const net_async_status asyncStatus = mysql_fetch_row_nonblocking( state.mysqlResult, &mysqlRow );
+                    if ( NET_ASYNC_NOT_READY == asyncStatus ) {
+
+                        return completedQueries;
+
+                    }
+
+                    if ( NET_ASYNC_ERROR == asyncStatus || nullptr == mysqlRow ) {
+
+                        state.step = Step::freeResult;
+                        break;
+
+                    }
+
+                    const unsigned int    fieldsCount   = mysql_num_fields( state.mysqlResult );
+                    const unsigned long * fieldsLengths = mysql_fetch_lengths( state.mysqlResult );
+
+                    auto & row = state.queryResult.rows.emplace_back( fieldsCount );
+                    for ( unsigned int index = 0; index < fieldsCount; index++ ) {
+
+                        if ( nullptr != mysqlRow [index] ) {
+
+                            row [index].emplace( mysqlRow [index], fieldsLengths [index] );
+
+                        }
+
+                    }
+                    break;
+
+                }
+
+                case Step::freeResult:
+                    if ( NET_ASYNC_NOT_READY == mysql_free_result_nonblocking( state.mysqlResult ) ) {
+
+                        return completedQueries;
+
+                    }
+                    state.mysqlResult = nullptr;
+                    complete( state );
+                    completedQueries++;
+                    break;
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Takes the error of the connection - if any - and calls the completion of the current query.
+     *
+     * @param state
+     */
+    auto MySqlExtBindPoller::complete( ConnectionState & state ) -> void
+    {
+
+        state.queryResult.errorCode = mysql_errno( state.mysqlConnection );
+        if ( 0 != state.queryResult.errorCode ) {
+
+            state.queryResult.errorMessage = mysql_error( state.mysqlConnection );
+
+        }
+
+        QueryCompletion queryCompletion { std::move( state.pendingQueries.front().queryCompletion ) };
+        state.pendingQueries.pop_front();
+        state.step = Step::idle;
+        m_pendingQueries--;
+
+        if ( queryCompletion ) {
+
+            queryCompletion( state.queryResult );
+
+        }
+
+    }
+
+}
@@ -0,0 +1,109 @@
+/**
+ * MySqlExtBindNonblocking.h
+ *
+ * Header for the MySqlExtBindPoller class - runs rendered statements with the nonblocking functions of
+ * libmysqlclient on many connections from one thread, waiting for the sockets with epoll.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_NONBLOCKING_H
+#define FAF_MYSQL_EXT_BIND_NONBLOCKING_H
+
+#include <deque>
+#include <functional>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "MySqlExtBindRender.h"
+
+namespace FaF
+{
+
+    /**
+     * The outcome of a query. <rows> has the result set of a SELECT - NULL values are empty optionals.
+     */
+    using QueryResult = struct QueryResult
+    {
+
+            unsigned int        errorCode    {};
+            std::string         errorMessage;
+            unsigned long long  affectedRows {};
+            unsigned long long  lastInsertId {};
+            std::vector< std::vector< std::optional<std::string> > > rows;
+
+    };
+
+    using QueryCompletion = std::function<void( QueryResult & queryResult )>;
+
+    class MySqlExtBindPoller
+    {
+
+        public:
+
+            MySqlExtBindPoller();
+            ~MySqlExtBindPoller();
+
+            MySqlExtBindPoller( const MySqlExtBindPoller & )             = delete;
+            MySqlExtBindPoller & operator=( const MySqlExtBindPoller & ) = delete;
+
+            auto submit( MYSQL * mysqlConnection, MySqlExtBind & boundExtBind, QueryCompletion queryCompletion ) -> void;
+            auto submit( MYSQL * mysqlConnection, std::string mysqlCommand, QueryCompletion queryCompletion )    -> void;
+            auto removeConnection( MYSQL * mysqlConnection )                                                      -> void;
+
+            auto poll( int timeoutMilliseconds ) -> size_t;
+            auto pending() const                 -> size_t { return m_pendingQueries; }
+
+        private:
+
+            enum class Step
+            {
+                idle,
+                query,
+                storeResult,
+                fetchRows,
+                freeResult
+            };
+
+            using PendingQuery = struct PendingQuery
+            {
+
+                    std::string         mysqlCommand;
+                    QueryCompletion     queryCompletion;
+
+            };
+
+            using ConnectionState = struct ConnectionState
+            {
+
+                    MYSQL *                     mysqlConnection {};
+                    Step                        step            { Step::idle };
+                    std::deque<PendingQuery>    pendingQueries;
+                    MYSQL_RES *                 mysqlResult     {};
+                    QueryResult                 queryResult;
+
+            };
+
+            auto connectionState( MYSQL * mysqlConnection ) -> ConnectionState &;
+            auto advance( ConnectionState & connectionState ) -> size_t;
+            auto complete( ConnectionState & connectionState ) -> void;
+
+            // constructor initialiser list - respect the order.
+
+                int                                             m_epollDescriptor;
+
+            std::unordered_map<MYSQL *, ConnectionState>        m_connections;
+            // The connections with a new query which hasn't been started yet.
+            std::vector<ConnectionState *>                      m_startableConnections;
+            size_t                                              m_pendingQueries {};
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,312 @@
+/**
+ * MySqlExtBindParameterSets.h
+ *
+ * Several parameter sets for one prepared statement, so the caller fills the next set while the I/O thread
+ * executes the previous one. Each set has its own MySqlExtBind bound to its own values - the sets are handed
+ * over by index and nothing is copied between them.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_PARAMETER_SETS_H
+#define FAF_MYSQL_EXT_BIND_PARAMETER_SETS_H
+
+#include <algorithm>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "MySqlExtBind.h"
+
+namespace FaF
+{
+
+    /**
+     * <ParameterSet> holds the values of one execution and must be default constructible. The binder assigns
+     * the bind data of a MySqlExtBind to the members of a ParameterSet - it's called on the caller's thread
+     * for each submitted set, so it should only call assignBindData().
+     *
+     *     parameterSets.parameterSet().id = 2804;
+     *     parameterSets.submit();
+     */
+    template < typename ParameterSet >
+    class MySqlExtBindParameterSets
+    {
+
+        public:
+
+            using Binder     = std::function<void( MySqlExtBind & fafExtBind, ParameterSet & parameterSet )>;
+            // Called on the I/O thread after each execution - <errorCode> is 0 if the statement has been executed.
+            // An exception thrown by it is rethrown by flush().
+            using Completion = std::function<void( ParameterSet & parameterSet, unsigned int errorCode )>;
+
+            /**
+             * The statement is executed by the I/O thread - it must not be used elsewhere until the instance is destroyed.
+             *
+             * @param mysqlStatement
+             * @param mysqlCommand
+             * @param binder
+             * @param setsCount      At least 2 - more sets absorb jitter of the round trips.
+             * @param completion
+             */
+            MySqlExtBindParameterSets( MYSQL_STMT * mysqlStatement, std::string_view mysqlCommand, Binder binder,
+                                       u_int setsCount = 2, Completion completion = {} )
+            :
+                m_mysqlStatement( mysqlStatement ),
+                m_binder        ( std::move( binder ) ),
+                m_completion    ( std::move( completion ) )
+            {
+
+                for ( u_int index = 0; index < std::max( 2U, setsCount ); index++ ) {
+
+                    m_slots.push_back( std::make_unique<Slot>( mysqlStatement, mysqlCommand ) );
+
+                }
+                m_bindNamesArray.resize( m_slots.front()->fafExtBind.bindVariablesCount(), nullptr );
+
+                m_ioThread = std::thread( &MySqlExtBindParameterSets::run, this );
+
+            }
+
+            /**
+             * The submitted sets are executed before the I/O thread ends.
+             */
+            ~MySqlExtBindParameterSets()
+            {
+
+                {
+
+                    const std::lock_guard<std::mutex> lock( m_mutex );
+                    m_stop = true;
+
+                }
+                m_condition.notify_all();
+                m_ioThread.join();
+
+            }
+
+            MySqlExtBindParameterSets( const MySqlExtBindParameterSets & )             = delete;
+            MySqlExtBindParameterSets & operator=( const MySqlExtBindParameterSets & ) = delete;
+
+            /**
+             * Prepares the statement - see MySqlExtBind::prepareStatement(). Call it before the first submit().
+             *
+             * @return
+             */
+            auto prepareStatement() -> decltype( mysql_stmt_prepare( nullptr, nullptr, 0 ) )
+            {
+
+                return m_slots.front()->fafExtBind.prepareStatement();
+
+            }
+
+            /**
+             * The set to fill next. Waits while the I/O thread still executes it.
+             *
+             * @return
+             */
+            auto parameterSet() -> ParameterSet &
+            {
+
+                Slot & slot = *m_slots [m_fillIndex];
+                waitUntilFree( slot );
+
+                return slot.parameterSet;
+
+            }
+
+            /**
+             * Binds the filled set and hands it to the I/O thread. The next parameterSet() returns the following set.
+             * Exception #4 is thrown here if the binder hasn't assigned all bind variables.
+             */
+            auto submit() -> void
+            {
+
+                Slot & slot = *m_slots [m_fillIndex];
+                waitUntilFree( slot );
+
+                m_binder( slot.fafExtBind, slot.parameterSet );
+                slot.bindArray = slot.fafExtBind.checkedBindArray();
+
+                {
+
+                    const std::lock_guard<std::mutex> lock( m_mutex );
+                    slot.queued = true;
+
+                }
+                m_condition.notify_all();
+
+                m_fillIndex = ( m_fillIndex + 1 ) % m_slots.size();
+
+            }
+
+            /**
+             * Waits until all submitted sets have been executed. Rethrows the first exception of the completion since
+             * the last flush() - the following sets have been executed nevertheless.
+             *
+             * @return The MySQL error code of the first failed set since the last flush() - 0 if all have been executed.
+             */
+            auto flush() -> unsigned int
+            {
+
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_condition.wait( lock, [this]() { return 0 == queuedCount(); } );
+
+                const unsigned int       firstErrorCode      = std::exchange( m_firstErrorCode, 0 );
+                const std::exception_ptr completionException = std::exchange( m_completionException, nullptr );
+
+                if ( nullptr != completionException ) {
+
+                    std::rethrow_exception( completionException );
+
+                }
+
+                return firstErrorCode;
+
+            }
+
+        private:
+
+            using Slot = struct Slot
+            {
+
+                    Slot( MYSQL_STMT * mysqlStatement, std::string_view mysqlCommand ) : fafExtBind( mysqlStatement, mysqlCommand ) {}
+
+                    ParameterSet        parameterSet {};
+                    MySqlExtBind        fafExtBind;
+                    const MYSQL_BIND *  bindArray    {};
+                    // Set by submit(), reset by the I/O thread after the execution. Protected by <m_mutex>.
+                    bool                queued       {};
+
+            };
+
+            auto waitUntilFree( Slot & slot ) -> void
+            {
+
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_condition.wait( lock, [&slot]() { return false == slot.queued; } );
+
+            }
+
+            auto queuedCount() const -> size_t
+            {
+
+                size_t queued {};
+                for ( const auto & slot : m_slots ) {
+
+                    queued += slot->queued ? 1 : 0;
+
+                }
+
+                return queued;
+
+            }
+
+            /**
+             * The I/O thread executes the sets in the order they have been submitted.
+             */
+            auto run() -> void
+            {
+
+                size_t executeIndex {};
+
+                while ( true ) {
+
+                    Slot & slot = *m_slots [executeIndex];
+
+                    {
+
+                        std::unique_lock<std::mutex> lock( m_mutex );
+                        m_condition.wait( lock, [this, &slot]() { return slot.queued || m_stop; } );
+
+                        if ( false == slot.queued ) {
+
+                            return;
+
+                        }
+
+                    }
+
+                    // mysql_stmt_bind_named_param() doesn't change the array - it's the one of the slot's MySqlExtBind.
+                    unsigned int errorCode {};
+                    if ( mysql_stmt_bind_named_param( m_mysqlStatement, const_cast<MYSQL_BIND *>( slot.bindArray ),
+                                                      static_cast<unsigned>( m_bindNamesArray.size() ), m_bindNamesArray.data() ) ||
+                         0 != mysql_stmt_execute( m_mysqlStatement ) ) {
+
+                        errorCode = mysql_stmt_errno( m_mysqlStatement );
+
+                    }
+
+                    std::exception_ptr completionException;
+                    if ( m_completion ) {
+
+                        try {
+
+                            m_completion( slot.parameterSet, errorCode );
+
+                        } catch ( ... ) {
+
+                            // An exception must not end the I/O thread.
+                            completionException = std::current_exception();
+
+                        }
+
+                    }
+
+                    {
+
+                        const std::lock_guard<std::mutex> lock( m_mutex );
+                        slot.queued = false;
+
+                        if ( 0 == m_firstErrorCode ) {
+
+                            m_firstErrorCode = errorCode;
+
+                        }
+                        if ( nullptr == m_completionException ) {
+
+                            m_completionException = completionException;
+
+                        }
+
+                    }
+                    m_condition.notify_all();
+
+                    executeIndex = ( executeIndex + 1 ) % m_slots.size();
+
+                }
+
+            }
+
+            // constructor initialiser list - respect the order.
+
+                MYSQL_STMT *                            m_mysqlStatement;
+                Binder                                  m_binder;
+                Completion                              m_completion;
+
+            std::vector< std::unique_ptr<Slot> >        m_slots;
+            std::vector<const char *>                   m_bindNamesArray;
+            // The set filled by the caller - only used by the caller's thread.
+            size_t                                      m_fillIndex {};
+
+            std::mutex                                  m_mutex;
+            std::condition_variable                     m_condition;
+            bool                                        m_stop      {};
+            // The first failure since the last flush() - protected by <m_mutex>.
+            unsigned int                                m_firstErrorCode {};
+            std::exception_ptr                          m_completionException;
+            std::thread                                 m_ioThread;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,248 @@
+/**
+ * MySqlExtBindPipeline.cpp
+ *
+ * The requests are encoded into one buffer. When <inFlightDepth> requests are queued - or finish() is called -
+ * the buffer is written and the responses are read in the order of the requests. Both are done in one poll loop:
+ * a server which blocks writing responses while the client still writes requests would otherwise deadlock.
+ * The server executes each request on its own: a failing statement doesn't stop the following ones,
+ * and each result belongs to the request at the same position.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindPipeline.h"
+
+#include <cerrno>
+#include <poll.h>
+#include <sys/socket.h>
+
+#include <errmsg.h>
+
+namespace
+{
+
+    // The bytes read from the socket at once.
+    constexpr size_t g_receiveChunk { 65536 };
+
+    auto wouldBlock() -> bool
+    {
+
+        return EAGAIN == errno || EWOULDBLOCK == errno || EINTR == errno;
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * The connection must not be used elsewhere while requests are queued - see MySqlExtBindDirectExecutor
+     * for the requirements of the connection.
+     *
+     * @param mysqlConnection
+     * @param inFlightDepth    The number of requests sent before the responses are read.
+     */
+    MySqlExtBindPipeline::MySqlExtBindPipeline( MYSQL * mysqlConnection, u_int inFlightDepth )
+    :
+        m_mysqlConnection( mysqlConnection ),
+        m_inFlightDepth  ( std::max( 1U, inFlightDepth ) )
+    {
+
+        m_queuedResults.reserve( m_inFlightDepth );
+
+    }
+
+    auto MySqlExtBindPipeline::add( MYSQL_STMT * preparedStatement, MySqlExtBind & boundExtBind ) -> size_t
+    {
+
+        return add( preparedStatement, boundExtBind.checkedBindArray(), boundExtBind.bindVariablesCount() );
+
+    }
+
+    auto MySqlExtBindPipeline::add( MYSQL_STMT * preparedStatement, const BoundRow & boundRow ) -> size_t
+    {
+
+        return add( preparedStatement, boundRow.bindArray(), boundRow.bindVariablesCount() );
+
+    }
+
+    /**
+     * Queues the execution of the prepared statement with the bound values - they are encoded immediately,
+     * so the buffers can be reused. The statement must belong to the connection of the pipeline.
+     *
+     * @param preparedStatement
+     * @param mysqlBindArray
+     * @param bindVariablesCount
+     * @return The index of the result in the vector returned by finish().
+     */
+    auto MySqlExtBindPipeline::add( MYSQL_STMT * preparedStatement, const MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount ) -> size_t
+    {
+
+        MySqlExtBindProtocol::checkDirectExecution( preparedStatement );
+
+        const size_t resultIndex = m_results.size();
+        m_results.emplace_back();
+
+        if ( preparedStatement->mysql != m_mysqlConnection || bindVariablesCount != preparedStatement->param_count ) {
+
+            // Not sent - it fails on its own.
+            m_results.back().errorCode = CR_INVALID_PARAMETER_NO;
+            return resultIndex;
+
+        }
+
+        MySqlExtBindProtocol::encodeExecute( m_sendBuffer, preparedStatement->stmt_id, mysqlBindArray, bindVariablesCount,
+                                             0 != ( m_mysqlConnection->client_flag & CLIENT_QUERY_ATTRIBUTES ) );
+        m_queuedResults.push_back( resultIndex );
+
+        if ( m_queuedResults.size() >= m_inFlightDepth ) {
+
+            flush();
+
+        }
+
+        return resultIndex;
+
+    }
+
+    /**
+     * Sends the queued requests and reads all responses.
+     *
+     * @return The result of each added request in the order of add() - the pipeline is empty afterwards.
+     */
+    auto MySqlExtBindPipeline::finish() -> std::vector<ExecuteResult>
+    {
+
+        flush();
+
+        std::vector<ExecuteResult> results;
+        results.swap( m_results );
+
+        return results;
+
+    }
+
+    /**
+     * Writes the queued requests and reads one response per request. The socket is polled for both, so the responses
+     * are read while the requests are still being written. If the connection is lost, the requests without response
+     * get CR_SERVER_LOST - the server may have executed some of them.
+     */
+    auto MySqlExtBindPipeline::flush() -> void
+    {
+
+        if ( m_queuedResults.empty() ) {
+
+            return;
+
+        }
+
+        const int socket        = m_mysqlConnection->net.fd;
+        size_t    sentBytes     {};
+        size_t    nextResponse  {};
+        bool      connected     { true };
+
+        m_receiveBuffer.clear();
+        m_receiveOffset = 0;
+
+        while ( connected && nextResponse < m_queuedResults.size() ) {
+
+            const bool sending    = sentBytes < m_sendBuffer.size();
+            pollfd     pollSocket { socket, static_cast<short>( POLLIN | ( sending ? POLLOUT : 0 ) ), 0 };
+
+            if ( 0 > poll( &pollSocket, 1, -1 ) ) {
+
+                connected = EINTR == errno;
+                continue;
+
+            }
+
+            if ( sending && 0 != ( pollSocket.revents & POLLOUT ) ) {
+
+                const ssize_t sent = send( socket, m_sendBuffer.data() + sentBytes, m_sendBuffer.size() - sentBytes, MSG_NOSIGNAL | MSG_DONTWAIT );
+
+                if ( 0 < sent ) {
+
+                    sentBytes += static_cast<size_t>( sent );
+
+                } else if ( 0 == sent || false == wouldBlock() ) {
+
+                    // Nothing more is sent - the responses the server has written are read until it closes.
+                    sentBytes = m_sendBuffer.size();
+
+                }
+
+            }
+
+            if ( 0 != ( pollSocket.revents & ( POLLIN | POLLHUP | POLLERR ) ) ) {
+
+                // Drop the packets which have been taken, so the buffer only holds the incomplete one.
+                m_receiveBuffer.erase( m_receiveBuffer.begin(), m_receiveBuffer.begin() + static_cast<ptrdiff_t>( m_receiveOffset ) );
+                m_receiveOffset = 0;
+
+                const size_t  offset   = m_receiveBuffer.size();
+                m_receiveBuffer.resize( offset + g_receiveChunk );
+                const ssize_t received = recv( socket, m_receiveBuffer.data() + offset, g_receiveChunk, MSG_DONTWAIT );
+
+                m_receiveBuffer.resize( offset + static_cast<size_t>( std::max( received, ssize_t {} ) ) );
+
+                if ( 0 == received || ( 0 > received && false == wouldBlock() ) ) {
+
+                    connected = false;
+
+                }
+
+                // The responses received before the connection was lost count.
+                while ( nextResponse < m_queuedResults.size() && takeResponse() ) {
+
+                    MySqlExtBindProtocol::parseResponse( m_response, m_results [m_queuedResults [nextResponse++]] );
+
+                }
+
+            }
+
+        }
+
+        for ( ; nextResponse < m_queuedResults.size(); nextResponse++ ) {
+
+            m_results [m_queuedResults [nextResponse]]           = ExecuteResult {};
+            m_results [m_queuedResults [nextResponse]].errorCode = CR_SERVER_LOST;
+
+        }
+
+        m_sendBuffer.clear();
+        m_queuedResults.clear();
+
+    }
+
+    /**
+     * Moves the next complete packet from the receive buffer to m_response - the parts of a split payload are joined.
+     *
+     * @return False if the packet hasn't been received completely yet.
+     */
+    auto MySqlExtBindPipeline::takeResponse() -> bool
+    {
+
+        const unsigned char * packet        = m_receiveBuffer.data() + m_receiveOffset;
+        size_t                missingLength {};
+        const size_t          packetLength  = MySqlExtBindProtocol::framePacket( packet, m_receiveBuffer.data() + m_receiveBuffer.size(),
+                                                                                 missingLength );
+
+        if ( 0 == packetLength ) {
+
+            return false;
+
+        }
+
+        m_response.resize( packetLength );
+        m_response.resize( MySqlExtBindProtocol::joinParts( packet, packetLength, m_response.data() ) );
+        m_receiveOffset += packetLength;
+
+        return true;
+
+    }
+
+}
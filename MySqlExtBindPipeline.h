@@ -0,0 +1,63 @@
+/**
+ * MySqlExtBindPipeline.h
+ *
+ * Header for the MySqlExtBindPipeline class - sends several COM_STMT_EXECUTE requests back to back on one
+ * connection and reads the responses afterwards, so the connection doesn't wait a round trip per statement.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_PIPELINE_H
+#define FAF_MYSQL_EXT_BIND_PIPELINE_H
+
+#include <vector>
+
+#include "MySqlExtBindProtocol.h"
+
+namespace FaF
+{
+
+    class MySqlExtBindPipeline
+    {
+
+        public:
+
+            MySqlExtBindPipeline( MYSQL * mysqlConnection, u_int inFlightDepth = 16 );
+
+            MySqlExtBindPipeline( const MySqlExtBindPipeline & )             = delete;
+            MySqlExtBindPipeline & operator=( const MySqlExtBindPipeline & ) = delete;
+
+            auto add( MYSQL_STMT * preparedStatement, MySqlExtBind & boundExtBind ) -> size_t;
+            auto add( MYSQL_STMT * preparedStatement, const BoundRow & boundRow )   -> size_t;
+            auto finish()                                                           -> std::vector<ExecuteResult>;
+
+        private:
+
+            auto add( MYSQL_STMT * preparedStatement, const MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount ) -> size_t;
+            auto flush()        -> void;
+            auto takeResponse() -> bool;
+
+            // constructor initialiser list - respect the order.
+
+                MYSQL *                 m_mysqlConnection;
+                u_int                   m_inFlightDepth;
+
+            // The encoded requests which haven't been sent yet and their indexes in <m_results>.
+            std::vector<unsigned char>  m_sendBuffer;
+            std::vector<size_t>         m_queuedResults;
+
+            std::vector<ExecuteResult>  m_results;
+            std::vector<unsigned char>  m_response;
+
+            // The received bytes - the packets before <m_receiveOffset> have been taken.
+            std::vector<unsigned char>  m_receiveBuffer;
+            size_t                      m_receiveOffset {};
+
+    };
+
+}
+
+#endif
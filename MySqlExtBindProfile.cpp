@@ -0,0 +1,226 @@
+/**
+ * MySqlExtBindProfile.cpp
+ *
+ * The profile file is a text file - a header line, then one entry per command, the most executed first:
+ *
+ *   MySqlExtBindProfile 1
+ *   <executions> <length of the command>
+ *   <the command - it may contain line breaks>
+ *
+ * The file is written to a temporary file first and renamed, so a crash while writing leaves the old profile.
+ * A missing or damaged profile isn't an error - the warm-up is skipped and the statements are prepared on demand.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindProfile.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+
+    constexpr std::string_view g_profileHeader { "MySqlExtBindProfile 1" };
+
+    auto sortByExecutions( std::vector<FaF::TemplateUse> & templateUses ) -> void
+    {
+
+        std::sort( templateUses.begin(), templateUses.end(), []( const FaF::TemplateUse & left, const FaF::TemplateUse & right ) {
+
+            return left.executions != right.executions ? left.executions > right.executions : left.mysqlCommand < right.mysqlCommand;
+
+        } );
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * Sums up the executions per command of all caches - call it at shutdown, before the caches are destroyed.
+     *
+     * @param statementCaches
+     * @return The commands, the most executed first.
+     */
+    auto MySqlExtBindProfile::record( const std::vector<const MySqlExtBindStatementCache *> & statementCaches ) -> std::vector<TemplateUse>
+    {
+
+        std::unordered_map<std::string, unsigned long long> executionsByCommand;
+
+        for ( const MySqlExtBindStatementCache * statementCache : statementCaches ) {
+
+            for ( TemplateUse & templateUse : statementCache->templateUses() ) {
+
+                executionsByCommand [std::move( templateUse.mysqlCommand )] += templateUse.executions;
+
+            }
+
+        }
+
+        std::vector<TemplateUse> templateUses;
+        templateUses.reserve( executionsByCommand.size() );
+
+        for ( auto & [mysqlCommand, executions] : executionsByCommand ) {
+
+            templateUses.push_back( TemplateUse { mysqlCommand, executions } );
+
+        }
+
+        sortByExecutions( templateUses );
+
+        return templateUses;
+
+    }
+
+    /**
+     * Writes the profile file - see the description at the top.
+     *
+     * @param profilePath
+     * @param templateUses
+     * @return False if the file couldn't be written.
+     */
+    auto MySqlExtBindProfile::save( const std::string & profilePath, const std::vector<TemplateUse> & templateUses ) -> bool
+    {
+
+        const std::string temporaryPath = profilePath + ".tmp";
+
+        {
+
+            std::ofstream profileFile( temporaryPath, std::ios::binary | std::ios::trunc );
+
+            profileFile << g_profileHeader << '\n';
+            for ( const TemplateUse & templateUse : templateUses ) {
+
+                profileFile << templateUse.executions << ' ' << templateUse.mysqlCommand.length() << '\n' << templateUse.mysqlCommand << '\n';
+
+            }
+
+            if ( false == profileFile.flush().good() ) {
+
+                std::remove( temporaryPath.c_str() );
+                return false;
+
+            }
+
+        }
+
+        return 0 == std::rename( temporaryPath.c_str(), profilePath.c_str() );
+
+    }
+
+    /**
+     * Reads the profile file.
+     *
+     * @param profilePath
+     * @param maxTemplates The number of the most executed commands returned - 0 returns all.
+     * @return The commands, the most executed first. Empty if the file is missing or damaged.
+     */
+    auto MySqlExtBindProfile::load( const std::string & profilePath, size_t maxTemplates ) -> std::vector<TemplateUse>
+    {
+
+        std::vector<TemplateUse> templateUses;
+
+        std::ifstream profileFile( profilePath, std::ios::binary );
+        std::string   header;
+
+        if ( false == std::getline( profileFile, header ).good() || g_profileHeader != header ) {
+
+            return templateUses;
+
+        }
+
+        // A damaged length must not allocate more than the file holds.
+        const std::streampos commandsStart = profileFile.tellg();
+        const std::streamoff fileLength    = profileFile.seekg( 0, std::ios::end ).tellg();
+        profileFile.seekg( commandsStart );
+
+        TemplateUse templateUse;
+        size_t      commandLength {};
+
+        while ( profileFile >> templateUse.executions >> commandLength && '\n' == profileFile.get() ) {
+
+            if ( commandLength > static_cast<size_t>( fileLength - profileFile.tellg() ) ) {
+
+                return {};
+
+            }
+
+            templateUse.mysqlCommand.resize( commandLength );
+            if ( false == profileFile.read( templateUse.mysqlCommand.data(), static_cast<std::streamsize>( commandLength ) ).good() ||
+                 '\n' != profileFile.get() ) {
+
+                return {};
+
+            }
+
+            templateUses.push_back( std::move( templateUse ) );
+
+        }
+
+        if ( false == profileFile.eof() ) {
+
+            return {};
+
+        }
+
+        sortByExecutions( templateUses );
+
+        if ( 0 != maxTemplates && maxTemplates < templateUses.size() ) {
+
+            templateUses.resize( maxTemplates );
+
+        }
+
+        return templateUses;
+
+    }
+
+    /**
+     * Parses and prepares the commands on all connections in parallel - one thread per cache, as each cache
+     * belongs to one connection. The connections must not be used elsewhere until the function returns.
+     *
+     * @param templateUses
+     * @param statementCaches
+     * @return The number of statements prepared on all connections.
+     */
+    auto MySqlExtBindProfile::warmUp( const std::vector<TemplateUse> & templateUses,
+                                      const std::vector<MySqlExtBindStatementCache *> & statementCaches ) -> size_t
+    {
+
+        std::vector<size_t>      preparedCounts( statementCaches.size() );
+        std::vector<std::thread> warmUpThreads;
+        warmUpThreads.reserve( statementCaches.size() );
+
+        for ( size_t index = 0; index < statementCaches.size(); index++ ) {
+
+            warmUpThreads.emplace_back( [&templateUses, &statementCaches, &preparedCounts, index]() {
+
+                preparedCounts [index] = statementCaches [index]->warmUp( templateUses );
+
+            } );
+
+        }
+
+        size_t preparedCount {};
+
+        for ( size_t index = 0; index < warmUpThreads.size(); index++ ) {
+
+            warmUpThreads [index].join();
+            preparedCount += preparedCounts [index];
+
+        }
+
+        return preparedCount;
+
+    }
+
+}
@@ -0,0 +1,40 @@
+/**
+ * MySqlExtBindProfile.h
+ *
+ * Header for the MySqlExtBindProfile class - records the hot commands of the statement caches to a profile file
+ * and prepares them on all connections of a pool before the first request arrives.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_PROFILE_H
+#define FAF_MYSQL_EXT_BIND_PROFILE_H
+
+#include <string>
+#include <vector>
+
+#include "MySqlExtBindStatementCache.h"
+
+namespace FaF
+{
+
+    class MySqlExtBindProfile
+    {
+
+        public:
+
+            static auto record( const std::vector<const MySqlExtBindStatementCache *> & statementCaches ) -> std::vector<TemplateUse>;
+            static auto save( const std::string & profilePath, const std::vector<TemplateUse> & templateUses ) -> bool;
+            static auto load( const std::string & profilePath, size_t maxTemplates = 0 ) -> std::vector<TemplateUse>;
+
+            static auto warmUp( const std::vector<TemplateUse> & templateUses,
+                                const std::vector<MySqlExtBindStatementCache *> & statementCaches ) -> size_t;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,710 @@
+/**
+ * MySqlExtBindProtocol.cpp
+ *
+ * COM_STMT_EXECUTE in the binary protocol:
+ *   int<1>  0x17
+ *   int<4>  statement id
+ *   int<1>  flags - PARAMETER_COUNT_AVAILABLE if CLIENT_QUERY_ATTRIBUTES has been negotiated
+ *   int<4>  iteration count - always 1
+ *   int<lenenc> parameter count - only with CLIENT_QUERY_ATTRIBUTES
+ *   NULL bitmap, (count + 7) / 8 bytes
+ *   int<1>  new params bound flag - always 1, so the types are sent with each packet
+ *   int<2>  type per parameter, 0x8000 for unsigned - with CLIENT_QUERY_ATTRIBUTES followed by an empty name
+ *   the values of the non NULL parameters
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindProtocol.h"
+
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <errmsg.h>
+
+namespace
+{
+
+    constexpr unsigned char g_okPacket  { 0x00 };
+    constexpr unsigned char g_errPacket { 0xFF };
+
+    /**
+     * The value of a fixed size type as an unsigned integer of the same width - floating point numbers keep their bits.
+     *
+     * @param buffer
+     * @param length 1, 2, 4 or 8.
+     * @return
+     */
+    auto hostInteger( const unsigned char * buffer, size_t length ) -> unsigned long long
+    {
+
+        switch ( length ) {
+
+            case 1:
+                return buffer [0];
+
+            case 2: {
+
+                uint16_t value;
+                std::memcpy( &value, buffer, sizeof( value ) );
+                return value;
+
+            }
+
+            case 4: {
+
+                uint32_t value;
+                std::memcpy( &value, buffer, sizeof( value ) );
+                return value;
+
+            }
+
+            default: {
+
+                uint64_t value;
+                std::memcpy( &value, buffer, sizeof( value ) );
+                return value;
+
+            }
+
+        }
+
+    }
+
+    auto readFully( int socket, unsigned char * buffer, size_t length ) -> bool
+    {
+
+        while ( 0 < length ) {
+
+            const ssize_t received = recv( socket, buffer, length, 0 );
+
+            if ( 0 > received && EINTR == errno ) {
+
+                continue;
+
+            }
+            if ( 0 >= received ) {
+
+                return false;
+
+            }
+
+            buffer += received;
+            length -= static_cast<size_t>( received );
+
+        }
+
+        return true;
+
+    }
+
+}
+
+namespace FaF
+{
+
+    auto MySqlExtBindProtocol::appendInteger( std::vector<unsigned char> & packet, unsigned long long value, u_int bytes ) -> void
+    {
+
+        for ( u_int index = 0; index < bytes; index++ ) {
+
+            packet.push_back( static_cast<unsigned char>( value >> ( 8 * index ) ) );
+
+        }
+
+    }
+
+    auto MySqlExtBindProtocol::appendLengthEncoded( std::vector<unsigned char> & packet, unsigned long long value ) -> void
+    {
+
+        if ( 251 > value ) {
+
+            packet.push_back( static_cast<unsigned char>( value ) );
+
+        } else if ( 0x10000 > value ) {
+
+            packet.push_back( 0xFC );
+            appendInteger( packet, value, 2 );
+
+        } else if ( 0x1000000 > value ) {
+
+            packet.push_back( 0xFD );
+            appendInteger( packet, value, 3 );
+
+        } else {
+
+            packet.push_back( 0xFE );
+            appendInteger( packet, value, 8 );
+
+        }
+
+    }
+
+    /**
+     * Reads a length encoded integer into <value> and advances <position>. Nothing at or after <end> is read.
+     *
+     * @param position
+     * @param end
+     * @param value
+     * @return False if the integer doesn't end before <end> - <position> is not changed then.
+     */
+    auto MySqlExtBindProtocol::readLengthEncoded( const unsigned char *& position, const unsigned char * end, unsigned long long & value ) -> bool
+    {
+
+        if ( position >= end ) {
+
+            return false;
+
+        }
+
+        const unsigned char first = *position;
+        const u_int         bytes = 0xFC == first ? 2 : 0xFD == first ? 3 : 0xFE == first ? 8 : 0;
+
+        if ( end - position <= static_cast<ptrdiff_t>( bytes ) ) {
+
+            return false;
+
+        }
+
+        position++;
+
+        if ( 0 == bytes ) {
+
+            value = first;
+            return true;
+
+        }
+
+        value = 0;
+        for ( u_int index = 0; index < bytes; index++ ) {
+
+            value |= static_cast<unsigned long long>( *position++ ) << ( 8 * index );
+
+        }
+
+        return true;
+
+    }
+
+    /**
+     * Appends the COM_STMT_EXECUTE packet to <packet>, so several packets can be sent with one write.
+     * See the description at the top.
+     *
+     * @param packet
+     * @param statementId
+     * @param mysqlBindArray
+     * @param bindVariablesCount
+     * @param queryAttributes    True if CLIENT_QUERY_ATTRIBUTES has been negotiated.
+     */
+    auto MySqlExtBindProtocol::encodeExecute( std::vector<unsigned char> & packet, unsigned long statementId,
+                                              const MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount, bool queryAttributes ) -> void
+    {
+
+        const size_t packetOffset = packet.size();
+        packet.resize( packetOffset + 4 );
+
+        packet.push_back( g_comStmtExecute );
+        appendInteger( packet, statementId, 4 );
+        packet.push_back( queryAttributes ? g_parameterCountAvailable : 0 );
+        appendInteger( packet, 1, 4 );
+
+        if ( queryAttributes ) {
+
+            appendLengthEncoded( packet, bindVariablesCount );
+
+        }
+
+        if ( 0 < bindVariablesCount ) {
+
+            const size_t nullBitmapOffset = packet.size();
+            packet.resize( nullBitmapOffset + ( bindVariablesCount + 7 ) / 8 );
+
+            for ( u_int index = 0; index < bindVariablesCount; index++ ) {
+
+                if ( BoundRow::isNullValue( mysqlBindArray [index] ) ) {
+
+                    packet [nullBitmapOffset + index / 8] |= static_cast<unsigned char>( 1 << ( index % 8 ) );
+
+                }
+
+            }
+
+            packet.push_back( 1 );
+
+            for ( u_int index = 0; index < bindVariablesCount; index++ ) {
+
+                const MYSQL_BIND & mysqlBindItem = mysqlBindArray [index];
+
+                appendInteger( packet, static_cast<unsigned int>( mysqlBindItem.buffer_type ) | ( mysqlBindItem.is_unsigned ? 0x8000U : 0U ), 2 );
+                if ( queryAttributes ) {
+
+                    appendLengthEncoded( packet, 0 );
+
+                }
+
+            }
+
+            for ( u_int index = 0; index < bindVariablesCount; index++ ) {
+
+                if ( false == BoundRow::isNullValue( mysqlBindArray [index] ) ) {
+
+                    appendValue( packet, mysqlBindArray [index] );
+
+                }
+
+            }
+
+        }
+
+        finishPacket( packet, packetOffset );
+
+    }
+
+    /**
+     * Appends the value in the binary protocol format of its type. Strings, decimals and blobs are length encoded.
+     *
+     * @param packet
+     * @param mysqlBindItem
+     */
+    auto MySqlExtBindProtocol::appendValue( std::vector<unsigned char> & packet, const MYSQL_BIND & mysqlBindItem ) -> void
+    {
+
+        const unsigned char * buffer = static_cast<const unsigned char *>( mysqlBindItem.buffer );
+
+        switch ( mysqlBindItem.buffer_type ) {
+
+            case MYSQL_TYPE_TINY:
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_YEAR:
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_INT24:
+            case MYSQL_TYPE_LONGLONG:
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE: {
+
+                // The protocol is little endian - the value is encoded byte by byte, so it doesn't depend on the host.
+                const size_t length = BoundRow::valueLength( mysqlBindItem );
+                appendInteger( packet, hostInteger( buffer, length ), static_cast<u_int>( length ) );
+                break;
+
+            }
+
+            case MYSQL_TYPE_TIME: {
+
+                const MYSQL_TIME & mysqlTime = *reinterpret_cast<const MYSQL_TIME *>( buffer );
+                const bool         hasMicroseconds = 0 != mysqlTime.second_part;
+
+                if ( 0 == mysqlTime.day && 0 == mysqlTime.hour && 0 == mysqlTime.minute && 0 == mysqlTime.second && false == hasMicroseconds ) {
+
+                    packet.push_back( 0 );
+                    break;
+
+                }
+
+                packet.push_back( hasMicroseconds ? 12 : 8 );
+                packet.push_back( mysqlTime.neg ? 1 : 0 );
+                appendInteger( packet, mysqlTime.day, 4 );
+                packet.push_back( static_cast<unsigned char>( mysqlTime.hour ) );
+                packet.push_back( static_cast<unsigned char>( mysqlTime.minute ) );
+                packet.push_back( static_cast<unsigned char>( mysqlTime.second ) );
+                if ( hasMicroseconds ) {
+
+                    appendInteger( packet, mysqlTime.second_part, 4 );
+
+                }
+                break;
+
+            }
+
+            case MYSQL_TYPE_DATE:
+            case MYSQL_TYPE_DATETIME:
+            case MYSQL_TYPE_TIMESTAMP: {
+
+                const MYSQL_TIME & mysqlTime = *reinterpret_cast<const MYSQL_TIME *>( buffer );
+
+                const unsigned char length =
+                    0 != mysqlTime.second_part                                          ? 11 :
+                    0 != mysqlTime.hour || 0 != mysqlTime.minute || 0 != mysqlTime.second ? 7  :
+                    0 != mysqlTime.year || 0 != mysqlTime.month  || 0 != mysqlTime.day    ? 4  : 0;
+
+                packet.push_back( length );
+                if ( 4 <= length ) {
+
+                    appendInteger( packet, mysqlTime.year, 2 );
+                    packet.push_back( static_cast<unsigned char>( mysqlTime.month ) );
+                    packet.push_back( static_cast<unsigned char>( mysqlTime.day ) );
+
+                }
+                if ( 7 <= length ) {
+
+                    packet.push_back( static_cast<unsigned char>( mysqlTime.hour ) );
+                    packet.push_back( static_cast<unsigned char>( mysqlTime.minute ) );
+                    packet.push_back( static_cast<unsigned char>( mysqlTime.second ) );
+
+                }
+                if ( 11 == length ) {
+
+                    appendInteger( packet, mysqlTime.second_part, 4 );
+
+                }
+                break;
+
+            }
+
+            default: {
+
+                const size_t length = BoundRow::valueLength( mysqlBindItem );
+
+                appendLengthEncoded( packet, length );
+                packet.insert( packet.end(), buffer, buffer + length );
+                break;
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Writes the packet header. The payload starts 4 bytes after <packetOffset> - if it's too long for one packet,
+     * it's split and a header is inserted in front of each part.
+     *
+     * @param packet
+     * @param packetOffset
+     */
+    auto MySqlExtBindProtocol::finishPacket( std::vector<unsigned char> & packet, size_t packetOffset ) -> void
+    {
+
+        const size_t payloadLength = packet.size() - packetOffset - 4;
+
+        if ( g_maxPayloadLength > payloadLength ) {
+
+            packet [packetOffset]     = static_cast<unsigned char>( payloadLength );
+            packet [packetOffset + 1] = static_cast<unsigned char>( payloadLength >> 8 );
+            packet [packetOffset + 2] = static_cast<unsigned char>( payloadLength >> 16 );
+            packet [packetOffset + 3] = 0;
+            return;
+
+        }
+
+        std::vector<unsigned char> splitPacket( packet.begin(), packet.begin() + static_cast<ptrdiff_t>( packetOffset ) );
+        splitPacket.reserve( packet.size() + 4 * ( payloadLength / g_maxPayloadLength + 1 ) );
+
+        unsigned char sequenceId {};
+        size_t        offset     { packetOffset + 4 };
+
+        while ( true ) {
+
+            const size_t partLength = std::min( g_maxPayloadLength, packet.size() - offset );
+
+            appendInteger( splitPacket, partLength, 3 );
+            splitPacket.push_back( sequenceId++ );
+            splitPacket.insert( splitPacket.end(), packet.begin() + static_cast<ptrdiff_t>( offset ),
+                                packet.begin() + static_cast<ptrdiff_t>( offset + partLength ) );
+            offset += partLength;
+
+            if ( g_maxPayloadLength > partLength ) {
+
+                break;
+
+            }
+
+        }
+
+        packet.swap( splitPacket );
+
+    }
+
+    /**
+     * Throws an exception if the statement cannot be executed by writing to the socket: if it has a result set
+     * or if the connection uses TLS or compression - both wrap the packets, which are then unreadable for the server.
+     *
+     * @param mysqlStatement
+     */
+    auto MySqlExtBindProtocol::checkDirectExecution( MYSQL_STMT * mysqlStatement ) -> void
+    {
+
+        const MYSQL * mysqlConnection = mysqlStatement->mysql;
+        const bool    compressed      = 0 != ( mysqlConnection->server_capabilities & mysqlConnection->client_flag & CLIENT_COMPRESS );
+
+        if ( 0 != mysql_stmt_field_count( mysqlStatement ) || nullptr != mysql_get_ssl_cipher( mysqlStatement->mysql ) || compressed ) {
+
+            std::cerr
+                << "Exception #8: The statement cannot be executed directly. It must not have a result set and the connection "
+                << "must not use TLS or compression." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+    }
+
+    auto MySqlExtBindProtocol::writePacket( int socket, const std::vector<unsigned char> & packet ) -> bool
+    {
+
+        const unsigned char * buffer = packet.data();
+        size_t                length = packet.size();
+
+        while ( 0 < length ) {
+
+            const ssize_t sent = send( socket, buffer, length, MSG_NOSIGNAL );
+
+            if ( 0 > sent && EINTR == errno ) {
+
+                continue;
+
+            }
+            if ( 0 >= sent ) {
+
+                return false;
+
+            }
+
+            buffer += sent;
+            length -= static_cast<size_t>( sent );
+
+        }
+
+        return true;
+
+    }
+
+    /**
+     * Reads one logical packet - the parts of a split payload are joined.
+     *
+     * @param socket
+     * @param payload
+     * @return False if the connection has been lost.
+     */
+    auto MySqlExtBindProtocol::readPacket( int socket, std::vector<unsigned char> & payload ) -> bool
+    {
+
+        payload.clear();
+
+        while ( true ) {
+
+            size_t       missingLength {};
+            const size_t packetLength  = framePacket( payload.data(), payload.data() + payload.size(), missingLength );
+
+            if ( 0 < packetLength ) {
+
+                // The headers are dropped in place - the payload never overtakes the packet.
+                payload.resize( joinParts( payload.data(), packetLength, payload.data() ) );
+                return true;
+
+            }
+
+            // Exactly the missing header or part is read - the next packet stays in the socket.
+            const size_t offset = payload.size();
+
+            payload.resize( offset + missingLength );
+            if ( false == readFully( socket, payload.data() + offset, missingLength ) ) {
+
+                return false;
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Finds the end of the logical packet which starts at <begin> - the headers of all parts included. Nothing
+     * after <end> is read, so <begin> may point into a receive buffer which holds an incomplete packet.
+     *
+     * @param begin
+     * @param end
+     * @param missingLength The bytes which are missing at least - set if the packet is incomplete.
+     * @return The length of the packet or 0 if it hasn't been received completely yet.
+     */
+    auto MySqlExtBindProtocol::framePacket( const unsigned char * begin, const unsigned char * end, size_t & missingLength ) -> size_t
+    {
+
+        const size_t available = static_cast<size_t>( end - begin );
+        size_t       position  {};
+
+        while ( true ) {
+
+            if ( 4 > available - position ) {
+
+                missingLength = 4 - ( available - position );
+                return 0;
+
+            }
+
+            const size_t partLength = begin [position] | ( begin [position + 1] << 8 ) | ( begin [position + 2] << 16 );
+
+            if ( 4 + partLength > available - position ) {
+
+                missingLength = 4 + partLength - ( available - position );
+                return 0;
+
+            }
+
+            position += 4 + partLength;
+
+            if ( g_maxPayloadLength > partLength ) {
+
+                return position;
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Copies the payloads of the parts of a packet found by framePacket() one after the other to <payload>.
+     * <payload> may be <packet> itself.
+     *
+     * @param packet
+     * @param packetLength
+     * @param payload
+     * @return The length of the payload.
+     */
+    auto MySqlExtBindProtocol::joinParts( const unsigned char * packet, size_t packetLength, unsigned char * payload ) -> size_t
+    {
+
+        size_t position      {};
+        size_t payloadLength {};
+
+        while ( position < packetLength ) {
+
+            const size_t partLength = packet [position] | ( packet [position + 1] << 8 ) | ( packet [position + 2] << 16 );
+
+            std::memmove( payload + payloadLength, packet + position + 4, partLength );
+            position      += 4 + partLength;
+            payloadLength += partLength;
+
+        }
+
+        return payloadLength;
+
+    }
+
+    /**
+     * Parses an OK or ERR packet. Any other packet starts a result set, which is not supported.
+     * A truncated OK packet is reported as CR_MALFORMED_PACKET.
+     *
+     * @param payload
+     * @param executeResult
+     */
+    auto MySqlExtBindProtocol::parseResponse( const std::vector<unsigned char> & payload, ExecuteResult & executeResult ) -> void
+    {
+
+        executeResult = ExecuteResult {};
+
+        if ( payload.empty() ) {
+
+            executeResult.errorCode = CR_SERVER_LOST;
+            return;
+
+        }
+
+        if ( g_okPacket == payload [0] ) {
+
+            const unsigned char * position = payload.data() + 1;
+            const unsigned char * end      = payload.data() + payload.size();
+
+            if ( false == readLengthEncoded( position, end, executeResult.affectedRows ) ||
+                 false == readLengthEncoded( position, end, executeResult.lastInsertId ) ) {
+
+                executeResult           = ExecuteResult {};
+                executeResult.errorCode = CR_MALFORMED_PACKET;
+
+            }
+
+        } else if ( g_errPacket == payload [0] && 3 <= payload.size() ) {
+
+            executeResult.errorCode = payload [1] | ( payload [2] << 8 );
+
+            // The SQL state marker '#' and the 5 characters of the SQL state precede the message.
+            const size_t messageOffset = 3 < payload.size() && '#' == payload [3] ? 9 : 3;
+            if ( messageOffset < payload.size() ) {
+
+                executeResult.errorMessage.assign( payload.begin() + static_cast<ptrdiff_t>( messageOffset ), payload.end() );
+
+            }
+
+        } else {
+
+            executeResult.errorCode = CR_COMMANDS_OUT_OF_SYNC;
+
+        }
+
+    }
+
+    /**
+     * The statement must have been prepared with mysql_stmt_prepare() - for example with MySqlExtBind::prepareStatement().
+     * An exception is thrown if it has a result set or if the connection uses TLS or compression.
+     *
+     * @param preparedStatement
+     */
+    MySqlExtBindDirectExecutor::MySqlExtBindDirectExecutor( MYSQL_STMT * preparedStatement )
+    :
+        m_mysqlStatement( preparedStatement )
+    {
+
+        MySqlExtBindProtocol::checkDirectExecution( m_mysqlStatement );
+
+    }
+
+    auto MySqlExtBindDirectExecutor::execute( MySqlExtBind & boundExtBind ) -> unsigned int
+    {
+
+        return execute( boundExtBind.checkedBindArray(), boundExtBind.bindVariablesCount() );
+
+    }
+
+    auto MySqlExtBindDirectExecutor::execute( const BoundRow & boundRow ) -> unsigned int
+    {
+
+        return execute( boundRow.bindArray(), boundRow.bindVariablesCount() );
+
+    }
+
+    /**
+     * Encodes, sends and waits for the response. result() has the details.
+     *
+     * @param mysqlBindArray
+     * @param bindVariablesCount
+     * @return The MySQL error code - 0 if the statement has been executed.
+     */
+    auto MySqlExtBindDirectExecutor::execute( const MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount ) -> unsigned int
+    {
+
+        if ( bindVariablesCount != m_mysqlStatement->param_count ) {
+
+            m_executeResult           = ExecuteResult {};
+            m_executeResult.errorCode = CR_INVALID_PARAMETER_NO;
+            return m_executeResult.errorCode;
+
+        }
+
+        MYSQL * mysqlConnection = m_mysqlStatement->mysql;
+
+        m_packet.clear();
+        MySqlExtBindProtocol::encodeExecute( m_packet, m_mysqlStatement->stmt_id, mysqlBindArray, bindVariablesCount,
+                                             0 != ( mysqlConnection->client_flag & CLIENT_QUERY_ATTRIBUTES ) );
+
+        if ( false == MySqlExtBindProtocol::writePacket( mysqlConnection->net.fd, m_packet ) ||
+             false == MySqlExtBindProtocol::readPacket( mysqlConnection->net.fd, m_response ) ) {
+
+            m_executeResult           = ExecuteResult {};
+            m_executeResult.errorCode = CR_SERVER_LOST;
+            return m_executeResult.errorCode;
+
+        }
+
+        MySqlExtBindProtocol::parseResponse( m_response, m_executeResult );
+
+        return m_executeResult.errorCode;
+
+    }
+
+}
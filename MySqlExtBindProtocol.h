@@ -0,0 +1,110 @@
+/**
+ * MySqlExtBindProtocol.h
+ *
+ * Header for the MySqlExtBindProtocol class - encodes COM_STMT_EXECUTE packets directly from the MYSQL_BIND
+ * arrays and reads the responses - and for the MySqlExtBindDirectExecutor class which uses it instead of
+ * mysql_stmt_bind_named_param() and mysql_stmt_execute().
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_PROTOCOL_H
+#define FAF_MYSQL_EXT_BIND_PROTOCOL_H
+
+#include <string>
+#include <vector>
+
+#include "MySqlExtBind.h"
+
+namespace FaF
+{
+
+    /**
+     * The result of a statement without result set: the OK or the ERR packet of the server.
+     */
+    using ExecuteResult = struct ExecuteResult
+    {
+
+            unsigned int        errorCode    {};
+            unsigned long long  affectedRows {};
+            unsigned long long  lastInsertId {};
+            std::string         errorMessage;
+
+    };
+
+    /**
+     * The parts of the client/server protocol the extension speaks itself. All functions work on complete packets
+     * including the 4 byte header - payloads of 16 MB and more are split like libmysqlclient does.
+     */
+    class MySqlExtBindProtocol
+    {
+
+        public:
+
+            static constexpr unsigned char g_comStmtExecute        { 0x17 };
+            static constexpr unsigned char g_parameterCountAvailable { 0x08 };
+            // The largest payload of one packet - longer payloads are continued in the next packet.
+            static constexpr size_t        g_maxPayloadLength      { 0xFFFFFF };
+
+            static auto encodeExecute( std::vector<unsigned char> & packet, unsigned long statementId,
+                                       const MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount, bool queryAttributes ) -> void;
+
+            static auto checkDirectExecution( MYSQL_STMT * mysqlStatement ) -> void;
+
+            static auto writePacket( int socket, const std::vector<unsigned char> & packet )  -> bool;
+            static auto readPacket( int socket, std::vector<unsigned char> & payload )         -> bool;
+            static auto framePacket( const unsigned char * begin, const unsigned char * end, size_t & missingLength ) -> size_t;
+            static auto joinParts( const unsigned char * packet, size_t packetLength, unsigned char * payload ) -> size_t;
+            static auto parseResponse( const std::vector<unsigned char> & payload, ExecuteResult & executeResult ) -> void;
+
+            static auto appendInteger( std::vector<unsigned char> & packet, unsigned long long value, u_int bytes ) -> void;
+            static auto appendLengthEncoded( std::vector<unsigned char> & packet, unsigned long long value )      -> void;
+            static auto readLengthEncoded( const unsigned char *& position, const unsigned char * end,
+                                           unsigned long long & value )                                           -> bool;
+
+        private:
+
+            static auto appendValue( std::vector<unsigned char> & packet, const MYSQL_BIND & mysqlBindItem ) -> void;
+            static auto finishPacket( std::vector<unsigned char> & packet, size_t packetOffset )              -> void;
+
+    };
+
+    /**
+     * Executes a prepared statement by writing the COM_STMT_EXECUTE packet to the connection socket and reading
+     * the response - without the MYSQL_BIND marshalling of libmysqlclient. The statement must not have a result set.
+     * The connection must not use TLS or compression and must not be used by another thread at the same time.
+     */
+    class MySqlExtBindDirectExecutor
+    {
+
+        public:
+
+            explicit MySqlExtBindDirectExecutor( MYSQL_STMT * preparedStatement );
+
+            auto execute( MySqlExtBind & boundExtBind ) -> unsigned int;
+            auto execute( const BoundRow & boundRow )   -> unsigned int;
+
+            auto result() const -> const ExecuteResult &              { return m_executeResult; }
+            auto packet() const -> const std::vector<unsigned char> & { return m_packet; }
+
+        private:
+
+            auto execute( const MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount ) -> unsigned int;
+
+            // constructor initialiser list - respect the order.
+
+                MYSQL_STMT *            m_mysqlStatement;
+
+            // Reused for each execution.
+            std::vector<unsigned char>  m_packet;
+            std::vector<unsigned char>  m_response;
+            ExecuteResult               m_executeResult;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,308 @@
+/**
+ * MySqlExtBindQueue.h
+ *
+ * Bounded lock-free queue for many producers and one consumer.
+ * It's the ring buffer of Dmitry Vyukov: each cell has a sequence number which tells the producers and the consumer
+ * whether the cell is free or filled, so a push is one CAS on the enqueue position and a pop needs no atomic RMW at all.
+ * MpscWaitQueue adds the waiting for C++17 code: the idle consumer and the producers of a full queue sleep on a
+ * condition variable, whose mutex is only taken if somebody sleeps.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_QUEUE_H
+#define FAF_MYSQL_EXT_BIND_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace FaF
+{
+
+    template < typename Item >
+    class MpscQueue
+    {
+
+        public:
+
+            /**
+             * The capacity is rounded up to the next power of 2.
+             *
+             * @param capacity
+             */
+            explicit MpscQueue( size_t capacity )
+            {
+
+                size_t roundedCapacity { 2 };
+                while ( roundedCapacity < capacity ) {
+
+                    roundedCapacity *= 2;
+
+                }
+
+                m_cells = std::make_unique<Cell []>( roundedCapacity );
+                m_mask  = roundedCapacity - 1;
+
+                for ( size_t index = 0; index < roundedCapacity; index++ ) {
+
+                    m_cells [index].sequence.store( index, std::memory_order_relaxed );
+
+                }
+
+            }
+
+            MpscQueue( const MpscQueue & )             = delete;
+            MpscQueue & operator=( const MpscQueue & ) = delete;
+
+            /**
+             * Can be called from any thread. Returns false if the queue is full - <item> is not moved in this case.
+             *
+             * @param item
+             * @return
+             */
+            auto tryPush( Item && item ) -> bool
+            {
+
+                size_t position = m_enqueuePosition.load( std::memory_order_relaxed );
+                Cell * cell;
+
+                while ( true ) {
+
+                    cell = &m_cells [position & m_mask];
+
+                    const size_t    sequence   = cell->sequence.load( std::memory_order_acquire );
+                    const ptrdiff_t difference = static_cast<ptrdiff_t>( sequence ) - static_cast<ptrdiff_t>( position );
+
+                    if ( 0 == difference ) {
+
+                        // The cell is free - claim it.
+                        if ( m_enqueuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) ) {
+
+                            break;
+
+                        }
+
+                    } else if ( 0 > difference ) {
+
+                        // The consumer hasn't freed the cell yet - the queue is full.
+                        return false;
+
+                    } else {
+
+                        position = m_enqueuePosition.load( std::memory_order_relaxed );
+
+                    }
+
+                }
+
+                cell->item = std::move( item );
+                cell->sequence.store( position + 1, std::memory_order_release );
+
+                return true;
+
+            }
+
+            /**
+             * Must be called only from the consumer thread. Returns false if the queue is empty.
+             *
+             * @param item
+             * @return
+             */
+            auto tryPop( Item & item ) -> bool
+            {
+
+                Cell * cell = &m_cells [m_dequeuePosition & m_mask];
+
+                const size_t    sequence   = cell->sequence.load( std::memory_order_acquire );
+                const ptrdiff_t difference = static_cast<ptrdiff_t>( sequence ) - static_cast<ptrdiff_t>( m_dequeuePosition + 1 );
+
+                if ( 0 > difference ) {
+
+                    return false;
+
+                }
+
+                item = std::move( cell->item );
+                cell->sequence.store( m_dequeuePosition + m_mask + 1, std::memory_order_release );
+                m_dequeuePosition++;
+
+                return true;
+
+            }
+
+        private:
+
+            struct Cell
+            {
+
+                    std::atomic<size_t> sequence;
+                    Item                item;
+
+            };
+
+            std::unique_ptr<Cell []>            m_cells;
+            size_t                              m_mask {};
+
+            // Producers and the consumer work on different cache lines.
+            alignas( 64 ) std::atomic<size_t>   m_enqueuePosition {};
+            alignas( 64 ) size_t                m_dequeuePosition {};
+
+    };
+
+    /**
+     * An event count: a waiter reads the counter with observe(), checks its condition and sleeps in wait() until
+     * notify() has been called since observe() - a notification in between is never lost. notify() takes the mutex
+     * only if somebody sleeps.
+     */
+    class QueueSignal
+    {
+
+        public:
+
+            auto observe() const -> size_t
+            {
+
+                return m_events.load( std::memory_order_seq_cst );
+
+            }
+
+            auto notify() -> void
+            {
+
+                m_events.fetch_add( 1, std::memory_order_seq_cst );
+
+                // Either the waiter sees the new count or the count of the waiters is seen here.
+                if ( 0 < m_waiters.load( std::memory_order_seq_cst ) ) {
+
+                    const std::lock_guard<std::mutex> lock( m_mutex );
+                    m_condition.notify_all();
+
+                }
+
+            }
+
+            auto wait( size_t observed ) -> void
+            {
+
+                waitUntil( observed, std::chrono::steady_clock::time_point::max() );
+
+            }
+
+            /**
+             * Returns when notify() has been called since <observed> has been read or when <deadline> has passed.
+             *
+             * @param observed
+             * @param deadline
+             */
+            auto waitUntil( size_t observed, std::chrono::steady_clock::time_point deadline ) -> void
+            {
+
+                std::unique_lock<std::mutex> lock( m_mutex );
+                m_waiters.fetch_add( 1, std::memory_order_seq_cst );
+
+                const auto notified = [this, observed]() { return observed != m_events.load( std::memory_order_seq_cst ); };
+
+                if ( std::chrono::steady_clock::time_point::max() == deadline ) {
+
+                    m_condition.wait( lock, notified );
+
+                } else {
+
+                    m_condition.wait_until( lock, deadline, notified );
+
+                }
+
+                m_waiters.fetch_sub( 1, std::memory_order_relaxed );
+
+            }
+
+        private:
+
+            std::atomic<size_t>         m_events  {};
+            std::atomic<size_t>         m_waiters {};
+            std::mutex                  m_mutex;
+            std::condition_variable     m_condition;
+
+    };
+
+    /**
+     * MpscQueue with waiting: push() blocks while the queue is full, the consumer sleeps in wait() or waitUntil()
+     * until an item has been pushed or wake() has been called.
+     */
+    template < typename Item >
+    class MpscWaitQueue
+    {
+
+        public:
+
+            explicit MpscWaitQueue( size_t capacity ) : m_queue( capacity ) {}
+
+            /**
+             * Can be called from any thread. Blocks while the queue is full.
+             *
+             * @param item
+             */
+            auto push( Item && item ) -> void
+            {
+
+                while ( false == m_queue.tryPush( std::move( item ) ) ) {
+
+                    const size_t observed = m_popped.observe();
+
+                    if ( m_queue.tryPush( std::move( item ) ) ) {
+
+                        break;
+
+                    }
+
+                    m_popped.wait( observed );
+
+                }
+
+                m_pushed.notify();
+
+            }
+
+            /**
+             * Must be called only from the consumer thread - call popped() after the items have been taken.
+             *
+             * @param item
+             * @return
+             */
+            auto tryPop( Item & item ) -> bool { return m_queue.tryPop( item ); }
+
+            // Wakes the producers waiting for room - once per drained batch instead of once per item.
+            auto popped() -> void { m_popped.notify(); }
+
+            /**
+             * The consumer reads the state before it drains the queue and passes it to wait() or waitUntil(),
+             * so an item pushed while it was draining wakes it immediately.
+             *
+             * @return
+             */
+            auto observe() const -> size_t { return m_pushed.observe(); }
+
+            auto wait( size_t observed )                                                  -> void { m_pushed.wait( observed ); }
+            auto waitUntil( size_t observed, std::chrono::steady_clock::time_point deadline ) -> void { m_pushed.waitUntil( observed, deadline ); }
+
+            // Wakes the consumer without an item - for example to let it see a stop flag.
+            auto wake() -> void { m_pushed.notify(); }
+
+        private:
+
+            MpscQueue<Item>     m_queue;
+            QueueSignal         m_pushed;
+            QueueSignal         m_popped;
+
+    };
+
+}
+
+#endif
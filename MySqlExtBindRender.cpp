@@ -0,0 +1,328 @@
+/**
+ * MySqlExtBindRender.cpp
+ *
+ * Each '?' outside of quotes and comments is replaced by the SQL literal of its value:
+ *   integers and floating point numbers   as numbers
+ *   dates and times                       quoted, for example '2026-10-17 12:00:00.000001'
+ *   blobs, BIT and GEOMETRY               as hexadecimal literal X'...'
+ *   all other types                       quoted and escaped with mysql_real_escape_string_quote(),
+ *                                         so the character set of the connection is respected
+ *   NULL values                           NULL
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindRender.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+namespace
+{
+
+    auto appendHexLiteral( const unsigned char * value, size_t length, std::string & mysqlCommand ) -> void
+    {
+
+        static constexpr char hexDigits [] { "0123456789ABCDEF" };
+
+        mysqlCommand += "X'";
+        for ( size_t index = 0; index < length; index++ ) {
+
+            mysqlCommand += hexDigits [value [index] >> 4];
+            mysqlCommand += hexDigits [value [index] & 0x0F];
+
+        }
+        mysqlCommand += '\'';
+
+    }
+
+    template < typename Number >
+    auto appendNumber( const void * buffer, std::string & mysqlCommand ) -> void
+    {
+
+        mysqlCommand += std::to_string( *static_cast<const Number *>( buffer ) );
+
+    }
+
+    /**
+     * Appends the date and/or the time in quotes - the microseconds only if they are set.
+     *
+     * @param mysqlTime
+     * @param withDate
+     * @param withTime
+     * @param mysqlCommand
+     */
+    auto appendTime( const MYSQL_TIME & mysqlTime, bool withDate, bool withTime, std::string & mysqlCommand ) -> void
+    {
+
+        char   timeText [64];
+        size_t timeLength {};
+
+        if ( withDate ) {
+
+            timeLength += static_cast<size_t>( std::snprintf( timeText, sizeof( timeText ), "%04u-%02u-%02u",
+                                                              mysqlTime.year, mysqlTime.month, mysqlTime.day ) );
+
+        }
+
+        if ( withTime ) {
+
+            // A TIME value may have days - they are added to the hours.
+            const unsigned long hours = withDate ? mysqlTime.hour : mysqlTime.day * 24UL + mysqlTime.hour;
+
+            timeLength += static_cast<size_t>( std::snprintf( timeText + timeLength, sizeof( timeText ) - timeLength, "%s%s%02lu:%02u:%02u",
+                                                              withDate ? " " : "", ( false == withDate && mysqlTime.neg ) ? "-" : "",
+                                                              hours, mysqlTime.minute, mysqlTime.second ) );
+            if ( 0 != mysqlTime.second_part ) {
+
+                timeLength += static_cast<size_t>( std::snprintf( timeText + timeLength, sizeof( timeText ) - timeLength, ".%06lu",
+                                                                  mysqlTime.second_part ) );
+
+            }
+
+        }
+
+        mysqlCommand += '\'';
+        mysqlCommand.append( timeText, std::min( timeLength, sizeof( timeText ) - 1 ) );
+        mysqlCommand += '\'';
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * Renders the adjusted command of <boundExtBind> with the bound values. All bind variables must have been assigned.
+     *
+     * @param mysqlConnection The character set of the connection is used to escape the strings.
+     * @param boundExtBind
+     * @param mysqlCommand    Replaced by the rendered command.
+     */
+    auto MySqlExtBindRender::render( MYSQL * mysqlConnection, MySqlExtBind & boundExtBind, std::string & mysqlCommand ) -> void
+    {
+
+        const MYSQL_BIND * mysqlBindArray = boundExtBind.checkedBindArray();
+
+        render( mysqlConnection, boundExtBind.adjustedMysqlCommand(), mysqlBindArray, boundExtBind.bindVariablesCount(), mysqlCommand );
+
+    }
+
+    /**
+     * Throws exception #9 if the number of placeholders differs from <bindVariablesCount> or a value has no SQL literal.
+     *
+     * @param mysqlConnection
+     * @param adjustedMysqlCommand
+     * @param mysqlBindArray
+     * @param bindVariablesCount
+     * @param mysqlCommand
+     */
+    auto MySqlExtBindRender::render( MYSQL * mysqlConnection, std::string_view adjustedMysqlCommand, const MYSQL_BIND * mysqlBindArray,
+                                     u_int bindVariablesCount, std::string & mysqlCommand ) -> void
+    {
+
+        mysqlCommand.clear();
+        mysqlCommand.reserve( adjustedMysqlCommand.length() + 16 * bindVariablesCount );
+
+        size_t copiedPosition {};
+        u_int  bindIndex      {};
+        bool   rendered       { true };
+
+        for ( size_t position = findPlaceholder( adjustedMysqlCommand, 0 ); std::string_view::npos != position && rendered;
+              position = findPlaceholder( adjustedMysqlCommand, position + 1 ) ) {
+
+            mysqlCommand.append( adjustedMysqlCommand.substr( copiedPosition, position - copiedPosition ) );
+            copiedPosition = position + 1;
+
+            rendered = bindIndex < bindVariablesCount && appendLiteral( mysqlConnection, mysqlBindArray [bindIndex++], mysqlCommand );
+
+        }
+
+        if ( false == rendered || bindIndex != bindVariablesCount ) {
+
+            std::cerr
+                << "Exception #9: The statement cannot be rendered to SQL. The number of placeholders must match the bind variables "
+                << "and each value must have a SQL literal." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        mysqlCommand.append( adjustedMysqlCommand.substr( copiedPosition ) );
+
+    }
+
+    /**
+     * Appends the SQL literal of the value - see the description at the top.
+     *
+     * @param mysqlConnection
+     * @param mysqlBindItem
+     * @param mysqlCommand
+     * @return False if the value has no SQL literal - NaN and infinity.
+     */
+    auto MySqlExtBindRender::appendLiteral( MYSQL * mysqlConnection, const MYSQL_BIND & mysqlBindItem, std::string & mysqlCommand ) -> bool
+    {
+
+        if ( BoundRow::isNullValue( mysqlBindItem ) ) {
+
+            mysqlCommand += "NULL";
+            return true;
+
+        }
+
+        const void * buffer = mysqlBindItem.buffer;
+
+        switch ( mysqlBindItem.buffer_type ) {
+
+            case MYSQL_TYPE_TINY:
+                mysqlBindItem.is_unsigned ? appendNumber<unsigned char>( buffer, mysqlCommand ) : appendNumber<signed char>( buffer, mysqlCommand );
+                break;
+
+            case MYSQL_TYPE_SHORT:
+            case MYSQL_TYPE_YEAR:
+                mysqlBindItem.is_unsigned ? appendNumber<unsigned short>( buffer, mysqlCommand ) : appendNumber<short>( buffer, mysqlCommand );
+                break;
+
+            case MYSQL_TYPE_LONG:
+            case MYSQL_TYPE_INT24:
+                mysqlBindItem.is_unsigned ? appendNumber<unsigned int>( buffer, mysqlCommand ) : appendNumber<int>( buffer, mysqlCommand );
+                break;
+
+            case MYSQL_TYPE_LONGLONG:
+                mysqlBindItem.is_unsigned ? appendNumber<unsigned long long>( buffer, mysqlCommand ) : appendNumber<long long>( buffer, mysqlCommand );
+                break;
+
+            case MYSQL_TYPE_FLOAT:
+            case MYSQL_TYPE_DOUBLE: {
+
+                const double value = MYSQL_TYPE_FLOAT == mysqlBindItem.buffer_type ? *static_cast<const float *>( buffer )
+                                                                                   : *static_cast<const double *>( buffer );
+                if ( false == std::isfinite( value ) ) {
+
+                    return false;
+
+                }
+
+                // Enough digits to read the same value back.
+                char numberText [32];
+                const int numberLength = std::snprintf( numberText, sizeof( numberText ), "%.*g",
+                                                        MYSQL_TYPE_FLOAT == mysqlBindItem.buffer_type ? 9 : 17, value );
+                mysqlCommand.append( numberText, static_cast<size_t>( numberLength ) );
+                // Without exponent the literal would be a DECIMAL.
+                if ( nullptr == std::strpbrk( numberText, "eE" ) ) {
+
+                    mysqlCommand += "E0";
+
+                }
+                break;
+
+            }
+
+            case MYSQL_TYPE_DATE:
+                appendTime( *static_cast<const MYSQL_TIME *>( buffer ), true, false, mysqlCommand );
+                break;
+
+            case MYSQL_TYPE_DATETIME:
+            case MYSQL_TYPE_TIMESTAMP:
+                appendTime( *static_cast<const MYSQL_TIME *>( buffer ), true, true, mysqlCommand );
+                break;
+
+            case MYSQL_TYPE_TIME:
+                appendTime( *static_cast<const MYSQL_TIME *>( buffer ), false, true, mysqlCommand );
+                break;
+
+            case MYSQL_TYPE_TINY_BLOB:
+            case MYSQL_TYPE_MEDIUM_BLOB:
+            case MYSQL_TYPE_LONG_BLOB:
+            case MYSQL_TYPE_BLOB:
+            case MYSQL_TYPE_BIT:
+            case MYSQL_TYPE_GEOMETRY:
+                appendHexLiteral( static_cast<const unsigned char *>( buffer ), BoundRow::valueLength( mysqlBindItem ), mysqlCommand );
+                break;
+
+            default: {
+
+                const size_t length       = BoundRow::valueLength( mysqlBindItem );
+                const size_t quotedOffset = mysqlCommand.length();
+
+                mysqlCommand.resize( quotedOffset + 2 * length + 3 );
+                mysqlCommand [quotedOffset] = '\'';
+
+                const unsigned long escapedLength = mysql_real_escape_string_quote( mysqlConnection, &mysqlCommand [quotedOffset + 1],
+                                                                                    static_cast<const char *>( buffer ), length, '\'' );
+                if ( static_cast<unsigned long>( -1 ) == escapedLength ) {
+
+                    mysqlCommand.resize( quotedOffset );
+                    appendHexLiteral( static_cast<const unsigned char *>( buffer ), length, mysqlCommand );
+                    break;
+
+                }
+
+                mysqlCommand.resize( quotedOffset + 1 + escapedLength );
+                mysqlCommand += '\'';
+                break;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    /**
+     * Returns the position of the next '?' at or after <position> outside of quotes and comments.
+     *
+     * @param adjustedMysqlCommand
+     * @param position
+     * @return std::string_view::npos if there is none.
+     */
+    auto MySqlExtBindRender::findPlaceholder( std::string_view adjustedMysqlCommand, size_t position ) -> size_t
+    {
+
+        while ( position < adjustedMysqlCommand.length() ) {
+
+            const char character = adjustedMysqlCommand [position];
+
+            if ( '?' == character ) {
+
+                return position;
+
+            }
+
+            if ( '\'' == character || '"' == character || '`' == character ) {
+
+                for ( position++; position < adjustedMysqlCommand.length() && character != adjustedMysqlCommand [position]; position++ ) {
+
+                    if ( '\\' == adjustedMysqlCommand [position] && '`' != character ) {
+
+                        position++;
+
+                    }
+
+                }
+
+            } else if ( 0 == adjustedMysqlCommand.compare( position, 2, "/*" ) ) {
+
+                position = std::min( adjustedMysqlCommand.find( "*/", position + 2 ), adjustedMysqlCommand.length() ) + 1;
+
+            } else if ( '#' == character || 0 == adjustedMysqlCommand.compare( position, 3, "-- " ) ) {
+
+                position = std::min( adjustedMysqlCommand.find( '\n', position ), adjustedMysqlCommand.length() );
+
+            }
+
+            position++;
+
+        }
+
+        return std::string_view::npos;
+
+    }
+
+}
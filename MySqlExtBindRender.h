@@ -0,0 +1,43 @@
+/**
+ * MySqlExtBindRender.h
+ *
+ * Header for the MySqlExtBindRender class - renders a statement with its bound values to a plain SQL command,
+ * for the client calls which take SQL text instead of a prepared statement.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_RENDER_H
+#define FAF_MYSQL_EXT_BIND_RENDER_H
+
+#include <string>
+#include <string_view>
+
+#include "MySqlExtBind.h"
+
+namespace FaF
+{
+
+    class MySqlExtBindRender
+    {
+
+        public:
+
+            static auto render( MYSQL * mysqlConnection, MySqlExtBind & boundExtBind, std::string & mysqlCommand ) -> void;
+            static auto render( MYSQL * mysqlConnection, std::string_view adjustedMysqlCommand, const MYSQL_BIND * mysqlBindArray,
+                                u_int bindVariablesCount, std::string & mysqlCommand ) -> void;
+
+            static auto appendLiteral( MYSQL * mysqlConnection, const MYSQL_BIND & mysqlBindItem, std::string & mysqlCommand ) -> bool;
+
+        private:
+
+            static auto findPlaceholder( std::string_view adjustedMysqlCommand, size_t position ) -> size_t;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,897 @@
+/**
+ * MySqlExtBindShapes.cpp
+ *
+ * Placeholders cannot stand in for identifiers, so a table or column name which changes at runtime needs its own
+ * command. An identifier placeholder has an '@' after the left delimiter:
+ *
+ *   SELECT * FROM :@table WHERE id = :id
+ *
+ * The command is lexed once - the value placeholders are recognised with the current delimiters, like MySqlExtBind
+ * does. The identifiers are checked and quoted with backticks. Each combination of identifiers is a shape: its
+ * command is put into the statement cache with a MySqlExtBind built from the lexed segments, so it's not parsed again.
+ * At most <maxShapes> shapes are kept - the least recently used one is released from the cache.
+ *
+ * An optional fragment is enclosed in '[[' and ']]' and has at least one value placeholder. It's only included
+ * if its placeholders have been assigned with assignBindData() of this class:
+ *
+ *   SELECT * FROM customers WHERE 1 = 1 [[ AND city = :city ]] [[ AND age >= :minAge AND age <= :maxAge ]]
+ *
+ * The included fragments are a bitmask - with the identifiers it's the key of the shape. The values assigned to this
+ * class are copied into the statement of the shape by statement().
+ *
+ * For a partial UPDATE each item of the SET clause is a fragment, so only the assigned columns are set:
+ *
+ *   UPDATE customers SET name = :name, city = :city, updated = NOW() WHERE id = :id
+ *
+ * An item without placeholders is always set. The commas are added between the included items.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindShapes.h"
+
+#include <algorithm>
+#include <cctype>
+#include <regex>
+
+namespace
+{
+
+    // The limit of MySQL for table and column names.
+    constexpr size_t g_maxIdentifierCharacters { 64 };
+    constexpr size_t g_maxFragments            { 64 };
+
+    constexpr std::string_view g_fragmentStart { "[[" };
+    constexpr std::string_view g_fragmentEnd   { "]]" };
+    constexpr std::string_view g_blanks        { " \t\r\n" };
+    constexpr std::string_view g_listSeparator { ", " };
+
+    using SetClause = struct SetClause
+    {
+
+            // The command up to the first item and from the end of the last item on.
+            std::string_view                prefix;
+            std::vector<std::string_view>   items;
+            std::string_view                suffix;
+
+    };
+
+    auto trim( std::string_view text ) -> std::string_view
+    {
+
+        const size_t first = text.find_first_not_of( g_blanks );
+
+        if ( std::string_view::npos == first ) {
+
+            return {};
+
+        }
+
+        return text.substr( first, text.find_last_not_of( g_blanks ) - first + 1 );
+
+    }
+
+    auto wordCharacter( char character ) -> bool
+    {
+
+        return std::isalnum( static_cast<unsigned char>( character ) ) || '_' == character;
+
+    }
+
+    /**
+     * True if the upper case <keyword> is a whole word at <position> - case-insensitive.
+     *
+     * @param mysqlCommand
+     * @param position
+     * @param keyword
+     * @return
+     */
+    auto keywordAt( std::string_view mysqlCommand, size_t position, std::string_view keyword ) -> bool
+    {
+
+        if ( position + keyword.length() > mysqlCommand.length() || ( 0 < position && wordCharacter( mysqlCommand [position - 1] ) ) ) {
+
+            return false;
+
+        }
+
+        for ( size_t index = 0; index < keyword.length(); index++ ) {
+
+            if ( keyword [index] != std::toupper( static_cast<unsigned char>( mysqlCommand [position + index] ) ) ) {
+
+                return false;
+
+            }
+
+        }
+
+        return position + keyword.length() == mysqlCommand.length() || false == wordCharacter( mysqlCommand [position + keyword.length()] );
+
+    }
+
+    /**
+     * Returns the position of the last character of the placeholder or comment which starts at <position> - <position>
+     * if none starts there. Placeholders are matched by <placeholderRegex> with the current delimiters, comments are
+     * #, -- and C style.
+     *
+     * @param mysqlCommand
+     * @param position
+     * @param placeholderRegex
+     * @return
+     */
+    auto skipToken( std::string_view mysqlCommand, size_t position, const std::regex & placeholderRegex ) -> size_t
+    {
+
+        const std::string_view rest = mysqlCommand.substr( position );
+        std::cmatch            placeholderMatch;
+
+        if ( std::regex_search( rest.data(), rest.data() + rest.length(), placeholderMatch, placeholderRegex, std::regex_constants::match_continuous ) &&
+             0 < placeholderMatch.length( 0 ) ) {
+
+            return position + static_cast<size_t>( placeholderMatch.length( 0 ) ) - 1;
+
+        }
+
+        if ( '#' == rest [0] || ( 0 == rest.rfind( "--", 0 ) && ( 2 == rest.length() || std::isspace( static_cast<unsigned char>( rest [2] ) ) ) ) ) {
+
+            return std::min( mysqlCommand.find( '\n', position ), mysqlCommand.length() - 1 );
+
+        }
+
+        if ( 0 == rest.rfind( "/*", 0 ) ) {
+
+            const size_t commentEnd = mysqlCommand.find( "*/", position + 2 );
+
+            return std::string_view::npos == commentEnd ? mysqlCommand.length() - 1 : commentEnd + 1;
+
+        }
+
+        return position;
+
+    }
+
+    /**
+     * Splits the SET clause of an UPDATE into its items at the commas outside of parentheses and quotes.
+     * The clause ends before WHERE, ORDER BY or LIMIT - placeholders like :limit and comments are skipped.
+     *
+     * @param mysqlCommand
+     * @param placeholderRegex
+     * @param setClause
+     * @return False if the command is no UPDATE with a SET clause or an item is empty.
+     */
+    auto splitSetClause( std::string_view mysqlCommand, const std::regex & placeholderRegex, SetClause & setClause ) -> bool
+    {
+
+        size_t position = mysqlCommand.find_first_not_of( g_blanks );
+
+        if ( std::string_view::npos == position || false == keywordAt( mysqlCommand, position, "UPDATE" ) ) {
+
+            return false;
+
+        }
+
+        size_t depth     {};
+        size_t itemStart { std::string_view::npos };
+
+        for ( ; position < mysqlCommand.length(); position++ ) {
+
+            const char   character = mysqlCommand [position];
+            const size_t tokenEnd  = skipToken( mysqlCommand, position, placeholderRegex );
+
+            if ( tokenEnd != position ) {
+
+                position = tokenEnd;
+                continue;
+
+            }
+
+            if ( '\'' == character || '"' == character || '`' == character ) {
+
+                // A doubled quote ends the text and starts a new one - a backslash escapes the quote in strings.
+                for ( position++; position < mysqlCommand.length() && character != mysqlCommand [position]; position++ ) {
+
+                    position += '\\' == mysqlCommand [position] && '`' != character ? 1 : 0;
+
+                }
+                continue;
+
+            }
+
+            depth += '(' == character ? 1 : 0;
+            depth -= ')' == character && 0 != depth ? 1 : 0;
+
+            if ( 0 != depth ) {
+
+                continue;
+
+            }
+
+            if ( std::string_view::npos == itemStart ) {
+
+                if ( keywordAt( mysqlCommand, position, "SET" ) ) {
+
+                    position += 2;
+                    itemStart = position + 1;
+
+                }
+
+            } else if ( ',' == character ) {
+
+                setClause.items.push_back( trim( mysqlCommand.substr( itemStart, position - itemStart ) ) );
+                itemStart = position + 1;
+
+            } else if ( keywordAt( mysqlCommand, position, "WHERE" ) || keywordAt( mysqlCommand, position, "ORDER" ) ||
+                        keywordAt( mysqlCommand, position, "LIMIT" ) ) {
+
+                break;
+
+            }
+
+        }
+
+        if ( std::string_view::npos == itemStart ) {
+
+            return false;
+
+        }
+
+        setClause.items.push_back( trim( mysqlCommand.substr( itemStart, std::min( position, mysqlCommand.length() ) - itemStart ) ) );
+
+        for ( const std::string_view setItem : setClause.items ) {
+
+            if ( setItem.empty() ) {
+
+                return false;
+
+            }
+
+        }
+
+        const std::string_view & lastItem = setClause.items.back();
+
+        setClause.prefix = mysqlCommand.substr( 0, static_cast<size_t>( setClause.items.front().data() - mysqlCommand.data() ) );
+        setClause.suffix = mysqlCommand.substr( static_cast<size_t>( lastItem.data() + lastItem.length() - mysqlCommand.data() ) );
+
+        return true;
+
+    }
+
+    /**
+     * Letters, digits, '_', '$' and UTF-8 encoded characters - no quotes, blanks or dots.
+     *
+     * @param identifier
+     * @return
+     */
+    auto validIdentifier( std::string_view identifier ) -> bool
+    {
+
+        size_t charactersCount {};
+
+        for ( const char identifierByte : identifier ) {
+
+            const unsigned char character = static_cast<unsigned char>( identifierByte );
+
+            if ( false == ( std::isalnum( character ) || '_' == character || '$' == character || 0x80 <= character ) ) {
+
+                return false;
+
+            }
+
+            // UTF-8 continuation bytes don't start a character.
+            charactersCount += 0x80 != ( character & 0xC0 ) ? 1 : 0;
+
+        }
+
+        return 0 < charactersCount && g_maxIdentifierCharacters >= charactersCount;
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * Lexes the command - see the description at the top. The statement cache must exist longer than this instance.
+     * Throws exception #1 or #2 like the MySqlExtBind constructor if the delimiters don't work, and exception #17
+     * if <partialUpdate> is set for a command which is no UPDATE.
+     *
+     * @param statementCache
+     * @param mysqlCommand
+     * @param maxShapes
+     * @param partialUpdate  The items of the SET clause are optional fragments.
+     */
+    MySqlExtBindShapes::MySqlExtBindShapes( MySqlExtBindStatementCache & statementCache, std::string_view mysqlCommand, size_t maxShapes,
+                                            bool partialUpdate )
+    :
+        m_statementCache( statementCache ),
+        m_mysqlCommand  ( mysqlCommand ),
+        m_maxShapes     ( std::max<size_t>( 1, maxShapes ) ),
+        m_partialUpdate ( partialUpdate )
+    {
+
+        lexMysqlCommand();
+
+    }
+
+    MySqlExtBindShapes::~MySqlExtBindShapes()
+    {
+
+        for ( Shape & shape : m_shapes ) {
+
+            m_statementCache.release( *shape.fafExtBind );
+
+        }
+
+    }
+
+    /**
+     * Sets the identifier for the placeholder - it stays assigned for the next statements.
+     * Throws exception #15 if the command has no such placeholder or the identifier isn't valid.
+     *
+     * @param identifierName
+     * @param identifier
+     */
+    auto MySqlExtBindShapes::assignIdentifier( std::string_view identifierName, std::string_view identifier ) -> void
+    {
+
+        const auto foundName = std::find( m_identifierNames.begin(), m_identifierNames.end(), identifierName );
+
+        if ( m_identifierNames.end() == foundName ) {
+
+            throwIdentifierException( "the command has no identifier placeholder '" + std::string( identifierName ) + "'" );
+
+        }
+
+        if ( false == validIdentifier( identifier ) ) {
+
+            throwIdentifierException( "'" + std::string( identifier ) + "' is no valid identifier for '" + std::string( identifierName ) +
+                                      "' - only letters, digits, '_' and '$' are allowed, at most 64 characters" );
+
+        }
+
+        const size_t identifierIndex = static_cast<size_t>( foundName - m_identifierNames.begin() );
+
+        m_identifiers         [identifierIndex].assign( identifier );
+        m_assignedIdentifiers [identifierIndex] = true;
+
+    }
+
+    /**
+     * Assigns the value for the placeholder - see MySqlExtBind::assignBindData(). The optional fragments with the
+     * placeholder are included in the next statement(). Throws exception #3 if the command has no such placeholder.
+     *
+     * @param bindVariable
+     * @param originalMysqlBindItem
+     */
+    auto MySqlExtBindShapes::assignBindData( std::string_view bindVariable, const MYSQL_BIND & originalMysqlBindItem ) -> void
+    {
+
+        const auto foundName = std::find( m_valueNames.begin(), m_valueNames.end(), bindVariable );
+
+        if ( m_valueNames.end() == foundName ) {
+
+            using namespace std::string_literals;
+
+            std::cerr
+                << "Exception #3: Bind variable ["s + std::string( bindVariable ) + "] not found. Mostly a typo or an incorrect delimiters."s
+                << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        const size_t valueIndex = static_cast<size_t>( foundName - m_valueNames.begin() );
+
+        m_values         [valueIndex] = originalMysqlBindItem;
+        m_assignedValues [valueIndex] = true;
+
+    }
+
+    auto MySqlExtBindShapes::assignBindData(
+            std::string_view bindVariable,
+            decltype( MYSQL_BIND::buffer_type ) buffer_type,
+            decltype( MYSQL_BIND::buffer      ) buffer,
+            decltype( MYSQL_BIND::length      ) length,
+            decltype( MYSQL_BIND::is_null     ) is_null
+    ) -> void
+    {
+
+        MYSQL_BIND mysqlBindItem {};
+
+        mysqlBindItem.buffer_type = buffer_type;
+        mysqlBindItem.buffer      = buffer;
+        mysqlBindItem.length      = length;
+        mysqlBindItem.is_null     = is_null;
+
+        assignBindData( bindVariable, mysqlBindItem );
+
+    }
+
+    /**
+     * Returns the statement of the assigned identifiers and the included fragments from the statement cache, with the
+     * values assigned to this class - assign the others and execute it with MySqlExtBindStatementCache::execute().
+     * The reference is valid until <maxShapes> other shapes have been used. The assigned values are reset in any case.
+     * Throws exception #15 if an identifier hasn't been assigned, #16 if only a part of a fragment has been assigned
+     * and #17 if a partial UPDATE has no column to set.
+     *
+     * @return
+     */
+    auto MySqlExtBindShapes::statement() -> MySqlExtBind &
+    {
+
+        unsigned long long fragmentsMask {};
+
+        try {
+
+            fragmentsMask = includedFragments();
+
+            m_shapeKey.assign( reinterpret_cast<const char *>( &fragmentsMask ), sizeof( fragmentsMask ) );
+
+            // The identifiers cannot contain a '\0', so it separates them.
+            for ( size_t index = 0; index < m_identifiers.size(); index++ ) {
+
+                if ( false == m_assignedIdentifiers [index] ) {
+
+                    throwIdentifierException( "no identifier has been assigned to '" + std::string( m_identifierNames [index] ) + "'" );
+
+                }
+
+                m_shapeKey.append( m_identifiers [index] ).push_back( '\0' );
+
+            }
+
+        } catch ( ... ) {
+
+            std::fill( m_assignedValues.begin(), m_assignedValues.end(), false );
+            throw;
+
+        }
+
+        const auto     foundShape = m_shapeIndexes.find( m_shapeKey );
+        MySqlExtBind * fafExtBind {};
+
+        if ( m_shapeIndexes.end() == foundShape ) {
+
+            fafExtBind = &buildShape( fragmentsMask );
+
+        } else {
+
+            m_shapes.splice( m_shapes.begin(), m_shapes, foundShape->second );
+            fafExtBind = foundShape->second->fafExtBind;
+
+        }
+
+        // A placeholder of an excluded fragment is never assigned, so all assigned ones are in the shape.
+        for ( size_t index = 0; index < m_valueNames.size(); index++ ) {
+
+            if ( m_assignedValues [index] ) {
+
+                fafExtBind->assignBindData( m_valueNames [index], m_values [index] );
+                m_assignedValues [index] = false;
+
+            }
+
+        }
+
+        return *fafExtBind;
+
+    }
+
+    /**
+     * Splits the command into text, value placeholders, identifier placeholders and fragment markers.
+     * Throws exception #16 if the fragments are not well formed.
+     */
+    auto MySqlExtBindShapes::lexMysqlCommand() -> void
+    {
+
+        const auto [leftDelimiter, rightDelimiter] = MySqlExtBind::delimiters();
+
+        const std::string resolvedPattern {
+            std::string( leftDelimiter ) +
+            R"~((@?)(\w+))~" +
+            std::string( rightDelimiter )
+                                          };
+
+        bool valuePlaceholderFound {};
+        bool fragmentOpen          {};
+
+        // Splits the text at the fragment markers.
+        const auto addText = [this, &fragmentOpen]( std::string_view text ) {
+
+            while ( false == text.empty() ) {
+
+                const size_t markerPosition = std::min( text.find( g_fragmentStart ), text.find( g_fragmentEnd ) );
+
+                if ( 0 != markerPosition ) {
+
+                    m_segments.push_back( Segment { SegmentType::text, text.substr( 0, markerPosition ), {} } );
+
+                }
+
+                if ( std::string_view::npos == markerPosition ) {
+
+                    return;
+
+                }
+
+                if ( 0 == text.compare( markerPosition, g_fragmentStart.length(), g_fragmentStart ) ) {
+
+                    if ( fragmentOpen ) {
+
+                        throwFragmentException( "a fragment cannot contain another fragment" );
+
+                    }
+
+                    if ( g_maxFragments == m_fragments.size() ) {
+
+                        throwFragmentException( "a command can have at most 64 fragments" );
+
+                    }
+
+                    m_segments.push_back( Segment { SegmentType::fragmentStart, {}, {}, m_fragments.size() } );
+                    m_fragments.emplace_back();
+                    fragmentOpen = true;
+
+                } else {
+
+                    if ( false == fragmentOpen ) {
+
+                        throwFragmentException( "']]' has no '[['" );
+
+                    }
+
+                    if ( m_fragments.back().valueIndexes.empty() ) {
+
+                        throwFragmentException( "a fragment needs a value placeholder" );
+
+                    }
+
+                    m_segments.push_back( Segment { SegmentType::fragmentEnd, {}, {}, m_fragments.size() - 1 } );
+                    fragmentOpen = false;
+
+                }
+
+                text.remove_prefix( markerPosition + g_fragmentStart.length() );
+
+            }
+
+        };
+
+        try {
+
+            const std::regex regexPattern( resolvedPattern );
+
+            // Lexes a part of the command - the segments point into m_mysqlCommand.
+            const auto lexPart = [this, &regexPattern, &addText, &fragmentOpen, &valuePlaceholderFound]( std::string_view mysqlCommandPart ) {
+
+                std::cregex_iterator currentRegexMatch( mysqlCommandPart.data(), mysqlCommandPart.data() + mysqlCommandPart.length(), regexPattern );
+                std::cregex_iterator endMarker;
+
+                size_t copiedPosition {};
+
+                for ( ; currentRegexMatch != endMarker; currentRegexMatch++ ) {
+
+                    const size_t           matchPosition = static_cast<size_t>( currentRegexMatch->position( 0 ) );
+                    const size_t           matchLength   = static_cast<size_t>( currentRegexMatch->length  ( 0 ) );
+                    const std::string_view matchedName   = mysqlCommandPart.substr( static_cast<size_t>( currentRegexMatch->position( 2 ) ),
+                                                                                    static_cast<size_t>( currentRegexMatch->length  ( 2 ) ) );
+
+                    addText( mysqlCommandPart.substr( copiedPosition, matchPosition - copiedPosition ) );
+
+                    // The value and the identifier names are kept in the order of their first use.
+                    std::vector<std::string_view> & placeholderNames = 0 == currentRegexMatch->length( 1 ) ? m_valueNames : m_identifierNames;
+
+                    const auto   foundName        = std::find( placeholderNames.begin(), placeholderNames.end(), matchedName );
+                    const size_t placeholderIndex = static_cast<size_t>( foundName - placeholderNames.begin() );
+
+                    if ( placeholderNames.end() == foundName ) {
+
+                        placeholderNames.push_back( matchedName );
+
+                    }
+
+                    if ( 0 == currentRegexMatch->length( 1 ) ) {
+
+                        m_segments.push_back( Segment { SegmentType::value, mysqlCommandPart.substr( matchPosition, matchLength ), matchedName, placeholderIndex } );
+                        valuePlaceholderFound = true;
+
+                        if ( fragmentOpen ) {
+
+                            std::vector<size_t> & valueIndexes = m_fragments.back().valueIndexes;
+
+                            if ( valueIndexes.end() == std::find( valueIndexes.begin(), valueIndexes.end(), placeholderIndex ) ) {
+
+                                valueIndexes.push_back( placeholderIndex );
+
+                            }
+
+                        }
+
+                    } else {
+
+                        m_segments.push_back( Segment { SegmentType::identifier, matchedName, {}, placeholderIndex } );
+
+                    }
+
+                    copiedPosition = matchPosition + matchLength;
+
+                }
+
+                addText( mysqlCommandPart.substr( std::min( copiedPosition, mysqlCommandPart.length() ) ) );
+
+            };
+
+            SetClause setClause;
+
+            if ( false == m_partialUpdate ) {
+
+                lexPart( m_mysqlCommand );
+
+            } else if ( splitSetClause( m_mysqlCommand, regexPattern, setClause ) ) {
+
+                // Each item of the SET clause is a fragment - the separators are added between the included items.
+                lexPart( setClause.prefix );
+                m_segments.push_back( Segment { SegmentType::listStart, {}, {} } );
+
+                for ( size_t index = 0; index < setClause.items.size(); index++ ) {
+
+                    if ( g_maxFragments == m_fragments.size() ) {
+
+                        throwFragmentException( "a command can have at most 64 fragments" );
+
+                    }
+
+                    if ( 0 != index ) {
+
+                        m_segments.push_back( Segment { SegmentType::listSeparator, {}, {} } );
+
+                    }
+
+                    m_segments.push_back( Segment { SegmentType::fragmentStart, {}, {}, m_fragments.size() } );
+                    m_fragments.push_back( Fragment { {}, true } );
+                    fragmentOpen = true;
+
+                    lexPart( setClause.items [index] );
+
+                    m_segments.push_back( Segment { SegmentType::fragmentEnd, {}, {}, m_fragments.size() - 1 } );
+                    fragmentOpen = false;
+
+                }
+
+                m_segments.push_back( Segment { SegmentType::listEnd, {}, {} } );
+                lexPart( setClause.suffix );
+
+            } else {
+
+                throwPartialUpdateException( "the command is no UPDATE with a SET clause" );
+
+            }
+
+        } catch ( std::regex_error const & ) {
+
+            // A fatal regex error - the delimiters are nonsense.
+            std::cerr << "Exception #2. Regex failed. Check the delimiters and if characters have been correctly escaped." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        if ( fragmentOpen ) {
+
+            throwFragmentException( "'[[' has no ']]'" );
+
+        }
+
+        if ( false == valuePlaceholderFound && m_identifierNames.empty() ) {
+
+            std::cerr
+                << "Exception #1: No bind variable has been found with the provided delimiters. "         << std::endl
+                << " 1) Check the delimiters. Have the characters been correctly escaped?"  << std::endl
+                << " 2) Are the bind variables between the delimiters?"                     << std::endl
+                << " 3) At least one bind variable must be used in the SQL command."        << std::endl
+                << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        m_identifiers.resize( m_identifierNames.size() );
+        m_assignedIdentifiers.resize( m_identifierNames.size() );
+        m_values.resize( m_valueNames.size() );
+        m_assignedValues.resize( m_valueNames.size() );
+
+    }
+
+    /**
+     * The bitmask of the fragments whose placeholders have all been assigned.
+     * Throws exception #16 if only a part of them has been assigned, and #17 if no item of a partial UPDATE is included.
+     *
+     * @return
+     */
+    auto MySqlExtBindShapes::includedFragments() const -> unsigned long long
+    {
+
+        unsigned long long fragmentsMask {};
+        bool               listItemIncluded {};
+
+        for ( size_t index = 0; index < m_fragments.size(); index++ ) {
+
+            const std::vector<size_t> & valueIndexes  = m_fragments [index].valueIndexes;
+            const size_t                assignedCount = static_cast<size_t>( std::count_if( valueIndexes.begin(), valueIndexes.end(),
+                                                                             [this]( size_t valueIndex ) { return m_assignedValues [valueIndex]; } ) );
+
+            if ( assignedCount == valueIndexes.size() ) {
+
+                fragmentsMask    |= 1ULL << index;
+                // An item without placeholders alone is no reason for an UPDATE.
+                listItemIncluded |= m_fragments [index].listItem && false == valueIndexes.empty();
+
+            } else if ( 0 != assignedCount ) {
+
+                std::string bindVariablesList {};
+                for ( const size_t valueIndex : valueIndexes ) {
+
+                    bindVariablesList += ( bindVariablesList.empty() ? "" : ", " ) + std::string( m_valueNames [valueIndex] );
+
+                }
+
+                throwFragmentException( "assign all placeholders of the fragment [" + bindVariablesList + "] or none" );
+
+            }
+
+        }
+
+        if ( m_partialUpdate && false == listItemIncluded ) {
+
+            throwPartialUpdateException( "no column of the SET clause has been assigned" );
+
+        }
+
+        return fragmentsMask;
+
+    }
+
+    /**
+     * Puts the shape of <m_shapeKey> into the statement cache - the least recently used shape is released first
+     * if there are already <maxShapes>.
+     *
+     * @param fragmentsMask
+     * @return
+     */
+    auto MySqlExtBindShapes::buildShape( unsigned long long fragmentsMask ) -> MySqlExtBind &
+    {
+
+        std::string                   mysqlCommand;
+        std::string                   adjustedMysqlCommand;
+        std::vector<std::string_view> positionNames;
+        bool                          excluded         {};
+        bool                          insideList       {};
+        bool                          listItemAdded    {};
+        bool                          separatorPending {};
+
+        for ( const Segment & segment : m_segments ) {
+
+            switch ( segment.segmentType ) {
+
+                case SegmentType::fragmentStart:
+
+                    excluded = 0 == ( fragmentsMask & ( 1ULL << segment.index ) );
+                    continue;
+
+                case SegmentType::fragmentEnd:
+
+                    excluded = false;
+                    continue;
+
+                case SegmentType::listStart:
+
+                    insideList = true;
+                    continue;
+
+                case SegmentType::listSeparator:
+
+                    // Only added if an included item follows.
+                    separatorPending = listItemAdded;
+                    continue;
+
+                case SegmentType::listEnd:
+
+                    insideList       = false;
+                    separatorPending = false;
+                    continue;
+
+                default:
+
+                    break;
+
+            }
+
+            if ( excluded ) {
+
+                continue;
+
+            }
+
+            if ( separatorPending ) {
+
+                mysqlCommand.append( g_listSeparator );
+                adjustedMysqlCommand.append( g_listSeparator );
+                separatorPending = false;
+
+            }
+
+            listItemAdded |= insideList;
+
+            switch ( segment.segmentType ) {
+
+                case SegmentType::value:
+
+                    mysqlCommand.append( segment.text );
+                    adjustedMysqlCommand.push_back( '?' );
+                    positionNames.push_back( segment.valueName );
+                    break;
+
+                case SegmentType::identifier:
+
+                    // The identifier has been checked - it contains no backtick.
+                    for ( std::string * shapeCommand : { &mysqlCommand, &adjustedMysqlCommand } ) {
+
+                        shapeCommand->append( 1, '`' ).append( m_identifiers [segment.index] ).push_back( '`' );
+
+                    }
+                    break;
+
+                default:
+
+                    mysqlCommand.append( segment.text );
+                    adjustedMysqlCommand.append( segment.text );
+                    break;
+
+            }
+
+        }
+
+        if ( m_shapes.size() >= m_maxShapes ) {
+
+            m_statementCache.release( *m_shapes.back().fafExtBind );
+            m_shapeIndexes.erase( m_shapes.back().shapeKey );
+            m_shapes.pop_back();
+
+        }
+
+        MySqlExtBind & fafExtBind = m_statementCache.statement( mysqlCommand,
+                                                                MySqlExtBind::fromAdjustedCommand( nullptr, adjustedMysqlCommand, positionNames ) );
+
+        m_shapes.push_front( Shape { m_shapeKey, &fafExtBind } );
+        m_shapeIndexes.emplace( m_shapes.front().shapeKey, m_shapes.begin() );
+
+        return fafExtBind;
+
+    }
+
+    auto MySqlExtBindShapes::throwIdentifierException( std::string_view reason ) -> void
+    {
+
+        std::cerr << "Exception #15: The identifier cannot be used - " << reason << "." << std::endl;
+        throw FaF::Exception();
+
+    }
+
+    auto MySqlExtBindShapes::throwFragmentException( std::string_view reason ) -> void
+    {
+
+        std::cerr << "Exception #16: The optional fragments cannot be used - " << reason << "." << std::endl;
+        throw FaF::Exception();
+
+    }
+
+    auto MySqlExtBindShapes::throwPartialUpdateException( std::string_view reason ) -> void
+    {
+
+        std::cerr << "Exception #17: The partial UPDATE cannot be used - " << reason << "." << std::endl;
+        throw FaF::Exception();
+
+    }
+
+}
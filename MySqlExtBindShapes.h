@@ -0,0 +1,134 @@
+/**
+ * MySqlExtBindShapes.h
+ *
+ * Header for the MySqlExtBindShapes class - a command with identifier placeholders and optional fragments, parsed once.
+ * Each combination of identifiers and fragments is a shape with its own prepared statement in a statement cache.
+ * An UPDATE can have shapes which SET only the assigned columns.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_SHAPES_H
+#define FAF_MYSQL_EXT_BIND_SHAPES_H
+
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MySqlExtBindStatementCache.h"
+
+namespace FaF
+{
+
+    class MySqlExtBindShapes
+    {
+
+        public:
+
+            MySqlExtBindShapes( MySqlExtBindStatementCache & statementCache, std::string_view mysqlCommand, size_t maxShapes = 64,
+                                bool partialUpdate = false );
+            ~MySqlExtBindShapes();
+
+            MySqlExtBindShapes( const MySqlExtBindShapes & )             = delete;
+            MySqlExtBindShapes & operator=( const MySqlExtBindShapes & ) = delete;
+
+            auto assignIdentifier( std::string_view identifierName, std::string_view identifier ) -> void;
+            auto assignBindData( std::string_view bindVariable, const MYSQL_BIND & originalMysqlBindItem ) -> void;
+            auto assignBindData(
+                    std::string_view bindVariable,
+                    decltype( MYSQL_BIND::buffer_type ) buffer_type,
+                    decltype( MYSQL_BIND::buffer      ) buffer,
+                    decltype( MYSQL_BIND::length      ) length  = nullptr,
+                    decltype( MYSQL_BIND::is_null     ) is_null = nullptr
+            ) -> void;
+            auto statement() -> MySqlExtBind &;
+
+            auto size() const -> size_t { return m_shapes.size(); }
+
+        private:
+
+            enum class SegmentType
+            {
+                text,
+                value,
+                identifier,
+                fragmentStart,
+                fragmentEnd,
+                listStart,
+                listSeparator,
+                listEnd
+            };
+
+            using Segment = struct Segment
+            {
+
+                    SegmentType                 segmentType;
+                    // The text, the whole value placeholder or the identifier name.
+                    std::string_view            text;
+                    std::string_view            valueName;
+                    // The index in m_valueNames, m_identifierNames or m_fragments.
+                    size_t                      index {};
+
+            };
+
+            using Fragment = struct Fragment
+            {
+
+                    // The indexes in m_valueNames of the placeholders in the fragment.
+                    std::vector<size_t>         valueIndexes;
+                    // An item of the SET clause of a partial UPDATE - it's always included without placeholders.
+                    bool                        listItem {};
+
+            };
+
+            using Shape = struct Shape
+            {
+
+                    std::string                 shapeKey;
+                    MySqlExtBind *              fafExtBind {};
+
+            };
+
+            auto lexMysqlCommand()                                -> void;
+            auto includedFragments() const                        -> unsigned long long;
+            auto buildShape( unsigned long long fragmentsMask )   -> MySqlExtBind &;
+
+            [[noreturn]] static auto throwIdentifierException( std::string_view reason ) -> void;
+            [[noreturn]] static auto throwFragmentException( std::string_view reason )   -> void;
+            [[noreturn]] static auto throwPartialUpdateException( std::string_view reason ) -> void;
+
+            // constructor initialiser list - respect the order.
+
+                MySqlExtBindStatementCache &                    m_statementCache;
+                std::string                                     m_mysqlCommand;
+                size_t                                          m_maxShapes;
+                bool                                            m_partialUpdate;
+
+            // Point into m_mysqlCommand.
+            std::vector<Segment>                                m_segments;
+            std::vector<std::string_view>                       m_identifierNames;
+            std::vector<std::string_view>                       m_valueNames;
+            // At most 64 - a shape has a bit for each included fragment.
+            std::vector<Fragment>                               m_fragments;
+
+            std::vector<std::string>                            m_identifiers;
+            std::vector<bool>                                   m_assignedIdentifiers;
+            // Reset by each statement().
+            std::vector<MYSQL_BIND>                             m_values;
+            std::vector<bool>                                   m_assignedValues;
+
+            // The most recently used shape first - the last one is released when there are too many.
+            std::list<Shape>                                    m_shapes;
+            std::unordered_map<std::string_view, std::list<Shape>::iterator> m_shapeIndexes;
+            std::string                                         m_shapeKey;
+
+    };
+
+}
+
+#endif
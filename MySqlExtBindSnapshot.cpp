@@ -0,0 +1,370 @@
+/**
+ * MySqlExtBindSnapshot.cpp
+ *
+ * The snapshot file has a header and the templates, each one aligned to 8 bytes:
+ *
+ *   SnapshotHeader
+ *   char            [...]    - the left and the right delimiter
+ *   TemplateHeader, char [commandLength], char [imageLength]    - per template
+ *
+ * The images are the template part of the MySqlExtBind arena, in the byte order of the machine. A snapshot is
+ * only used if its format, the template image version, the byte order, the delimiters and the hash of the content
+ * match - otherwise open() returns false and the commands are parsed as usual.
+ * The file stays mapped as long as the snapshot exists - the commands and images are used in place, an instance
+ * copies the image into its arena.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindSnapshot.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace
+{
+
+    constexpr char  g_snapshotMagic [8] { "FAFSNAP" };
+    constexpr u_int g_formatVersion     { 1 };
+    constexpr u_int g_byteOrderMark     { 0x01020304 };
+
+    using SnapshotHeader = struct SnapshotHeader
+    {
+
+            char                    magic [8];
+            u_int                   formatVersion;
+            u_int                   templateImageVersion;
+            u_int                   byteOrderMark;
+            u_int                   templatesCount;
+            u_int                   leftDelimiterLength;
+            u_int                   rightDelimiterLength;
+            unsigned long long      contentLength;
+            unsigned long long      contentHash;
+
+    };
+
+    using TemplateHeader = struct TemplateHeader
+    {
+
+            unsigned long long      executions;
+            u_int                   commandLength;
+            u_int                   imageLength;
+
+    };
+
+    auto alignedLength( size_t length ) -> size_t
+    {
+
+        return ( length + 7 ) / 8 * 8;
+
+    }
+
+    // FNV-1a - detects a damaged or truncated file, it's no protection against manipulations.
+    auto contentHash( const char * content, size_t length ) -> unsigned long long
+    {
+
+        unsigned long long hash { 14695981039346656037ULL };
+
+        for ( size_t index = 0; index < length; index++ ) {
+
+            hash = ( hash ^ static_cast<unsigned char>( content [index] ) ) * 1099511628211ULL;
+
+        }
+
+        return hash;
+
+    }
+
+    auto appendAligned( std::string & content, std::string_view data ) -> void
+    {
+
+        content.append( data );
+        content.resize( alignedLength( content.length() ), '\0' );
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * Parses the commands and writes their templates - with the current delimiters. A command which cannot be
+     * parsed is skipped. The file is written to a temporary file first and renamed.
+     *
+     * @param snapshotPath
+     * @param templateUses
+     * @return False if the file couldn't be written.
+     */
+    auto MySqlExtBindSnapshot::save( const std::string & snapshotPath, const std::vector<TemplateUse> & templateUses ) -> bool
+    {
+
+        const auto [leftDelimiter, rightDelimiter] = MySqlExtBind::delimiters();
+
+        SnapshotHeader snapshotHeader {};
+        std::memcpy( snapshotHeader.magic, g_snapshotMagic, sizeof( g_snapshotMagic ) );
+        snapshotHeader.formatVersion        = g_formatVersion;
+        snapshotHeader.templateImageVersion = MySqlExtBind::templateImageVersion;
+        snapshotHeader.byteOrderMark        = g_byteOrderMark;
+        snapshotHeader.leftDelimiterLength  = static_cast<u_int>( leftDelimiter.length() );
+        snapshotHeader.rightDelimiterLength = static_cast<u_int>( rightDelimiter.length() );
+
+        std::string content;
+        appendAligned( content, std::string( leftDelimiter ) + std::string( rightDelimiter ) );
+
+        for ( const TemplateUse & templateUse : templateUses ) {
+
+            std::string_view templateImage;
+            std::unique_ptr<MySqlExtBind> parsedExtBind;
+
+            try {
+
+                // A command without bind variables - for example from a catalog - is stored as it is.
+                parsedExtBind = MySqlExtBind::hasBindVariables( templateUse.mysqlCommand )
+                              ? std::make_unique<MySqlExtBind>( nullptr, templateUse.mysqlCommand )
+                              : std::make_unique<MySqlExtBind>( MySqlExtBind::fromAdjustedCommand( nullptr, templateUse.mysqlCommand, {} ) );
+                templateImage = parsedExtBind->templateImage();
+
+            } catch ( const FaF::Exception & ) {
+
+                continue;
+
+            }
+
+            const TemplateHeader templateHeader { templateUse.executions, static_cast<u_int>( templateUse.mysqlCommand.length() ),
+                                                  static_cast<u_int>( templateImage.length() ) };
+
+            appendAligned( content, std::string_view( reinterpret_cast<const char *>( &templateHeader ), sizeof( templateHeader ) ) );
+            appendAligned( content, templateUse.mysqlCommand );
+            appendAligned( content, templateImage );
+            snapshotHeader.templatesCount++;
+
+        }
+
+        snapshotHeader.contentLength = content.length();
+        snapshotHeader.contentHash   = contentHash( content.data(), content.length() );
+
+        const std::string temporaryPath = snapshotPath + ".tmp";
+
+        {
+
+            std::ofstream snapshotFile( temporaryPath, std::ios::binary | std::ios::trunc );
+
+            snapshotFile.write( reinterpret_cast<const char *>( &snapshotHeader ), sizeof( snapshotHeader ) );
+            snapshotFile.write( content.data(), static_cast<std::streamsize>( content.length() ) );
+
+            if ( false == snapshotFile.flush().good() ) {
+
+                std::remove( temporaryPath.c_str() );
+                return false;
+
+            }
+
+        }
+
+        return 0 == std::rename( temporaryPath.c_str(), snapshotPath.c_str() );
+
+    }
+
+    MySqlExtBindSnapshot::~MySqlExtBindSnapshot()
+    {
+
+        close();
+
+    }
+
+    /**
+     * Maps the snapshot file and checks it - see the description at the top. A snapshot opened before is closed,
+     * the instances created from it stay valid.
+     *
+     * @param snapshotPath
+     * @return False if the file is missing or doesn't match - the snapshot is empty then.
+     */
+    auto MySqlExtBindSnapshot::open( const std::string & snapshotPath ) -> bool
+    {
+
+        close();
+
+        const int fileDescriptor = ::open( snapshotPath.c_str(), O_RDONLY | O_CLOEXEC );
+        if ( 0 > fileDescriptor ) {
+
+            return false;
+
+        }
+
+        struct stat fileStatus {};
+        if ( 0 == fstat( fileDescriptor, &fileStatus ) && sizeof( SnapshotHeader ) <= static_cast<size_t>( fileStatus.st_size ) ) {
+
+            void * address = mmap( nullptr, static_cast<size_t>( fileStatus.st_size ), PROT_READ, MAP_PRIVATE, fileDescriptor, 0 );
+            if ( MAP_FAILED != address ) {
+
+                m_address = static_cast<const char *>( address );
+                m_length  = static_cast<size_t>( fileStatus.st_size );
+
+            }
+
+        }
+
+        ::close( fileDescriptor );
+
+        if ( nullptr == m_address ) {
+
+            return false;
+
+        }
+
+        SnapshotHeader snapshotHeader;
+        std::memcpy( &snapshotHeader, m_address, sizeof( snapshotHeader ) );
+
+        const char * content       = m_address + sizeof( snapshotHeader );
+        const size_t contentLength = m_length - sizeof( snapshotHeader );
+        const auto [leftDelimiter, rightDelimiter] = MySqlExtBind::delimiters();
+
+        if ( 0 != std::memcmp( snapshotHeader.magic, g_snapshotMagic, sizeof( g_snapshotMagic ) ) ||
+             g_formatVersion != snapshotHeader.formatVersion || MySqlExtBind::templateImageVersion != snapshotHeader.templateImageVersion ||
+             g_byteOrderMark != snapshotHeader.byteOrderMark || contentLength != snapshotHeader.contentLength ||
+             size_t { snapshotHeader.leftDelimiterLength } + snapshotHeader.rightDelimiterLength > contentLength ||
+             leftDelimiter  != std::string_view( content, snapshotHeader.leftDelimiterLength ) ||
+             rightDelimiter != std::string_view( content + snapshotHeader.leftDelimiterLength, snapshotHeader.rightDelimiterLength ) ||
+             contentHash( content, contentLength ) != snapshotHeader.contentHash ) {
+
+            close();
+            return false;
+
+        }
+
+        m_templates.reserve( snapshotHeader.templatesCount );
+
+        size_t offset = alignedLength( size_t { snapshotHeader.leftDelimiterLength } + snapshotHeader.rightDelimiterLength );
+
+        for ( u_int index = 0; index < snapshotHeader.templatesCount; index++ ) {
+
+            TemplateHeader templateHeader {};
+            if ( offset + sizeof( templateHeader ) > contentLength ) {
+
+                close();
+                return false;
+
+            }
+
+            std::memcpy( &templateHeader, content + offset, sizeof( templateHeader ) );
+            offset += alignedLength( sizeof( templateHeader ) );
+
+            const size_t imageOffset = offset + alignedLength( templateHeader.commandLength );
+            if ( imageOffset + templateHeader.imageLength > contentLength ) {
+
+                close();
+                return false;
+
+            }
+
+            m_templates.emplace( std::string_view( content + offset, templateHeader.commandLength ),
+                                 Template { std::string_view( content + imageOffset, templateHeader.imageLength ), templateHeader.executions } );
+
+            offset = imageOffset + alignedLength( templateHeader.imageLength );
+
+        }
+
+        return true;
+
+    }
+
+    auto MySqlExtBindSnapshot::contains( std::string_view mysqlCommand ) const -> bool
+    {
+
+        return m_templates.end() != m_templates.find( mysqlCommand );
+
+    }
+
+    /**
+     * The commands of the snapshot with their recorded executions - for example for MySqlExtBindProfile::warmUp().
+     *
+     * @return
+     */
+    auto MySqlExtBindSnapshot::templateUses() const -> std::vector<TemplateUse>
+    {
+
+        std::vector<TemplateUse> templateUses;
+        templateUses.reserve( m_templates.size() );
+
+        for ( const auto & [mysqlCommand, snapshotTemplate] : m_templates ) {
+
+            templateUses.push_back( TemplateUse { std::string( mysqlCommand ), snapshotTemplate.executions } );
+
+        }
+
+        return templateUses;
+
+    }
+
+    /**
+     * The instance of the command for the statement - created from the snapshot or, if it isn't in it, parsed.
+     *
+     * @param mysqlCommand
+     * @param mysqlStatement
+     * @return
+     */
+    auto MySqlExtBindSnapshot::statement( std::string_view mysqlCommand, MYSQL_STMT * mysqlStatement ) const -> MySqlExtBind
+    {
+
+        const auto foundTemplate = m_templates.find( mysqlCommand );
+
+        if ( m_templates.end() == foundTemplate ) {
+
+            return MySqlExtBind( mysqlStatement, mysqlCommand );
+
+        }
+
+        return MySqlExtBind::fromTemplateImage( mysqlStatement, foundTemplate->second.templateImage );
+
+    }
+
+    /**
+     * Registers the command in the statement cache - created from the snapshot or, if it isn't in it, parsed.
+     * Use it to fill the cache at startup, afterwards MySqlExtBindStatementCache::statement( mysqlCommand ) is cheaper.
+     *
+     * @param mysqlCommand
+     * @param statementCache
+     * @return
+     */
+    auto MySqlExtBindSnapshot::statement( std::string_view mysqlCommand, MySqlExtBindStatementCache & statementCache ) const -> MySqlExtBind &
+    {
+
+        const auto foundTemplate = m_templates.find( mysqlCommand );
+
+        if ( m_templates.end() == foundTemplate ) {
+
+            return statementCache.statement( mysqlCommand );
+
+        }
+
+        return statementCache.statement( mysqlCommand, MySqlExtBind::fromTemplateImage( nullptr, foundTemplate->second.templateImage ) );
+
+    }
+
+    auto MySqlExtBindSnapshot::close() -> void
+    {
+
+        m_templates.clear();
+
+        if ( nullptr != m_address ) {
+
+            munmap( const_cast<char *>( m_address ), m_length );
+            m_address = nullptr;
+            m_length  = 0;
+
+        }
+
+    }
+
+}
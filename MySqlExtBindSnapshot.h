@@ -0,0 +1,70 @@
+/**
+ * MySqlExtBindSnapshot.h
+ *
+ * Header for the MySqlExtBindSnapshot class - the parsed templates of many commands in one binary file,
+ * mapped into memory at startup, so the commands don't have to be parsed again.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_SNAPSHOT_H
+#define FAF_MYSQL_EXT_BIND_SNAPSHOT_H
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MySqlExtBindStatementCache.h"
+
+namespace FaF
+{
+
+    class MySqlExtBindSnapshot
+    {
+
+        public:
+
+            static auto save( const std::string & snapshotPath, const std::vector<TemplateUse> & templateUses ) -> bool;
+
+            MySqlExtBindSnapshot() = default;
+            ~MySqlExtBindSnapshot();
+
+            MySqlExtBindSnapshot( const MySqlExtBindSnapshot & )             = delete;
+            MySqlExtBindSnapshot & operator=( const MySqlExtBindSnapshot & ) = delete;
+
+            auto open( const std::string & snapshotPath ) -> bool;
+
+            auto contains( std::string_view mysqlCommand ) const -> bool;
+            auto templateUses()                            const -> std::vector<TemplateUse>;
+
+            auto statement( std::string_view mysqlCommand, MYSQL_STMT * mysqlStatement ) const                     -> MySqlExtBind;
+            auto statement( std::string_view mysqlCommand, MySqlExtBindStatementCache & statementCache ) const    -> MySqlExtBind &;
+
+            auto size() const -> size_t { return m_templates.size(); }
+
+        private:
+
+            using Template = struct Template
+            {
+
+                    std::string_view            templateImage;
+                    unsigned long long          executions {};
+
+            };
+
+            auto close() -> void;
+
+            const char *                                        m_address {};
+            size_t                                              m_length  {};
+            // The commands and the images point into the mapped file.
+            std::unordered_map<std::string_view, Template>      m_templates;
+
+    };
+
+}
+
+#endif
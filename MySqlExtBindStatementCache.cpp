@@ -0,0 +1,505 @@
+/**
+ * MySqlExtBindStatementCache.cpp
+ *
+ * Each command is parsed once. Each thread gets its own copy of the MySqlExtBind, so concurrent callers never execute
+ * each other's values. It stays valid for the lifetime of the cache, unless each statement() of the command has been
+ * given back with release() - only the MYSQL_STMT behind it is replaced when the statement has to be prepared again.
+ * A failed execution is retried:
+ *   ER_NEED_REPREPARE and ER_UNKNOWN_STMT_HANDLER   always - the statement has not been executed
+ *   CR_SERVER_GONE_ERROR and CR_SERVER_LOST         only idempotent statements after a reconnect - the server may
+ *                                                   have executed it before the connection was lost
+ * After a reconnect all statements are invalid. The most executed ones are prepared again right away, the most executed
+ * first, while the cache is still locked - so no other thread uses the connection meanwhile. The other statements are prepared
+ * when they are executed next.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindStatementCache.h"
+
+#include <algorithm>
+
+#include <errmsg.h>
+#include <mysqld_error.h>
+
+namespace FaF
+{
+
+    /**
+     * The connection must be connected. It can be used elsewhere only while no cached statement is executed.
+     *
+     * @param mysqlConnection
+     * @param statementCacheOptions
+     */
+    MySqlExtBindStatementCache::MySqlExtBindStatementCache( MYSQL * mysqlConnection, const StatementCacheOptions & statementCacheOptions )
+    :
+        m_mysqlConnection      ( mysqlConnection ),
+        m_statementCacheOptions( statementCacheOptions )
+    {
+    }
+
+    MySqlExtBindStatementCache::~MySqlExtBindStatementCache()
+    {
+
+        for ( auto & [mysqlCommand, entry] : m_entries ) {
+
+            if ( nullptr != entry->mysqlStatement ) {
+
+                mysql_stmt_close( entry->mysqlStatement );
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Returns the MySqlExtBind of the command for the calling thread - it's parsed and prepared when it's requested
+     * for the first time. Each thread gets its own copy, so the values assigned by one thread are never executed by
+     * another. A failed prepare is reported by execute(). The reference is valid as long as the cache exists - or
+     * until release() has been called as often as statement() for the command.
+     *
+     * @param mysqlCommand
+     * @return
+     */
+    auto MySqlExtBindStatementCache::statement( std::string_view mysqlCommand ) -> MySqlExtBind &
+    {
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        return threadExtBind( insert( mysqlCommand, mysqlCommand ) );
+
+    }
+
+    /**
+     * Like statement( mysqlCommand ), but a new entry copies <parsedExtBind> instead of parsing the command again -
+     * for example a statement of MySqlExtBindCatalog. <parsedExtBind> must have been created from <mysqlCommand>.
+     *
+     * @param mysqlCommand
+     * @param parsedExtBind
+     * @return
+     */
+    auto MySqlExtBindStatementCache::statement( std::string_view mysqlCommand, const MySqlExtBind & parsedExtBind ) -> MySqlExtBind &
+    {
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        return threadExtBind( insert( mysqlCommand, parsedExtBind ) );
+
+    }
+
+    /**
+     * Returns the entry of the command - a new one is created from <source>, which is either the command or a parsed
+     * MySqlExtBind. <m_mutex> must be locked.
+     *
+     * @param mysqlCommand
+     * @param source
+     * @return
+     */
+    template < typename Source >
+    auto MySqlExtBindStatementCache::insert( std::string_view mysqlCommand, const Source & source ) -> Entry &
+    {
+
+        auto [foundEntry, inserted] = m_entries.try_emplace( std::string( mysqlCommand ) );
+
+        if ( inserted ) {
+
+            try {
+
+                foundEntry->second = std::make_unique<Entry>( source );
+
+            } catch ( ... ) {
+
+                m_entries.erase( foundEntry );
+                throw;
+
+            }
+
+            Entry & entry = *foundEntry->second;
+            entry.cacheKey = &foundEntry->first;
+            entry.fafExtBind.replaceStatement( nullptr );
+            m_bindNamesArray.resize( std::max<size_t>( m_bindNamesArray.size(), entry.fafExtBind.bindVariablesCount() ), nullptr );
+
+            prepare( entry );
+
+        }
+
+        return *foundEntry->second;
+
+    }
+
+    /**
+     * Holds the entry once more and returns the copy of the calling thread - it's made from the prepared MySqlExtBind
+     * on the first call of the thread. <m_mutex> must be locked.
+     *
+     * @param entry
+     * @return
+     */
+    auto MySqlExtBindStatementCache::threadExtBind( Entry & entry ) -> MySqlExtBind &
+    {
+
+        std::unique_ptr<MySqlExtBind> & fafExtBind = entry.threadExtBinds [std::this_thread::get_id()];
+
+        if ( nullptr == fafExtBind ) {
+
+            try {
+
+                fafExtBind = std::make_unique<MySqlExtBind>( entry.fafExtBind );
+                m_entriesByExtBind.emplace( fafExtBind.get(), &entry );
+
+            } catch ( ... ) {
+
+                entry.threadExtBinds.erase( std::this_thread::get_id() );
+                throw;
+
+            }
+
+            // The cache executes it with the MYSQL_STMT of the entry.
+            fafExtBind->replaceStatement( nullptr );
+
+        }
+
+        entry.references++;
+
+        return *fafExtBind;
+
+    }
+
+    /**
+     * Executes the statement with the values assigned to <cachedExtBind> - see the description at the top for the retries.
+     * <cachedExtBind> belongs to the thread which got it from statement(), so its values are read before the lock is taken.
+     * Throws exception #11 if <cachedExtBind> hasn't been returned by statement() of this cache.
+     *
+     * @param cachedExtBind
+     * @param idempotent    True if executing the statement twice has the same effect as executing it once.
+     * @return The MySQL error code of the last try - 0 if the statement has been executed.
+     */
+    auto MySqlExtBindStatementCache::execute( MySqlExtBind & cachedExtBind, bool idempotent ) -> unsigned int
+    {
+
+        const MYSQL_BIND * mysqlBindArray = cachedExtBind.checkedBindArray();
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        const auto foundEntry = m_entriesByExtBind.find( &cachedExtBind );
+        if ( m_entriesByExtBind.end() == foundEntry ) {
+
+            std::cerr << "Exception #11: The MySqlExtBind instance has not been returned by this statement cache." << std::endl;
+            throw FaF::Exception();
+
+        }
+
+        Entry & entry = *foundEntry->second;
+        entry.executions++;
+
+        for ( u_int attempt = 0; ; attempt++ ) {
+
+            unsigned int errorCode = entry.prepared ? 0 : prepare( entry );
+
+            if ( 0 == errorCode ) {
+
+                // mysql_stmt_bind_named_param() doesn't change the array.
+                if ( 0 == mysql_stmt_bind_named_param( entry.mysqlStatement, const_cast<MYSQL_BIND *>( mysqlBindArray ),
+                                                       cachedExtBind.bindVariablesCount(), m_bindNamesArray.data() ) &&
+                     0 == mysql_stmt_execute( entry.mysqlStatement ) ) {
+
+                    return 0;
+
+                }
+
+                errorCode = mysql_stmt_errno( entry.mysqlStatement );
+
+            }
+
+            if ( attempt >= m_statementCacheOptions.maxRetries ) {
+
+                return errorCode;
+
+            }
+
+            if ( ER_NEED_REPREPARE == errorCode || ER_UNKNOWN_STMT_HANDLER == errorCode ) {
+
+                entry.prepared = false;
+                continue;
+
+            }
+
+            if ( ( CR_SERVER_GONE_ERROR != errorCode && CR_SERVER_LOST != errorCode ) || nullptr == m_statementCacheOptions.reconnect ||
+                 false == m_statementCacheOptions.reconnect( m_mysqlConnection ) ) {
+
+                return errorCode;
+
+            }
+
+            invalidateStatements();
+
+            if ( false == idempotent ) {
+
+                return errorCode;
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Call it after the connection has been connected again by the application - the hot statements are prepared
+     * again before it returns. Not needed if the reconnect of StatementCacheOptions did it.
+     */
+    auto MySqlExtBindStatementCache::reconnected() -> void
+    {
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        invalidateStatements();
+
+    }
+
+    /**
+     * Gives back one statement() of the command - for callers which bound the number of their statements, like
+     * MySqlExtBindShapes. When the last one has been given back, the statement is closed and removed from the cache,
+     * and <cachedExtBind> is invalid. It doesn't throw, so it can be called by destructors.
+     *
+     * @param cachedExtBind
+     * @return False if <cachedExtBind> hasn't been returned by statement() of this cache.
+     */
+    auto MySqlExtBindStatementCache::release( MySqlExtBind & cachedExtBind ) noexcept -> bool
+    {
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        const auto foundEntry = m_entriesByExtBind.find( &cachedExtBind );
+        if ( m_entriesByExtBind.end() == foundEntry ) {
+
+            return false;
+
+        }
+
+        Entry & entry = *foundEntry->second;
+        if ( 0 < --entry.references ) {
+
+            return true;
+
+        }
+
+        if ( nullptr != entry.mysqlStatement ) {
+
+            mysql_stmt_close( entry.mysqlStatement );
+
+        }
+
+        for ( const auto & [threadId, fafExtBind] : entry.threadExtBinds ) {
+
+            // Avoid a warning which would be treated as an error.
+            (void) threadId;
+
+            m_entriesByExtBind.erase( fafExtBind.get() );
+
+        }
+
+        m_entries.erase( *entry.cacheKey );
+
+        return true;
+
+    }
+
+    /**
+     * The executions per command since the cache has been created - including the ones taken over by warmUp().
+     *
+     * @return
+     */
+    auto MySqlExtBindStatementCache::templateUses() const -> std::vector<TemplateUse>
+    {
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        std::vector<TemplateUse> templateUses;
+        templateUses.reserve( m_entries.size() );
+
+        for ( const auto & [mysqlCommand, entry] : m_entries ) {
+
+            templateUses.push_back( TemplateUse { mysqlCommand, entry->executions } );
+
+        }
+
+        return templateUses;
+
+    }
+
+    /**
+     * Parses and prepares the commands before they are requested. Their executions are taken over, so the
+     * statements hot in the recorded run are also the first ones prepared again after a reconnect.
+     * A warmed statement isn't referenced - the first statement() of a caller owns it, so release() still removes it
+     * and caches bounded by release() like MySqlExtBindShapes keep their bound.
+     * A command which cannot be parsed is skipped.
+     *
+     * @param templateUses
+     * @return The number of statements which have been prepared.
+     */
+    auto MySqlExtBindStatementCache::warmUp( const std::vector<TemplateUse> & templateUses ) -> size_t
+    {
+
+        size_t preparedCount {};
+
+        for ( const TemplateUse & templateUse : templateUses ) {
+
+            const std::lock_guard<std::mutex> lock( m_mutex );
+
+            try {
+
+                Entry & entry = insert( templateUse.mysqlCommand, templateUse.mysqlCommand );
+                entry.executions = std::max( entry.executions, templateUse.executions );
+                preparedCount   += entry.prepared ? 1 : 0;
+
+            } catch ( const FaF::Exception & ) {
+
+                // The command of an outdated profile cannot be parsed any more.
+                continue;
+
+            }
+
+        }
+
+        return preparedCount;
+
+    }
+
+    auto MySqlExtBindStatementCache::size() const -> size_t
+    {
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        return m_entries.size();
+
+    }
+
+    /**
+     * The memory used by the MySqlExtBind instances of the cached statements - see MySqlExtBind::memoryUsage().
+     * The copies of the threads are included.
+     *
+     * @return
+     */
+    auto MySqlExtBindStatementCache::memoryUsage() const -> MemoryUsage
+    {
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        MemoryUsage cacheMemoryUsage {};
+
+        const auto addMemoryUsage = [&cacheMemoryUsage]( const MySqlExtBind & fafExtBind ) {
+
+            const MemoryUsage extBindMemoryUsage = fafExtBind.memoryUsage();
+
+            cacheMemoryUsage.sqlText    += extBindMemoryUsage.sqlText;
+            cacheMemoryUsage.nameTable  += extBindMemoryUsage.nameTable;
+            cacheMemoryUsage.bindArrays += extBindMemoryUsage.bindArrays;
+
+        };
+
+        for ( const auto & [mysqlCommand, entry] : m_entries ) {
+
+            addMemoryUsage( entry->fafExtBind );
+
+            for ( const auto & [threadId, fafExtBind] : entry->threadExtBinds ) {
+
+                // Avoid a warning which would be treated as an error.
+                (void) threadId;
+
+                addMemoryUsage( *fafExtBind );
+
+            }
+
+        }
+
+        return cacheMemoryUsage;
+
+    }
+
+    /**
+     * Prepares the statement - a new MYSQL_STMT is initialised if the connection has changed. <m_mutex> must be locked.
+     *
+     * @param entry
+     * @return The MySQL error code - 0 if the statement has been prepared.
+     */
+    auto MySqlExtBindStatementCache::prepare( Entry & entry ) -> unsigned int
+    {
+
+        if ( nullptr == entry.mysqlStatement ) {
+
+            entry.mysqlStatement = mysql_stmt_init( m_mysqlConnection );
+            if ( nullptr == entry.mysqlStatement ) {
+
+                return CR_OUT_OF_MEMORY;
+
+            }
+            entry.fafExtBind.replaceStatement( entry.mysqlStatement );
+
+        }
+
+        if ( 0 != entry.fafExtBind.prepareStatement() ) {
+
+            return mysql_stmt_errno( entry.mysqlStatement );
+
+        }
+
+        entry.prepared = true;
+
+        return 0;
+
+    }
+
+    /**
+     * Closes the statements of the lost connection and prepares the hot ones again. <m_mutex> must be locked.
+     */
+    auto MySqlExtBindStatementCache::invalidateStatements() -> void
+    {
+
+        for ( auto & [mysqlCommand, entry] : m_entries ) {
+
+            if ( nullptr != entry->mysqlStatement ) {
+
+                mysql_stmt_close( entry->mysqlStatement );
+
+            }
+            entry->mysqlStatement = nullptr;
+            entry->prepared       = false;
+
+        }
+
+        reprepareHotTemplates();
+
+    }
+
+    /**
+     * Prepares the <hotTemplates> most executed statements again, the most executed first. <m_mutex> must be locked.
+     * A failed prepare is repeated by the next execute() of the statement.
+     */
+    auto MySqlExtBindStatementCache::reprepareHotTemplates() -> void
+    {
+
+        std::vector<Entry *> hotEntries;
+        hotEntries.reserve( m_entries.size() );
+        for ( const auto & [mysqlCommand, entry] : m_entries ) {
+
+            hotEntries.push_back( entry.get() );
+
+        }
+
+        const size_t hotCount = std::min( hotEntries.size(), m_statementCacheOptions.hotTemplates );
+        std::partial_sort( hotEntries.begin(), hotEntries.begin() + static_cast<std::ptrdiff_t>( hotCount ), hotEntries.end(),
+                           []( const Entry * left, const Entry * right ) { return left->executions > right->executions; } );
+        hotEntries.resize( hotCount );
+
+        for ( Entry * entry : hotEntries ) {
+
+            prepare( *entry );
+
+        }
+
+    }
+
+}
@@ -0,0 +1,123 @@
+/**
+ * MySqlExtBindStatementCache.h
+ *
+ * Header for the MySqlExtBindStatementCache class - the prepared statements of one connection, kept by their
+ * command, so they can be prepared again after a reconnect or after the server invalidated them.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_STATEMENT_CACHE_H
+#define FAF_MYSQL_EXT_BIND_STATEMENT_CACHE_H
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "MySqlExtBind.h"
+
+namespace FaF
+{
+
+    /**
+     * <reconnect> is called with the connection after it has been lost - it must connect the same MYSQL structure
+     * again and return false if that failed. Without it a lost connection is only reported.
+     * An execution is tried at most <maxRetries> times more. After a reconnect the <hotTemplates> most executed
+     * statements are prepared again before the retry or reconnected() returns.
+     */
+    using StatementCacheOptions = struct StatementCacheOptions
+    {
+
+            std::function<bool( MYSQL * mysqlConnection )> reconnect;
+            u_int                       maxRetries   { 2 };
+            size_t                      hotTemplates { 64 };
+
+    };
+
+    /**
+     * A command and how often it has been executed - see MySqlExtBindProfile.
+     */
+    using TemplateUse = struct TemplateUse
+    {
+
+            std::string                 mysqlCommand;
+            unsigned long long          executions {};
+
+    };
+
+    class MySqlExtBindStatementCache
+    {
+
+        public:
+
+            MySqlExtBindStatementCache( MYSQL * mysqlConnection, const StatementCacheOptions & statementCacheOptions = StatementCacheOptions {} );
+            ~MySqlExtBindStatementCache();
+
+            MySqlExtBindStatementCache( const MySqlExtBindStatementCache & )             = delete;
+            MySqlExtBindStatementCache & operator=( const MySqlExtBindStatementCache & ) = delete;
+
+            auto statement( std::string_view mysqlCommand )                     -> MySqlExtBind &;
+            auto statement( std::string_view mysqlCommand, const MySqlExtBind & parsedExtBind ) -> MySqlExtBind &;
+            auto execute( MySqlExtBind & cachedExtBind, bool idempotent )       -> unsigned int;
+            auto reconnected()                                                  -> void;
+            auto release( MySqlExtBind & cachedExtBind ) noexcept               -> bool;
+
+            auto templateUses() const                                           -> std::vector<TemplateUse>;
+            auto warmUp( const std::vector<TemplateUse> & templateUses )        -> size_t;
+
+            auto size() const        -> size_t;
+            auto memoryUsage() const -> MemoryUsage;
+
+        private:
+
+            using Entry = struct Entry
+            {
+
+                    // The MYSQL_STMT is initialised by the first prepare.
+                    explicit Entry( std::string_view mysqlCommand )      : fafExtBind( nullptr, mysqlCommand ) {}
+                    explicit Entry( const MySqlExtBind & parsedExtBind ) : fafExtBind( parsedExtBind )         {}
+
+                    // Prepares the statement - its values are never assigned.
+                    MySqlExtBind            fafExtBind;
+                    // The copy of each thread which called statement() - a thread only assigns and executes its own values.
+                    std::unordered_map< std::thread::id, std::unique_ptr<MySqlExtBind> > threadExtBinds;
+                    // The key in m_entries.
+                    const std::string *     cacheKey       {};
+                    MYSQL_STMT *            mysqlStatement {};
+                    bool                    prepared       {};
+                    unsigned long long      executions     {};
+                    // Each statement() call adds one, each release() removes one.
+                    size_t                  references     {};
+
+            };
+
+            template < typename Source >
+            auto insert( std::string_view mysqlCommand, const Source & source ) -> Entry &;
+            auto threadExtBind( Entry & entry ) -> MySqlExtBind &;
+            auto prepare( Entry & entry )     -> unsigned int;
+            auto invalidateStatements()       -> void;
+            auto reprepareHotTemplates()      -> void;
+
+            // constructor initialiser list - respect the order.
+
+                MYSQL *                                             m_mysqlConnection;
+                StatementCacheOptions                               m_statementCacheOptions;
+
+            // Protects the entries and the connection - the callers of all threads share it.
+            mutable std::mutex                                      m_mutex;
+            std::unordered_map< std::string, std::unique_ptr<Entry> > m_entries;
+            std::unordered_map< const MySqlExtBind *, Entry * >     m_entriesByExtBind;
+            std::vector<const char *>                               m_bindNamesArray;
+
+    };
+
+}
+
+#endif
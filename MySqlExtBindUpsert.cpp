@@ -0,0 +1,378 @@
+/**
+ * MySqlExtBindUpsert.cpp
+ *
+ * Collects the rows of an upsert and merges the rows with the same key before they are sent:
+ *   INSERT INTO counters (id, day, hits) VALUES (:id, :day, :hits) AS new ON DUPLICATE KEY UPDATE hits = hits + new.hits
+ * A key is only sent once per execution, which saves the bytes of the repeated rows and the row locks
+ * the server takes for each of them. The merged rows are executed as multi-row statements by MySqlExtBindBatch,
+ * which keeps one prepared statement per rows count.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlExtBindUpsert.h"
+
+#include <algorithm>
+
+namespace
+{
+
+    auto trim( std::string_view text ) -> std::string_view
+    {
+
+        const size_t first = text.find_first_not_of( " \t\r\n" );
+        if ( std::string_view::npos == first ) {
+
+            return {};
+
+        }
+
+        return text.substr( first, text.find_last_not_of( " \t\r\n" ) - first + 1 );
+
+    }
+
+    /**
+     * Splits a comma separated list at the top level - commas in brackets, quoted strings and identifiers are skipped.
+     * Counts the <?> outside of quotes of each item in <placeholdersCounts>.
+     *
+     * @param list
+     * @param placeholdersCounts
+     * @return The trimmed items.
+     */
+    auto splitList( std::string_view list, std::vector<u_int> & placeholdersCounts ) -> std::vector<std::string_view>
+    {
+
+        std::vector<std::string_view> items;
+        size_t itemBegin         {};
+        u_int  placeholdersCount {};
+        int    depth             {};
+        char   quote             {};
+
+        for ( size_t index = 0; index < list.length(); index++ ) {
+
+            const char character = list [index];
+
+            if ( 0 != quote ) {
+
+                if ( '\\' == character && '`' != quote ) {
+
+                    index++;
+
+                } else if ( quote == character ) {
+
+                    quote = 0;
+
+                }
+
+            } else if ( '\'' == character || '"' == character || '`' == character ) {
+
+                quote = character;
+
+            } else if ( '?' == character ) {
+
+                placeholdersCount++;
+
+            } else if ( '(' == character ) {
+
+                depth++;
+
+            } else if ( ')' == character ) {
+
+                depth--;
+
+            } else if ( ',' == character && 0 == depth ) {
+
+                items.push_back( trim( list.substr( itemBegin, index - itemBegin ) ) );
+                placeholdersCounts.push_back( std::exchange( placeholdersCount, 0 ) );
+                itemBegin = index + 1;
+
+            }
+
+        }
+
+        items.push_back( trim( list.substr( itemBegin ) ) );
+        placeholdersCounts.push_back( placeholdersCount );
+
+        return items;
+
+    }
+
+    [[noreturn]] auto throwUpsertException( std::string_view reason, std::string_view mysqlCommand ) -> void
+    {
+
+        std::cerr
+            << "Exception #18: The upsert cannot be built - " << reason << "." << std::endl
+            << "[" << mysqlCommand << "]" << std::endl;
+        throw FaF::Exception();
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * The MySQL command is an INSERT with all bind variables in one VALUES tuple. If it has no ON DUPLICATE KEY UPDATE
+     * clause, one is added which updates each column that is not a key column with the new value - then the command
+     * needs a column list and the key bind variables must be values of columns. A command with its own clause needs
+     * <combine>: the clause can combine the new values with the stored ones, which replaced rows would lose.
+     *
+     * @param mysqlConnection
+     * @param mysqlCommand
+     * @param upsertOptions
+     */
+    MySqlExtBindUpsert::MySqlExtBindUpsert( MYSQL * mysqlConnection, std::string_view mysqlCommand, const UpsertOptions & upsertOptions )
+    :
+        m_templateExtBind( nullptr, mysqlCommand ),
+        m_upsertOptions  ( upsertOptions ),
+        m_upsertCommand  ( buildUpsertCommand( m_templateExtBind, mysqlCommand, upsertOptions ) ),
+        m_batch          ( mysqlConnection, m_upsertCommand, upsertOptions.maxRowsPerStatement )
+    {
+
+        for ( const std::string & keyVariable : m_upsertOptions.keyVariables ) {
+
+            m_keyPositions.push_back( m_templateExtBind.bindPosition( keyVariable ) );
+
+        }
+
+        if ( m_upsertOptions.orderByKey ) {
+
+            m_batch.orderByKey( m_upsertOptions.keyVariables );
+
+        }
+        m_batch.bisectLockErrors( m_upsertOptions.bisectLockErrors );
+
+    }
+
+    /**
+     * Returns <mysqlCommand> with the generated ON DUPLICATE KEY UPDATE clause if it has none - the new values are
+     * read from the row alias <new>, which needs MySQL 8.0.19. A command without VALUES tuple is returned unchanged -
+     * MySqlExtBindBatch rejects it.
+     *
+     * @param templateExtBind
+     * @param mysqlCommand
+     * @param upsertOptions
+     * @return
+     */
+    auto MySqlExtBindUpsert::buildUpsertCommand( const MySqlExtBind & templateExtBind, std::string_view mysqlCommand,
+                                                 const UpsertOptions & upsertOptions ) -> std::string
+    {
+
+        if ( upsertOptions.keyVariables.empty() ) {
+
+            throwUpsertException( "no key bind variable has been declared", mysqlCommand );
+
+        }
+
+        // Throws exception #3 if a key bind variable is not used in the command.
+        std::vector<u_int> keyPositions;
+        for ( const std::string & keyVariable : upsertOptions.keyVariables ) {
+
+            keyPositions.push_back( templateExtBind.bindPosition( keyVariable ) );
+
+        }
+
+        const std::optional<ValuesClause> valuesClause = MySqlExtBindBatch::findValuesClause( templateExtBind.adjustedMysqlCommand() );
+        if ( false == valuesClause.has_value() ) {
+
+            return std::string( mysqlCommand );
+
+        }
+
+        static const std::regex duplicateKeyRegex( R"(^\s*(?:AS\s+[^\s(]+(?:\s*\([^()]*\))?\s+)?ON\s+DUPLICATE\s+KEY\s+UPDATE\s)", std::regex::icase );
+        static const std::regex prefixRegex( R"(^\s*INSERT(\s+IGNORE)?\s+(?:INTO\s+)?(.+?)\s*\(([^()]*)\)\s*VALUES?\s*$)", std::regex::icase );
+
+        if ( std::regex_search( valuesClause->suffix.begin(), valuesClause->suffix.end(), duplicateKeyRegex ) ) {
+
+            if ( nullptr == upsertOptions.combine ) {
+
+                throwUpsertException( "the command has its own ON DUPLICATE KEY UPDATE clause, so merged rows need a combine function", mysqlCommand );
+
+            }
+
+            return std::string( mysqlCommand );
+
+        }
+
+        std::match_results<std::string_view::const_iterator> prefixMatch;
+        std::vector<std::string_view> columns;
+        std::vector<std::string_view> expressions;
+        std::vector<u_int>            columnsPlaceholders;
+        std::vector<u_int>            placeholdersCounts;
+
+        if ( false == trim( valuesClause->suffix ).empty() ||
+             false == std::regex_match( valuesClause->prefix.begin(), valuesClause->prefix.end(), prefixMatch, prefixRegex ) ) {
+
+            throwUpsertException( "the ON DUPLICATE KEY UPDATE clause can only be added to INSERT INTO table (columns) VALUES (...)", mysqlCommand );
+
+        }
+
+        const std::string_view prefix = valuesClause->prefix;
+        columns     = splitList( prefix.substr( static_cast<size_t>( prefixMatch.position( 3 ) ), static_cast<size_t>( prefixMatch.length( 3 ) ) ),
+                                 columnsPlaceholders );
+        expressions = splitList( valuesClause->tuple.substr( 1, valuesClause->tuple.length() - 2 ), placeholdersCounts );
+
+        if ( columns.size() != expressions.size() ) {
+
+            throwUpsertException( "the VALUES tuple needs one value per column", mysqlCommand );
+
+        }
+
+        std::string assignments;
+        size_t      keyColumnsCount  {};
+        u_int       placeholderIndex {};
+
+        for ( size_t index = 0; index < columns.size(); index++ ) {
+
+            const bool isKeyColumn = "?" == expressions [index] &&
+                                     keyPositions.end() != std::find( keyPositions.begin(), keyPositions.end(), placeholderIndex );
+
+            if ( isKeyColumn ) {
+
+                keyColumnsCount++;
+
+            } else {
+
+                assignments.append( assignments.empty() ? "" : ", " )
+                           .append( columns [index] ).append( " = new." ).append( columns [index] );
+
+            }
+
+            placeholderIndex += placeholdersCounts [index];
+
+        }
+
+        if ( keyColumnsCount != keyPositions.size() ) {
+
+            throwUpsertException( "each key bind variable must be the value of its own column", mysqlCommand );
+
+        }
+
+        // Only key columns - an existing row stays as it is.
+        if ( assignments.empty() ) {
+
+            assignments.append( columns.front() ).append( " = " ).append( columns.front() );
+
+        }
+
+        return std::string( trim( mysqlCommand ) ).append( " AS new ON DUPLICATE KEY UPDATE " ).append( assignments );
+
+    }
+
+    /**
+     * Captures the bound values of <boundExtBind> - it must have been constructed with the same MySQL command.
+     *
+     * @param boundExtBind
+     */
+    auto MySqlExtBindUpsert::add( MySqlExtBind & boundExtBind ) -> void
+    {
+
+        add( boundExtBind.captureRow() );
+
+    }
+
+    /**
+     * Merges <boundRow> into the pending row with the same key - it replaces the pending row or is combined with it
+     * by <combine>. A row with a new key is appended.
+     *
+     * @param boundRow
+     */
+    auto MySqlExtBindUpsert::add( BoundRow && boundRow ) -> void
+    {
+
+        m_batch.checkRow( boundRow );
+
+        // NULL is never a duplicate key.
+        if ( false == rowKey( boundRow ) ) {
+
+            m_pendingRows.push_back( std::move( boundRow ) );
+            return;
+
+        }
+
+        auto [foundRow, inserted] = m_rowIndexes.try_emplace( m_rowKey, m_pendingRows.size() );
+        if ( inserted ) {
+
+            m_pendingRows.push_back( std::move( boundRow ) );
+            return;
+
+        }
+
+        BoundRow & pendingRow = m_pendingRows [foundRow->second];
+        if ( nullptr == m_upsertOptions.combine ) {
+
+            pendingRow = std::move( boundRow );
+
+        } else {
+
+            m_upsertOptions.combine( pendingRow, boundRow );
+
+        }
+
+        m_mergedRows++;
+
+    }
+
+    /**
+     * Executes the merged rows. Returns the MySQL error code for each of them in the order of their first add().
+     * The pending rows are removed in any case.
+     *
+     * @return
+     */
+    auto MySqlExtBindUpsert::execute() -> std::vector<unsigned int>
+    {
+
+        for ( BoundRow & pendingRow : m_pendingRows ) {
+
+            m_batch.add( std::move( pendingRow ) );
+
+        }
+
+        m_pendingRows.clear();
+        m_rowIndexes.clear();
+
+        return m_batch.execute();
+
+    }
+
+    /**
+     * Sets m_rowKey to the values of the key bind variables - for each value its length and bytes.
+     *
+     * @param boundRow
+     * @return false if a key value is NULL.
+     */
+    auto MySqlExtBindUpsert::rowKey( const BoundRow & boundRow ) -> bool
+    {
+
+        m_rowKey.clear();
+
+        for ( const u_int keyPosition : m_keyPositions ) {
+
+            const MYSQL_BIND & mysqlBindItem = boundRow.bindArray() [keyPosition];
+
+            if ( BoundRow::isNullValue( mysqlBindItem ) ) {
+
+                return false;
+
+            }
+
+            const size_t valueLength = BoundRow::valueLength( mysqlBindItem );
+
+            m_rowKey.append( reinterpret_cast<const char *>( &valueLength ), sizeof( valueLength ) );
+            if ( 0 != valueLength ) {
+
+                m_rowKey.append( static_cast<const char *>( mysqlBindItem.buffer ), valueLength );
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+}
@@ -0,0 +1,93 @@
+/**
+ * MySqlExtBindUpsert.h
+ *
+ * Header for the MySqlExtBindUpsert class - collects the rows of an INSERT ... ON DUPLICATE KEY UPDATE command,
+ * merges the rows with the same key and executes them with MySqlExtBindBatch.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_UPSERT_H
+#define FAF_MYSQL_EXT_BIND_UPSERT_H
+
+#include <functional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MySqlExtBindBatch.h"
+
+namespace FaF
+{
+
+    /**
+     * <keyVariables> are the bind variables of the unique key - rows with the same values are merged.
+     * Without <combine> the last added row wins, otherwise it's called with the pending row and the added row - a command
+     * with its own ON DUPLICATE KEY UPDATE clause needs it.
+     * With <orderByKey> the merged rows are executed in the order of the key - see MySqlExtBindBatch::orderByKey(),
+     * <bisectLockErrors> is passed to MySqlExtBindBatch::bisectLockErrors().
+     */
+    using UpsertOptions = struct UpsertOptions
+    {
+
+            std::vector<std::string>    keyVariables;
+            std::function<void( BoundRow & pendingRow, const BoundRow & addedRow )> combine;
+            u_int                       maxRowsPerStatement { 1000 };
+            bool                        orderByKey       {};
+            bool                        bisectLockErrors {};
+
+    };
+
+    class MySqlExtBindUpsert
+    {
+
+        public:
+
+            MySqlExtBindUpsert( MYSQL * mysqlConnection, std::string_view mysqlCommand, const UpsertOptions & upsertOptions );
+
+            MySqlExtBindUpsert( const MySqlExtBindUpsert & )             = delete;
+            MySqlExtBindUpsert & operator=( const MySqlExtBindUpsert & ) = delete;
+
+            auto add( MySqlExtBind & boundExtBind ) -> void;
+            auto add( BoundRow && boundRow )        -> void;
+            auto pendingRows() const                -> size_t { return m_pendingRows.size(); }
+            auto mergedRows()  const                -> unsigned long long { return m_mergedRows; }
+            auto execute()                          -> std::vector<unsigned int>;
+
+            auto bindPosition( std::string_view bindVariable ) const -> u_int { return m_templateExtBind.bindPosition( bindVariable ); }
+            auto upsertCommand() const -> std::string_view { return m_upsertCommand; }
+
+        private:
+
+            static auto buildUpsertCommand( const MySqlExtBind & templateExtBind, std::string_view mysqlCommand,
+                                            const UpsertOptions & upsertOptions ) -> std::string;
+            auto rowKey( const BoundRow & boundRow ) -> bool;
+
+            // constructor initialiser list - respect the order.
+
+                // Only used to parse the MySQL command.
+                MySqlExtBind        m_templateExtBind;
+                UpsertOptions       m_upsertOptions;
+                std::string         m_upsertCommand;
+                MySqlExtBindBatch   m_batch;
+
+            // The positions of <keyVariables> in a BoundRow.
+            std::vector<u_int>      m_keyPositions;
+
+            // The merged rows in the order of their first add() and their indexes by the key.
+            std::vector<BoundRow>   m_pendingRows;
+            std::unordered_map<std::string, size_t> m_rowIndexes;
+            unsigned long long      m_mergedRows {};
+
+            // Reused for each row.
+            std::string             m_rowKey;
+
+    };
+
+}
+
+#endif
@@ -0,0 +1,311 @@
+/**
+ * MySqlExtBindBenchmark.cpp
+ *
+ * Microbenchmarks for the construction, assignBindData() and executeBind() overhead of the extension
+ * compared with a raw mysql_stmt_bind_param() call.
+ * Link it with stub/MySqlClientStub.cpp instead of libmysqlclient, so no MySQL server is needed.
+ *
+ * Usage: MySqlExtBindBenchmark [--budget-ms N] [--max-placeholders N]
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../MySqlExtBind.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    // Every global allocation is counted, so allocations/op and bytes/op can be reported.
+    std::atomic<size_t> g_allocationsCount {};
+    std::atomic<size_t> g_allocatedBytes   {};
+
+    struct Dialect
+    {
+
+            const char * name;
+            const char * leftDelimiter;
+            const char * rightDelimiter;
+            // The delimiters as they appear in the SQL command, without the regex escaping.
+            const char * leftMarker;
+            const char * rightMarker;
+
+    };
+
+    const Dialect g_dialects [] {
+        { ":name",   ":",      "",      ":",  ""  },
+        { ":{name}", ":\\{",   "\\}",   ":{", "}" },
+        { "[^name$]", "\\[\\^", "\\$\\]", "[^", "$]" },
+    };
+
+    struct Measurement
+    {
+
+            size_t  iterations {};
+            double  nsPerOp    {};
+            double  allocsPerOp {};
+            double  bytesPerOp {};
+
+    };
+
+    /**
+     * Runs <operation> until the time budget is used up and at least one iteration has been done.
+     * Each call of <operation> counts for <opsPerCall> operations.
+     *
+     * @param budget
+     * @param opsPerCall
+     * @param operation
+     * @return
+     */
+    template < typename Operation >
+    auto measure( std::chrono::nanoseconds budget, size_t opsPerCall, Operation && operation ) -> Measurement
+    {
+
+        using Clock = std::chrono::steady_clock;
+
+        // One warm-up call, so lazy initialisations are not measured.
+        operation();
+
+        const size_t allocationsStart = g_allocationsCount.load( std::memory_order_relaxed );
+        const size_t bytesStart       = g_allocatedBytes.load  ( std::memory_order_relaxed );
+
+        Measurement measurement {};
+        const auto  startTime = Clock::now();
+        auto        elapsed   = Clock::duration {};
+
+        do {
+
+            operation();
+            measurement.iterations++;
+            elapsed = Clock::now() - startTime;
+
+        } while ( elapsed < budget );
+
+        const double operations = static_cast<double>( measurement.iterations * opsPerCall );
+
+        measurement.nsPerOp     = static_cast<double>( std::chrono::duration_cast<std::chrono::nanoseconds>( elapsed ).count() ) / operations;
+        measurement.allocsPerOp = static_cast<double>( g_allocationsCount.load( std::memory_order_relaxed ) - allocationsStart ) / operations;
+        measurement.bytesPerOp  = static_cast<double>( g_allocatedBytes.load  ( std::memory_order_relaxed ) - bytesStart       ) / operations;
+
+        return measurement;
+
+    }
+
+    auto report( const char * caseName, const Dialect & dialect, size_t placeholders, const Measurement & measurement ) -> void
+    {
+
+        std::printf( "%-22s %-10s %8zu %10zu %14.1f %12.2f %12.1f\n",
+                     caseName, dialect.name, placeholders, measurement.iterations,
+                     measurement.nsPerOp, measurement.allocsPerOp, measurement.bytesPerOp );
+
+    }
+
+    auto buildMysqlCommand( const Dialect & dialect, const std::vector<std::string> & bindNames ) -> std::string
+    {
+
+        std::string mysqlCommand { "INSERT INTO bench VALUES (" };
+
+        for ( size_t index = 0; index < bindNames.size(); index++ ) {
+
+            mysqlCommand += ( 0 == index ? "" : ", " );
+            mysqlCommand += dialect.leftMarker + bindNames [index] + dialect.rightMarker;
+
+        }
+
+        return mysqlCommand + ")";
+
+    }
+
+}
+
+void * operator new( size_t size )
+{
+
+    g_allocationsCount.fetch_add( 1,    std::memory_order_relaxed );
+    g_allocatedBytes.fetch_add  ( size, std::memory_order_relaxed );
+
+    if ( void * memory = std::malloc( 0 == size ? 1 : size ) ) {
+
+        return memory;
+
+    }
+
+    throw std::bad_alloc();
+
+}
+
+void * operator new[]( size_t size )
+{
+
+    return operator new( size );
+
+}
+
+void operator delete( void * memory ) noexcept
+{
+
+    std::free( memory );
+
+}
+
+void operator delete[]( void * memory ) noexcept
+{
+
+    std::free( memory );
+
+}
+
+void operator delete( void * memory, size_t ) noexcept
+{
+
+    std::free( memory );
+
+}
+
+void operator delete[]( void * memory, size_t ) noexcept
+{
+
+    std::free( memory );
+
+}
+
+int main( int argc, char * argv [] )
+{
+
+    std::chrono::milliseconds budget { 200 };
+    size_t maxPlaceholders { 65535 };
+
+    for ( int index = 1; index + 1 < argc; index += 2 ) {
+
+        const std::string option { argv [index] };
+
+        if ( "--budget-ms" == option ) {
+
+            budget = std::chrono::milliseconds( std::strtoul( argv [index + 1], nullptr, 10 ) );
+
+        } else if ( "--max-placeholders" == option ) {
+
+            maxPlaceholders = std::strtoul( argv [index + 1], nullptr, 10 );
+
+        }
+
+    }
+
+    // Copying the bind arrays would be measured as well.
+    FaF::MySqlClientStub::setRecording( false );
+
+    MYSQL_STMT * mysqlStatement = mysql_stmt_init( nullptr );
+    int          intValue       { 2804 };
+
+    std::printf( "%-22s %-10s %8s %10s %14s %12s %12s\n",
+                 "case", "dialect", "binds", "iterations", "ns/op", "allocs/op", "bytes/op" );
+
+    for ( size_t placeholders : { 1, 16, 256, 4096, 65535 } ) {
+
+        if ( placeholders > maxPlaceholders ) {
+
+            break;
+
+        }
+
+        std::vector<std::string> bindNames;
+        for ( size_t index = 0; index < placeholders; index++ ) {
+
+            bindNames.push_back( "p" + std::to_string( index ) );
+
+        }
+
+        // The baseline: what the caller would do without the extension.
+        {
+
+            std::vector<MYSQL_BIND> mysqlBindArray( placeholders );
+            const Measurement measurement = measure( budget, 1, [&]
+            {
+
+                for ( auto & mysqlBindItem : mysqlBindArray ) {
+
+                    mysqlBindItem.buffer_type = MYSQL_TYPE_LONG;
+                    mysqlBindItem.buffer      = &intValue;
+
+                }
+                mysql_stmt_bind_param( mysqlStatement, mysqlBindArray.data() );
+
+            } );
+            report( "raw bind_param", g_dialects [0], placeholders, measurement );
+
+        }
+
+        for ( const Dialect & dialect : g_dialects ) {
+
+            FaF::MySqlExtBind::setDelimiters( dialect.leftDelimiter, dialect.rightDelimiter );
+            const std::string mysqlCommand { buildMysqlCommand( dialect, bindNames ) };
+
+            report( "construct", dialect, placeholders, measure( budget, 1, [&]
+            {
+
+                FaF::MySqlExtBind fafExtBind( mysqlStatement, mysqlCommand );
+
+            } ) );
+
+            FaF::MySqlExtBind fafExtBind( mysqlStatement, mysqlCommand );
+
+            report( "assign by name", dialect, placeholders, measure( budget, placeholders, [&]
+            {
+
+                for ( const auto & bindName : bindNames ) {
+
+                    fafExtBind.assignBindData( bindName, MYSQL_TYPE_LONG, &intValue );
+
+                }
+
+            } ) );
+
+            MYSQL_BIND mysqlBindItem {};
+            mysqlBindItem.buffer_type = MYSQL_TYPE_LONG;
+            mysqlBindItem.buffer      = &intValue;
+
+            report( "assign by struct", dialect, placeholders, measure( budget, placeholders, [&]
+            {
+
+                for ( const auto & bindName : bindNames ) {
+
+                    fafExtBind.assignBindData( bindName, mysqlBindItem );
+
+                }
+
+            } ) );
+
+            // executeBind() requires all bind variables to be assigned again, so the assignments are included.
+            report( "assign + executeBind", dialect, placeholders, measure( budget, 1, [&]
+            {
+
+                for ( const auto & bindName : bindNames ) {
+
+                    fafExtBind.assignBindData( bindName, mysqlBindItem );
+
+                }
+                fafExtBind.executeBind();
+
+            } ) );
+
+        }
+
+    }
+
+    FaF::MySqlExtBind::setDelimiters();
+    mysql_stmt_close( mysqlStatement );
+
+    return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,286 @@
+/**
+ * MySqlExtBindConcurrency.cpp
+ *
+ * Concurrency scaling benchmark for the statement construction, binding and execution.
+ * Runs the phases with 1, 2, 4 ... N threads against stub/MySqlClientStub.cpp and reports the throughput
+ * per wall second and per CPU second. A phase is flagged if the throughput per CPU second drops compared
+ * with one thread [shared cache lines, atomics, spinning] or if the threads do not get the CPU although
+ * cores are free [blocking on locks].
+ *
+ * Usage: MySqlExtBindConcurrency [--threads N] [--duration-ms N] [--placeholders N]
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../MySqlExtBind.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    using Clock = std::chrono::steady_clock;
+
+    // Below this fraction of the single thread throughput per CPU second a phase is flagged.
+    constexpr double g_efficiencyThreshold  { 0.7 };
+    // Below this fraction of the available CPU time a phase is flagged.
+    constexpr double g_utilisationThreshold { 0.9 };
+
+    enum class Phase
+    {
+        construct,
+        bind,
+        execute
+    };
+
+    auto phaseName( Phase phase ) -> const char *
+    {
+
+        switch ( phase ) {
+
+            case Phase::construct: return "construct";
+            case Phase::bind:      return "bind";
+            case Phase::execute:   return "execute";
+
+        }
+
+        return "";
+
+    }
+
+    auto threadCpuSeconds() -> double
+    {
+
+        timespec cpuTime {};
+        clock_gettime( CLOCK_THREAD_CPUTIME_ID, &cpuTime );
+
+        return static_cast<double>( cpuTime.tv_sec ) + static_cast<double>( cpuTime.tv_nsec ) / 1e9;
+
+    }
+
+    struct Result
+    {
+
+            double operationsPerSecond    {};
+            double operationsPerCpuSecond {};
+            double cpuUtilisation         {};
+
+    };
+
+    /**
+     * One statement per thread:
+     *   construct - the constructor only,
+     *   bind      - assignBindData() for all bind variables and executeBind(),
+     *   execute   - everything: construct, prepareStatement(), bind and mysql_stmt_execute().
+     *
+     * @param phase
+     * @param threadsCount
+     * @param duration
+     * @param mysqlCommand
+     * @param bindNames
+     * @return
+     */
+    auto runPhase( Phase phase, unsigned int threadsCount, std::chrono::milliseconds duration,
+                   const std::string & mysqlCommand, const std::vector<std::string> & bindNames ) -> Result
+    {
+
+        std::atomic<unsigned int> readyThreads {};
+        std::atomic<bool>         startFlag    {};
+        std::atomic<bool>         stopFlag     {};
+        std::vector<size_t>       operations ( threadsCount );
+        std::vector<double>       cpuSeconds ( threadsCount );
+        std::vector<std::thread>  threads;
+
+        for ( unsigned int threadIndex = 0; threadIndex < threadsCount; threadIndex++ ) {
+
+            threads.emplace_back( [&, threadIndex]
+            {
+
+                MYSQL_STMT *      mysqlStatement = mysql_stmt_init( nullptr );
+                FaF::MySqlExtBind boundExtBind( mysqlStatement, mysqlCommand );
+                int               intValue { static_cast<int>( threadIndex ) };
+                size_t            threadOperations {};
+
+                readyThreads++;
+                while ( false == startFlag.load( std::memory_order_acquire ) ) {
+
+                    std::this_thread::yield();
+
+                }
+
+                const double cpuStart = threadCpuSeconds();
+
+                while ( false == stopFlag.load( std::memory_order_relaxed ) ) {
+
+                    if ( Phase::construct == phase ) {
+
+                        FaF::MySqlExtBind fafExtBind( mysqlStatement, mysqlCommand );
+
+                    } else if ( Phase::bind == phase ) {
+
+                        for ( const auto & bindName : bindNames ) {
+
+                            boundExtBind.assignBindData( bindName, MYSQL_TYPE_LONG, &intValue );
+
+                        }
+                        boundExtBind.executeBind();
+
+                    } else {
+
+                        FaF::MySqlExtBind fafExtBind( mysqlStatement, mysqlCommand );
+                        fafExtBind.prepareStatement();
+                        for ( const auto & bindName : bindNames ) {
+
+                            fafExtBind.assignBindData( bindName, MYSQL_TYPE_LONG, &intValue );
+
+                        }
+                        fafExtBind.executeBind();
+                        mysql_stmt_execute( mysqlStatement );
+
+                    }
+
+                    threadOperations++;
+
+                }
+
+                cpuSeconds [threadIndex] = threadCpuSeconds() - cpuStart;
+                operations [threadIndex] = threadOperations;
+                mysql_stmt_close( mysqlStatement );
+
+            } );
+
+        }
+
+        while ( readyThreads.load() < threadsCount ) {
+
+            std::this_thread::yield();
+
+        }
+
+        const auto startTime = Clock::now();
+        startFlag.store( true, std::memory_order_release );
+        std::this_thread::sleep_for( duration );
+        stopFlag.store( true );
+
+        for ( auto & thread : threads ) {
+
+            thread.join();
+
+        }
+
+        const double wallSeconds = std::chrono::duration<double>( Clock::now() - startTime ).count();
+
+        size_t totalOperations {};
+        double totalCpuSeconds {};
+        for ( unsigned int threadIndex = 0; threadIndex < threadsCount; threadIndex++ ) {
+
+            totalOperations += operations [threadIndex];
+            totalCpuSeconds += cpuSeconds [threadIndex];
+
+        }
+
+        // The threads can use at most one core each.
+        const unsigned int coresCount    = std::max( 1U, std::thread::hardware_concurrency() );
+        const double       availableCpu  = wallSeconds * std::min( threadsCount, coresCount );
+
+        return Result {
+            static_cast<double>( totalOperations ) / wallSeconds,
+            0.0 < totalCpuSeconds ? static_cast<double>( totalOperations ) / totalCpuSeconds : 0.0,
+            totalCpuSeconds / availableCpu
+        };
+
+    }
+
+}
+
+int main( int argc, char * argv [] )
+{
+
+    unsigned int              maxThreads   { std::max( 1U, std::thread::hardware_concurrency() ) };
+    std::chrono::milliseconds duration     { 500 };
+    size_t                    placeholders { 8 };
+
+    for ( int index = 1; index + 1 < argc; index += 2 ) {
+
+        const std::string option { argv [index] };
+
+        if ( "--threads" == option ) {
+
+            maxThreads = static_cast<unsigned int>( std::stoul( argv [index + 1] ) );
+
+        } else if ( "--duration-ms" == option ) {
+
+            duration = std::chrono::milliseconds( std::stoul( argv [index + 1] ) );
+
+        } else if ( "--placeholders" == option ) {
+
+            placeholders = std::stoul( argv [index + 1] );
+
+        }
+
+    }
+
+    FaF::MySqlClientStub::setRecording( false );
+
+    std::vector<std::string> bindNames;
+    std::string              mysqlCommand { "INSERT INTO bench VALUES (" };
+    for ( size_t index = 0; index < placeholders; index++ ) {
+
+        bindNames.push_back( "p" + std::to_string( index ) );
+        mysqlCommand += ( 0 == index ? ":" : ", :" ) + bindNames.back();
+
+    }
+    mysqlCommand += ")";
+
+    std::printf( "%-10s %8s %14s %14s %14s %10s %8s\n",
+                 "phase", "threads", "ops/s", "ops/s/thread", "ops/cpu-s", "cpu-util", "" );
+
+    // 1, 2, 4 ... and finally <maxThreads>.
+    std::vector<unsigned int> threadCounts;
+    for ( unsigned int threadsCount = 1; threadsCount < maxThreads; threadsCount *= 2 ) {
+
+        threadCounts.push_back( threadsCount );
+
+    }
+    threadCounts.push_back( maxThreads );
+
+    for ( Phase phase : { Phase::construct, Phase::bind, Phase::execute } ) {
+
+        double singleThreadPerCpuSecond {};
+
+        for ( unsigned int threadsCount : threadCounts ) {
+
+            const Result result = runPhase( phase, threadsCount, duration, mysqlCommand, bindNames );
+
+            if ( 1 == threadsCount ) {
+
+                singleThreadPerCpuSecond = result.operationsPerCpuSecond;
+
+            }
+
+            const bool contention =
+                result.operationsPerCpuSecond < g_efficiencyThreshold  * singleThreadPerCpuSecond ||
+                result.cpuUtilisation         < g_utilisationThreshold;
+
+            std::printf( "%-10s %8u %14.0f %14.0f %14.0f %9.0f%% %8s\n",
+                         phaseName( phase ), threadsCount, result.operationsPerSecond,
+                         result.operationsPerSecond / threadsCount, result.operationsPerCpuSecond,
+                         result.cpuUtilisation * 100.0, contention ? "CONTENDED" : "" );
+
+        }
+
+    }
+
+    return EXIT_SUCCESS;
+
+}
@@ -0,0 +1,928 @@
+/**
+ * MySqlExtBindEndToEnd.cpp
+ *
+ * End-to-end throughput benchmark against a throwaway local mysqld instance.
+ * If mysqld is available - in $MYSQLD or in $PATH - a new data directory is initialised in /tmp and the server
+ * is started on a Unix socket without networking. Scripted insert and select workloads are run through the
+ * extension in several modes and rows/s and the p50/p99/p999 latencies are reported per mode.
+ * The benchmark is skipped with exit code 0 if mysqld is not found.
+ * With --stand-in the workloads run against MySqlStandInServer instead, which answers each command after the
+ * given latency in microseconds - deterministic and without mysqld.
+ *
+ * Usage: MySqlExtBindEndToEnd [--rows N] [--selects N] [--stand-in LATENCY_US]
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cinttypes>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <ftw.h>
+#include <memory>
+#include <pwd.h>
+#include <random>
+#include <string>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "../MySqlExtBind.h"
+#include "../MySqlExtBindBatch.h"
+#include "../MySqlExtBindLoader.h"
+#include "../MySqlExtBindPipeline.h"
+#include "../MySqlExtBindRender.h"
+#include "../stub/MySqlStandInServer.h"
+
+namespace
+{
+
+    using Clock = std::chrono::steady_clock;
+
+    [[noreturn]] auto fail( const std::string & message ) -> void
+    {
+
+        std::cerr << "MySqlExtBindEndToEnd: " << message << std::endl;
+        std::exit( EXIT_FAILURE );
+
+    }
+
+    auto checkConnection( bool failed, MYSQL * mysqlConnection, const char * what ) -> void
+    {
+
+        if ( failed ) {
+
+            fail( std::string( what ) + ": " + mysql_error( mysqlConnection ) );
+
+        }
+
+    }
+
+    auto checkStatement( bool failed, MYSQL_STMT * mysqlStatement, const char * what ) -> void
+    {
+
+        if ( failed ) {
+
+            fail( std::string( what ) + ": " + mysql_stmt_error( mysqlStatement ) );
+
+        }
+
+    }
+
+    /**
+     * Looks for mysqld in $MYSQLD, $PATH and the usual sbin directories.
+     *
+     * @return The path or an empty string.
+     */
+    auto findMysqld() -> std::string
+    {
+
+        if ( const char * mysqldPath = std::getenv( "MYSQLD" ) ) {
+
+            return mysqldPath;
+
+        }
+
+        std::string searchPath { std::getenv( "PATH" ) ? std::getenv( "PATH" ) : "" };
+        searchPath += ":/usr/sbin:/usr/local/sbin:/usr/local/mysql/bin";
+
+        size_t startPosition {};
+        while ( startPosition <= searchPath.length() ) {
+
+            size_t endPosition = searchPath.find( ':', startPosition );
+            if ( std::string::npos == endPosition ) {
+
+                endPosition = searchPath.length();
+
+            }
+
+            const std::string candidate { searchPath.substr( startPosition, endPosition - startPosition ) + "/mysqld" };
+            if ( 0 == access( candidate.c_str(), X_OK ) ) {
+
+                return candidate;
+
+            }
+            startPosition = endPosition + 1;
+
+        }
+
+        return {};
+
+    }
+
+    /**
+     * Connects as root to the server on <socketPath>, waiting up to 60 seconds until it accepts connections.
+     *
+     * @param socketPath
+     * @return
+     */
+    auto connectTo( const std::string & socketPath ) -> MYSQL *
+    {
+
+        const auto deadline = Clock::now() + std::chrono::seconds( 60 );
+
+        while ( true ) {
+
+            MYSQL *            mysqlConnection = mysql_init( nullptr );
+            const unsigned int localInfile     = 1;
+            mysql_options( mysqlConnection, MYSQL_OPT_LOCAL_INFILE, &localInfile );
+            if ( nullptr != mysql_real_connect( mysqlConnection, nullptr, "root", nullptr, nullptr, 0, socketPath.c_str(), 0 ) ) {
+
+                return mysqlConnection;
+
+            }
+
+            const std::string errorMessage { mysql_error( mysqlConnection ) };
+            mysql_close( mysqlConnection );
+
+            if ( Clock::now() > deadline ) {
+
+                fail( "Cannot connect to " + socketPath + ": " + errorMessage );
+
+            }
+            std::this_thread::sleep_for( std::chrono::milliseconds( 200 ) );
+
+        }
+
+    }
+
+    /**
+     * A mysqld instance in its own temporary directory. The destructor stops the server and removes the directory.
+     */
+    class LocalServer
+    {
+
+        public:
+
+            LocalServer( const std::string & mysqldPath )
+            {
+
+                char directoryTemplate [] { "/tmp/MySqlExtBind.XXXXXX" };
+                if ( nullptr == mkdtemp( directoryTemplate ) ) {
+
+                    fail( "mkdtemp() failed" );
+
+                }
+
+                m_directory  = directoryTemplate;
+                m_socketPath = m_directory + "/mysqld.sock";
+
+                const passwd *    userEntry = getpwuid( geteuid() );
+                const std::string userName  { nullptr == userEntry ? "mysql" : userEntry->pw_name };
+
+                const std::vector<std::string> commonArguments {
+                    mysqldPath,
+                    "--no-defaults",
+                    "--datadir="   + m_directory + "/data",
+                    "--log-error=" + m_directory + "/error.log",
+                    "--user="      + userName
+                };
+
+                // Initialise the data directory - the root account has no password.
+                std::vector<std::string> initialiseArguments { commonArguments };
+                initialiseArguments.push_back( "--initialize-insecure" );
+                if ( 0 != waitForExit( spawn( initialiseArguments ) ) ) {
+
+                    fail( "mysqld --initialize-insecure failed, see " + m_directory + "/error.log" );
+
+                }
+
+                std::vector<std::string> serverArguments { commonArguments };
+                serverArguments.push_back( "--socket="   + m_socketPath );
+                serverArguments.push_back( "--pid-file=" + m_directory + "/mysqld.pid" );
+                serverArguments.push_back( "--skip-networking" );
+                serverArguments.push_back( "--mysqlx=OFF" );
+                serverArguments.push_back( "--local-infile=ON" );
+                m_serverProcess = spawn( serverArguments );
+
+            }
+
+            ~LocalServer()
+            {
+
+                if ( 0 < m_serverProcess ) {
+
+                    kill( m_serverProcess, SIGTERM );
+                    waitForExit( m_serverProcess );
+
+                }
+
+                nftw( m_directory.c_str(), []( const char * path, const struct stat *, int, FTW * ) { return remove( path ); },
+                      16, FTW_DEPTH | FTW_PHYS );
+
+            }
+
+            LocalServer( const LocalServer & )            = delete;
+            LocalServer & operator=( const LocalServer & ) = delete;
+
+            auto socketPath() const -> const std::string & { return m_socketPath; }
+
+        private:
+
+            static auto spawn( const std::vector<std::string> & arguments ) -> pid_t
+            {
+
+                const pid_t processId = fork();
+
+                if ( 0 == processId ) {
+
+                    std::vector<char *> argumentPointers;
+                    for ( const auto & argument : arguments ) {
+
+                        argumentPointers.push_back( const_cast<char *>( argument.c_str() ) );
+
+                    }
+                    argumentPointers.push_back( nullptr );
+
+                    execv( argumentPointers [0], argumentPointers.data() );
+                    _exit( 127 );
+
+                }
+
+                if ( 0 > processId ) {
+
+                    fail( "fork() failed" );
+
+                }
+
+                return processId;
+
+            }
+
+            static auto waitForExit( pid_t processId ) -> int
+            {
+
+                int status {};
+                waitpid( processId, &status, 0 );
+
+                return WIFEXITED( status ) ? WEXITSTATUS( status ) : -1;
+
+            }
+
+            std::string m_directory;
+            std::string m_socketPath;
+            pid_t       m_serverProcess {};
+
+    };
+
+    /**
+     * The replies of the stand-in server: each command takes <latency>, the selects return one row.
+     *
+     * @param latency
+     * @return
+     */
+    auto standInScript( std::chrono::microseconds latency ) -> FaF::StandInScript
+    {
+
+        return [latency]( const FaF::StandInCommand & standInCommand, FaF::StandInReply & standInReply )
+        {
+
+            standInReply.latency = latency;
+
+            if ( 0 != standInCommand.query.rfind( "SELECT", 0 ) ) {
+
+                return;
+
+            }
+
+            if ( COM_STMT_PREPARE == standInCommand.code ) {
+
+                standInReply.columns = { "value", "text" };
+
+            } else if ( COM_QUERY == standInCommand.code ) {
+
+                standInReply.columns = { "value", "text" };
+                standInReply.rows    = { { "7", "row-1" } };
+
+            } else if ( COM_STMT_EXECUTE == standInCommand.code ) {
+
+                standInReply.rows = { { "7", "row-1" } };
+
+            }
+
+        };
+
+    }
+
+    /**
+     * The values of one row. The MYSQL_BIND items point to these members.
+     */
+    struct Row
+    {
+
+            long long     id         {};
+            int           value      {};
+            char          text [64]  {};
+            unsigned long textLength {};
+
+            auto set( uint64_t rowId ) -> void
+            {
+
+                id         = static_cast<long long>( rowId );
+                value      = static_cast<int>( rowId * 7 );
+                textLength = static_cast<unsigned long>( std::snprintf( text, sizeof( text ), "row-%" PRIu64, rowId ) );
+
+            }
+
+    };
+
+    const char * const g_insertCommand { "INSERT INTO bench.bench_rows (id, value, text) VALUES (:id, :value, :text)" };
+    const char * const g_selectCommand { "SELECT value, text FROM bench.bench_rows WHERE id = :id" };
+
+    /**
+     * A way to run the workloads through the extension. Each call of insert() inserts rowsPerCall() rows.
+     */
+    class Mode
+    {
+
+        public:
+
+            virtual ~Mode() = default;
+
+            virtual auto name()        const -> const char * = 0;
+            virtual auto rowsPerCall() const -> size_t { return 1; }
+            virtual auto insert( uint64_t firstRowId ) -> void = 0;
+            virtual auto select( uint64_t rowId )      -> void = 0;
+
+    };
+
+    auto bindRow( FaF::MySqlExtBind & fafExtBind, Row & row ) -> void
+    {
+
+        fafExtBind.assignBindData( "id",    MYSQL_TYPE_LONGLONG, &row.id );
+        fafExtBind.assignBindData( "value", MYSQL_TYPE_LONG,     &row.value );
+        fafExtBind.assignBindData( "text",  MYSQL_TYPE_STRING,   row.text, &row.textLength );
+
+    }
+
+    /**
+     * Binds the result columns of g_selectCommand, executes the statement and fetches the row.
+     *
+     * @param mysqlStatement
+     * @param row
+     */
+    auto executeSelect( MYSQL_STMT * mysqlStatement, Row & row ) -> void
+    {
+
+        MYSQL_BIND resultBindArray [2] {};
+        resultBindArray [0].buffer_type   = MYSQL_TYPE_LONG;
+        resultBindArray [0].buffer        = &row.value;
+        resultBindArray [1].buffer_type   = MYSQL_TYPE_STRING;
+        resultBindArray [1].buffer        = row.text;
+        resultBindArray [1].buffer_length = sizeof( row.text );
+        resultBindArray [1].length        = &row.textLength;
+
+        checkStatement( 0 != mysql_stmt_execute( mysqlStatement ),                   mysqlStatement, "mysql_stmt_execute()" );
+        checkStatement( mysql_stmt_bind_result( mysqlStatement, resultBindArray ),   mysqlStatement, "mysql_stmt_bind_result()" );
+        checkStatement( 0 != mysql_stmt_fetch( mysqlStatement ),                     mysqlStatement, "mysql_stmt_fetch()" );
+        mysql_stmt_free_result( mysqlStatement );
+
+    }
+
+    /**
+     * Parses, prepares and closes the statement for every row - what a caller does without caching the statement.
+     */
+    class PerRowMode : public Mode
+    {
+
+        public:
+
+            PerRowMode( MYSQL * mysqlConnection ) : m_mysqlConnection( mysqlConnection ) {}
+
+            auto name() const -> const char * override { return "per-row"; }
+
+            auto insert( uint64_t firstRowId ) -> void override
+            {
+
+                run( g_insertCommand, firstRowId, []( MYSQL_STMT * mysqlStatement, Row & )
+                {
+
+                    checkStatement( 0 != mysql_stmt_execute( mysqlStatement ), mysqlStatement, "mysql_stmt_execute()" );
+
+                } );
+
+            }
+
+            auto select( uint64_t rowId ) -> void override
+            {
+
+                run( g_selectCommand, rowId, executeSelect );
+
+            }
+
+        private:
+
+            template < typename Executor >
+            auto run( const char * mysqlCommand, uint64_t rowId, Executor && executor ) -> void
+            {
+
+                MYSQL_STMT * mysqlStatement = mysql_stmt_init( m_mysqlConnection );
+                FaF::MySqlExtBind fafExtBind( mysqlStatement, mysqlCommand );
+
+                checkStatement( 0 != fafExtBind.prepareStatement(), mysqlStatement, "prepareStatement()" );
+
+                Row row;
+                row.set( rowId );
+                if ( mysqlCommand == g_insertCommand ) {
+
+                    bindRow( fafExtBind, row );
+
+                } else {
+
+                    fafExtBind.assignBindData( "id", MYSQL_TYPE_LONGLONG, &row.id );
+
+                }
+                checkStatement( fafExtBind.executeBind(), mysqlStatement, "executeBind()" );
+
+                executor( mysqlStatement, row );
+                mysql_stmt_close( mysqlStatement );
+
+            }
+
+            MYSQL * m_mysqlConnection;
+
+    };
+
+    /**
+     * The statements are prepared once, each row only assigns the bind data and executes.
+     */
+    class CachedMode : public Mode
+    {
+
+        public:
+
+            CachedMode( MYSQL * mysqlConnection )
+            :
+                m_insertStatement( mysql_stmt_init( mysqlConnection ) ),
+                m_selectStatement( mysql_stmt_init( mysqlConnection ) ),
+                m_insertExtBind  ( m_insertStatement, g_insertCommand ),
+                m_selectExtBind  ( m_selectStatement, g_selectCommand )
+            {
+
+                checkStatement( 0 != m_insertExtBind.prepareStatement(), m_insertStatement, "prepareStatement()" );
+                checkStatement( 0 != m_selectExtBind.prepareStatement(), m_selectStatement, "prepareStatement()" );
+
+            }
+
+            ~CachedMode() override
+            {
+
+                mysql_stmt_close( m_insertStatement );
+                mysql_stmt_close( m_selectStatement );
+
+            }
+
+            auto name() const -> const char * override { return "cached"; }
+
+            auto insert( uint64_t firstRowId ) -> void override
+            {
+
+                m_row.set( firstRowId );
+                bindRow( m_insertExtBind, m_row );
+
+                checkStatement( m_insertExtBind.executeBind(),              m_insertStatement, "executeBind()" );
+                checkStatement( 0 != mysql_stmt_execute( m_insertStatement ), m_insertStatement, "mysql_stmt_execute()" );
+
+            }
+
+            auto select( uint64_t rowId ) -> void override
+            {
+
+                m_row.set( rowId );
+                m_selectExtBind.assignBindData( "id", MYSQL_TYPE_LONGLONG, &m_row.id );
+
+                checkStatement( m_selectExtBind.executeBind(), m_selectStatement, "executeBind()" );
+                executeSelect( m_selectStatement, m_row );
+
+            }
+
+        protected:
+
+            MYSQL_STMT *      m_insertStatement;
+            MYSQL_STMT *      m_selectStatement;
+            FaF::MySqlExtBind m_insertExtBind;
+            FaF::MySqlExtBind m_selectExtBind;
+            Row               m_row;
+
+    };
+
+    /**
+     * Renders each statement with its values to SQL text with MySqlExtBindRender and sends it with mysql_real_query() -
+     * no prepared statement, so the server parses every statement, but there is no prepare round trip either.
+     */
+    class InterpolatedMode : public Mode
+    {
+
+        public:
+
+            InterpolatedMode( MYSQL * mysqlConnection )
+            :
+                m_mysqlConnection( mysqlConnection ),
+                m_insertExtBind  ( nullptr, g_insertCommand ),
+                m_selectExtBind  ( nullptr, g_selectCommand )
+            {
+            }
+
+            auto name() const -> const char * override { return "interpolated"; }
+
+            auto insert( uint64_t firstRowId ) -> void override
+            {
+
+                m_row.set( firstRowId );
+                bindRow( m_insertExtBind, m_row );
+
+                FaF::MySqlExtBindRender::render( m_mysqlConnection, m_insertExtBind, m_mysqlCommand );
+                checkConnection( 0 != mysql_real_query( m_mysqlConnection, m_mysqlCommand.data(), m_mysqlCommand.length() ),
+                                 m_mysqlConnection, "mysql_real_query()" );
+
+            }
+
+            auto select( uint64_t rowId ) -> void override
+            {
+
+                m_row.set( rowId );
+                m_selectExtBind.assignBindData( "id", MYSQL_TYPE_LONGLONG, &m_row.id );
+
+                FaF::MySqlExtBindRender::render( m_mysqlConnection, m_selectExtBind, m_mysqlCommand );
+                checkConnection( 0 != mysql_real_query( m_mysqlConnection, m_mysqlCommand.data(), m_mysqlCommand.length() ),
+                                 m_mysqlConnection, "mysql_real_query()" );
+
+                MYSQL_RES * mysqlResult = mysql_store_result( m_mysqlConnection );
+                checkConnection( nullptr == mysqlResult, m_mysqlConnection, "mysql_store_result()" );
+                checkConnection( nullptr == mysql_fetch_row( mysqlResult ), m_mysqlConnection, "mysql_fetch_row()" );
+                mysql_free_result( mysqlResult );
+
+            }
+
+        private:
+
+            MYSQL *           m_mysqlConnection;
+            FaF::MySqlExtBind m_insertExtBind;
+            FaF::MySqlExtBind m_selectExtBind;
+            Row               m_row;
+            std::string       m_mysqlCommand;
+
+    };
+
+    /**
+     * Each call collects rowsPerCall() rows with MySqlExtBindBatch and inserts them as multi-row statements.
+     * The selects are the same as in the cached mode.
+     */
+    class BatchedMode : public CachedMode
+    {
+
+        public:
+
+            BatchedMode( MYSQL * mysqlConnection )
+            :
+                CachedMode( mysqlConnection ),
+                m_batch   ( mysqlConnection, g_insertCommand, g_batchRows )
+            {
+            }
+
+            auto name()        const -> const char * override { return "batched"; }
+            auto rowsPerCall() const -> size_t       override { return g_batchRows; }
+
+            auto insert( uint64_t firstRowId ) -> void override
+            {
+
+                for ( uint64_t rowId = firstRowId; rowId < firstRowId + g_batchRows; rowId++ ) {
+
+                    m_row.set( rowId );
+                    bindRow( m_insertExtBind, m_row );
+                    m_batch.add( m_insertExtBind );
+
+                }
+
+                for ( const unsigned int errorCode : m_batch.execute() ) {
+
+                    if ( 0 != errorCode ) {
+
+                        fail( "MySqlExtBindBatch::execute(): error " + std::to_string( errorCode ) );
+
+                    }
+
+                }
+
+            }
+
+        private:
+
+            static constexpr u_int g_batchRows { 100 };
+
+            FaF::MySqlExtBindBatch m_batch;
+
+    };
+
+    /**
+     * Like the cached mode, but the inserts are encoded and sent by MySqlExtBindDirectExecutor instead of libmysqlclient.
+     */
+    class DirectMode : public CachedMode
+    {
+
+        public:
+
+            DirectMode( MYSQL * mysqlConnection )
+            :
+                CachedMode      ( mysqlConnection ),
+                m_directExecutor( m_insertStatement )
+            {
+            }
+
+            auto name() const -> const char * override { return "direct"; }
+
+            auto insert( uint64_t firstRowId ) -> void override
+            {
+
+                m_row.set( firstRowId );
+                bindRow( m_insertExtBind, m_row );
+
+                if ( const unsigned int errorCode = m_directExecutor.execute( m_insertExtBind ); 0 != errorCode ) {
+
+                    fail( "MySqlExtBindDirectExecutor::execute(): " + m_directExecutor.result().errorMessage );
+
+                }
+
+            }
+
+        private:
+
+            FaF::MySqlExtBindDirectExecutor m_directExecutor;
+
+    };
+
+    /**
+     * Each call sends rowsPerCall() single-row inserts back to back with MySqlExtBindPipeline and then reads the responses.
+     * The selects are the same as in the cached mode.
+     */
+    class PipelinedMode : public CachedMode
+    {
+
+        public:
+
+            PipelinedMode( MYSQL * mysqlConnection )
+            :
+                CachedMode( mysqlConnection ),
+                m_pipeline( mysqlConnection, g_pipelineDepth )
+            {
+            }
+
+            auto name()        const -> const char * override { return "pipelined"; }
+            auto rowsPerCall() const -> size_t       override { return g_pipelineDepth; }
+
+            auto insert( uint64_t firstRowId ) -> void override
+            {
+
+                for ( uint64_t rowId = firstRowId; rowId < firstRowId + g_pipelineDepth; rowId++ ) {
+
+                    m_row.set( rowId );
+                    bindRow( m_insertExtBind, m_row );
+                    m_pipeline.add( m_insertStatement, m_insertExtBind );
+
+                }
+
+                for ( const FaF::ExecuteResult & executeResult : m_pipeline.finish() ) {
+
+                    if ( 0 != executeResult.errorCode ) {
+
+                        fail( "MySqlExtBindPipeline::finish(): " + executeResult.errorMessage );
+
+                    }
+
+                }
+
+            }
+
+        private:
+
+            static constexpr u_int g_pipelineDepth { 16 };
+
+            FaF::MySqlExtBindPipeline m_pipeline;
+
+    };
+
+    /**
+     * Each call streams rowsPerCall() rows with MySqlExtBindLoader::load() in one LOAD DATA LOCAL INFILE.
+     * The selects are the same as in the cached mode.
+     */
+    class LoadDataMode : public CachedMode
+    {
+
+        public:
+
+            LoadDataMode( MYSQL * mysqlConnection )
+            :
+                CachedMode( mysqlConnection ),
+                m_loader  ( mysqlConnection, g_insertCommand )
+            {
+            }
+
+            auto name()        const -> const char * override { return "load-data"; }
+            auto rowsPerCall() const -> size_t       override { return g_loadRows; }
+
+            auto insert( uint64_t firstRowId ) -> void override
+            {
+
+                uint64_t rowId = firstRowId;
+
+                const unsigned int errorCode = m_loader.load( [this, &rowId, firstRowId]( FaF::MySqlExtBindLoader & rowLoader ) {
+
+                    if ( firstRowId + g_loadRows == rowId ) {
+
+                        return false;
+
+                    }
+
+                    m_row.set( rowId++ );
+                    bindRow( m_insertExtBind, m_row );
+                    rowLoader.add( m_insertExtBind );
+
+                    return true;
+
+                } );
+
+                if ( 0 != errorCode ) {
+
+                    fail( "MySqlExtBindLoader::load(): error " + std::to_string( errorCode ) );
+
+                }
+
+            }
+
+        private:
+
+            static constexpr size_t g_loadRows { 2000 };
+
+            FaF::MySqlExtBindLoader m_loader;
+
+    };
+
+    struct Result
+    {
+
+            double rowsPerSecond {};
+            double p50           {};
+            double p99           {};
+            double p999          {};
+
+    };
+
+    /**
+     * Runs <operation> <calls> times, each call handles <rowsPerCall> rows. The latencies are per call in microseconds.
+     *
+     * @param calls
+     * @param rowsPerCall
+     * @param operation
+     * @return
+     */
+    template < typename Operation >
+    auto runWorkload( size_t calls, size_t rowsPerCall, Operation && operation ) -> Result
+    {
+
+        std::vector<double> latencies;
+        latencies.reserve( calls );
+
+        const auto startTime = Clock::now();
+
+        for ( size_t call = 0; call < calls; call++ ) {
+
+            const auto callStartTime = Clock::now();
+            operation( call );
+            latencies.push_back( std::chrono::duration<double, std::micro>( Clock::now() - callStartTime ).count() );
+
+        }
+
+        const double elapsedSeconds = std::chrono::duration<double>( Clock::now() - startTime ).count();
+
+        std::sort( latencies.begin(), latencies.end() );
+        const auto percentile = [&latencies]( double fraction )
+        {
+
+            return latencies.empty() ? 0.0 : latencies [std::min( latencies.size() - 1, static_cast<size_t>( fraction * static_cast<double>( latencies.size() ) ) )];
+
+        };
+
+        return Result { static_cast<double>( calls * rowsPerCall ) / elapsedSeconds, percentile( 0.50 ), percentile( 0.99 ), percentile( 0.999 ) };
+
+    }
+
+    auto report( const char * modeName, const char * workload, const Result & result ) -> void
+    {
+
+        std::printf( "%-14s %-8s %14.0f %12.1f %12.1f %12.1f\n", modeName, workload, result.rowsPerSecond, result.p50, result.p99, result.p999 );
+
+    }
+
+}
+
+int main( int argc, char * argv [] )
+{
+
+    size_t rowsCount      { 20000 };
+    size_t selectsCount   { 20000 };
+    long   standInLatency { -1 };
+
+    for ( int index = 1; index + 1 < argc; index += 2 ) {
+
+        const std::string option { argv [index] };
+
+        if ( "--rows" == option ) {
+
+            rowsCount = std::strtoul( argv [index + 1], nullptr, 10 );
+
+        } else if ( "--selects" == option ) {
+
+            selectsCount = std::strtoul( argv [index + 1], nullptr, 10 );
+
+        } else if ( "--stand-in" == option ) {
+
+            standInLatency = std::strtol( argv [index + 1], nullptr, 10 );
+
+        }
+
+    }
+
+    std::unique_ptr<FaF::MySqlStandInServer> standInServer;
+    std::unique_ptr<LocalServer>             localServer;
+    std::string                              socketPath;
+
+    if ( 0 <= standInLatency ) {
+
+        socketPath    = "/tmp/MySqlExtBindStandIn." + std::to_string( getpid() ) + ".sock";
+        standInServer = std::make_unique<FaF::MySqlStandInServer>( socketPath, standInScript( std::chrono::microseconds( standInLatency ) ) );
+
+    } else {
+
+        const std::string mysqldPath { findMysqld() };
+        if ( mysqldPath.empty() ) {
+
+            std::cout << "MySqlExtBindEndToEnd: mysqld not found in $MYSQLD or $PATH - skipped." << std::endl;
+            return EXIT_SUCCESS;
+
+        }
+
+        localServer = std::make_unique<LocalServer>( mysqldPath );
+        socketPath  = localServer->socketPath();
+
+    }
+
+    MYSQL * mysqlConnection = connectTo( socketPath );
+
+    checkConnection( 0 != mysql_query( mysqlConnection, "CREATE DATABASE bench" ), mysqlConnection, "CREATE DATABASE" );
+    checkConnection( 0 != mysql_query( mysqlConnection,
+        "CREATE TABLE bench.bench_rows ( id BIGINT PRIMARY KEY, value INT NOT NULL, text VARCHAR(64) NOT NULL )" ), mysqlConnection, "CREATE TABLE" );
+
+    std::vector< std::unique_ptr<Mode> > modes;
+    modes.push_back( std::make_unique<PerRowMode>( mysqlConnection ) );
+    modes.push_back( std::make_unique<CachedMode>( mysqlConnection ) );
+    modes.push_back( std::make_unique<DirectMode>( mysqlConnection ) );
+    modes.push_back( std::make_unique<InterpolatedMode>( mysqlConnection ) );
+    modes.push_back( std::make_unique<PipelinedMode>( mysqlConnection ) );
+    modes.push_back( std::make_unique<BatchedMode>( mysqlConnection ) );
+    modes.push_back( std::make_unique<LoadDataMode>( mysqlConnection ) );
+
+    std::printf( "%-14s %-8s %14s %12s %12s %12s\n", "mode", "workload", "rows/s", "p50 us", "p99 us", "p999 us" );
+
+    std::mt19937_64 randomGenerator { 2804 };
+
+    for ( auto & mode : modes ) {
+
+        checkConnection( 0 != mysql_query( mysqlConnection, "TRUNCATE TABLE bench.bench_rows" ), mysqlConnection, "TRUNCATE" );
+
+        const size_t rowsPerCall = mode->rowsPerCall();
+        report( mode->name(), "insert", runWorkload( rowsCount / rowsPerCall, rowsPerCall, [&]( size_t call )
+        {
+
+            mode->insert( call * rowsPerCall );
+
+        } ) );
+
+        const size_t insertedRows = rowsCount / rowsPerCall * rowsPerCall;
+        if ( 0 == insertedRows ) {
+
+            continue;
+
+        }
+
+        report( mode->name(), "select", runWorkload( selectsCount, 1, [&]( size_t )
+        {
+
+            mode->select( randomGenerator() % insertedRows );
+
+        } ) );
+
+    }
+
+    modes.clear();
+    mysql_close( mysqlConnection );
+
+    return EXIT_SUCCESS;
+
+}
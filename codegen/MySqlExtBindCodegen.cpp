@@ -0,0 +1,543 @@
+/**
+ * MySqlExtBindCodegen.cpp
+ *
+ * Generates a C++ header with typed binders from SQL catalog files - see MySqlExtBindCatalog.cpp for the format.
+ * Each entry declares the type of its bind variables with annotation lines after the name line:
+ *
+ *   -- name: findCustomer
+ *   -- param: id     int32
+ *   -- param: name   string(64) null
+ *   SELECT * FROM customers WHERE id = :id OR name = :name
+ *
+ * For each entry a struct is generated with the command already rewritten to '?', a member per bind variable
+ * and a bind() function which fills the MYSQL_BIND array in the order of the placeholders - an entry without bind
+ * variables only gets the command. The commands are parsed by MySqlExtBind, so the rewriting is the same as at
+ * runtime - but at runtime nothing is parsed or looked up.
+ * The header is only written if its content has changed, so the dependent files aren't compiled again.
+ *
+ * Usage: MySqlExtBindCodegen --output HEADER [--namespace NAME] CATALOG.sql ...
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../MySqlExtBindCatalog.h"
+
+namespace
+{
+
+    constexpr std::string_view g_paramPrefix { "-- param:" };
+
+    using ParamType = struct ParamType
+    {
+
+            const char *                name;
+            const char *                cppType;
+            const char *                mysqlType;
+            bool                        isUnsigned;
+            // The type has a size in brackets - the member is an array with a length member.
+            bool                        sized;
+
+    };
+
+    const ParamType g_paramTypes [] {
+        { "int8",      "signed char",        "MYSQL_TYPE_TINY",      false, false },
+        { "uint8",     "unsigned char",      "MYSQL_TYPE_TINY",      true,  false },
+        { "int16",     "short",              "MYSQL_TYPE_SHORT",     false, false },
+        { "uint16",    "unsigned short",     "MYSQL_TYPE_SHORT",     true,  false },
+        { "int32",     "int",                "MYSQL_TYPE_LONG",      false, false },
+        { "uint32",    "unsigned int",       "MYSQL_TYPE_LONG",      true,  false },
+        { "int64",     "long long",          "MYSQL_TYPE_LONGLONG",  false, false },
+        { "uint64",    "unsigned long long", "MYSQL_TYPE_LONGLONG",  true,  false },
+        { "float",     "float",              "MYSQL_TYPE_FLOAT",     false, false },
+        { "double",    "double",             "MYSQL_TYPE_DOUBLE",    false, false },
+        { "date",      "MYSQL_TIME",         "MYSQL_TYPE_DATE",      false, false },
+        { "time",      "MYSQL_TIME",         "MYSQL_TYPE_TIME",      false, false },
+        { "datetime",  "MYSQL_TIME",         "MYSQL_TYPE_DATETIME",  false, false },
+        { "timestamp", "MYSQL_TIME",         "MYSQL_TYPE_TIMESTAMP", false, false },
+        { "string",    "char",               "MYSQL_TYPE_STRING",    false, true  },
+        { "blob",      "unsigned char",      "MYSQL_TYPE_BLOB",      false, true  },
+    };
+
+    using Param = struct Param
+    {
+
+            std::string                 name;
+            const ParamType *           paramType {};
+            unsigned long               size      {};
+            bool                        nullable  {};
+
+    };
+
+    class CodegenError : public std::exception
+    {
+
+        public:
+
+            explicit CodegenError( std::string message ) : m_message( std::move( message ) ) {}
+
+            auto what() const noexcept -> const char * override { return m_message.c_str(); }
+
+        private:
+
+            std::string m_message;
+
+    };
+
+    auto isIdentifier( std::string_view name ) -> bool
+    {
+
+        if ( name.empty() || 0 != std::isdigit( static_cast<unsigned char>( name.front() ) ) ) {
+
+            return false;
+
+        }
+
+        for ( const char character : name ) {
+
+            if ( '_' != character && 0 == std::isalnum( static_cast<unsigned char>( character ) ) ) {
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    /**
+     * Parses the annotation lines of the command - see the description at the top.
+     *
+     * @param mysqlCommand
+     * @return
+     */
+    auto parseParams( std::string_view mysqlCommand ) -> std::vector<Param>
+    {
+
+        std::vector<Param> params;
+
+        std::istringstream lines { std::string( mysqlCommand ) };
+        std::string        line;
+
+        while ( std::getline( lines, line ) ) {
+
+            std::istringstream words( line );
+            std::string        prefix;
+            std::string        paramName;
+            std::string        typeSpecification;
+            std::string        nullable;
+
+            if ( false == static_cast<bool>( words >> prefix >> paramName ) || "--" != prefix || "param:" != paramName ) {
+
+                continue;
+
+            }
+
+            words >> paramName >> typeSpecification >> nullable;
+
+            Param param;
+            param.name     = paramName;
+            param.nullable = "null" == nullable;
+
+            const size_t bracket  = typeSpecification.find( '(' );
+            const std::string typeName = typeSpecification.substr( 0, bracket );
+
+            for ( const ParamType & paramType : g_paramTypes ) {
+
+                if ( typeName == paramType.name ) {
+
+                    param.paramType = &paramType;
+
+                }
+
+            }
+
+            if ( std::string::npos != bracket && ')' == typeSpecification.back() ) {
+
+                param.size = std::strtoul( typeSpecification.c_str() + bracket + 1, nullptr, 10 );
+
+            }
+
+            const bool badSize = nullptr != param.paramType && ( param.paramType->sized ? 0 == param.size : std::string::npos != bracket );
+
+            if ( false == isIdentifier( param.name ) || nullptr == param.paramType || badSize || ( false == nullable.empty() && false == param.nullable ) ) {
+
+                throw CodegenError( "bad annotation '" + line + "' - expected '-- param: NAME TYPE [null]', sized types as string(N) or blob(N)" );
+
+            }
+
+            for ( const Param & otherParam : params ) {
+
+                if ( otherParam.name == param.name ) {
+
+                    throw CodegenError( "the bind variable " + param.name + " is annotated twice" );
+
+                }
+
+            }
+
+            params.push_back( std::move( param ) );
+
+        }
+
+        return params;
+
+    }
+
+    /**
+     * The command without the annotation lines.
+     *
+     * @param adjustedMysqlCommand
+     * @return
+     */
+    auto removeAnnotations( std::string_view adjustedMysqlCommand ) -> std::string
+    {
+
+        std::string mysqlCommand;
+
+        for ( size_t lineStart = 0; lineStart < adjustedMysqlCommand.length(); ) {
+
+            const size_t lineEnd = std::min( adjustedMysqlCommand.find( '\n', lineStart ), adjustedMysqlCommand.length() );
+            const std::string_view line = adjustedMysqlCommand.substr( lineStart, lineEnd - lineStart );
+            const size_t firstCharacter = line.find_first_not_of( " \t" );
+
+            if ( std::string_view::npos == firstCharacter || 0 != line.compare( firstCharacter, g_paramPrefix.length(), g_paramPrefix ) ) {
+
+                mysqlCommand.append( adjustedMysqlCommand.substr( lineStart, std::min( lineEnd + 1, adjustedMysqlCommand.length() ) - lineStart ) );
+
+            }
+
+            lineStart = lineEnd + 1;
+
+        }
+
+        return mysqlCommand;
+
+    }
+
+    /**
+     * The command as C++ string literals, one per line.
+     *
+     * @param mysqlCommand
+     * @param indent
+     * @return
+     */
+    auto stringLiterals( std::string_view mysqlCommand, const std::string & indent ) -> std::string
+    {
+
+        std::string literals { "\"" };
+
+        for ( size_t index = 0; index < mysqlCommand.length(); index++ ) {
+
+            const char character = mysqlCommand [index];
+
+            switch ( character ) {
+
+                case '"':  literals += "\\\""; break;
+                case '\\': literals += "\\\\"; break;
+                case '\t': literals += "\\t";  break;
+                case '\r': literals += "\\r";  break;
+                case '\n':
+                    literals += "\\n\"";
+                    if ( index + 1 < mysqlCommand.length() ) {
+
+                        literals += "\n" + indent + "\"";
+
+                    } else {
+
+                        return literals;
+
+                    }
+                    break;
+
+                default:
+                    if ( 0 != std::iscntrl( static_cast<unsigned char>( character ) ) ) {
+
+                        char octal [8];
+                        std::snprintf( octal, sizeof( octal ), "\\%03o", static_cast<unsigned int>( static_cast<unsigned char>( character ) ) );
+                        literals += octal;
+
+                    } else {
+
+                        literals += character;
+
+                    }
+
+            }
+
+        }
+
+        return literals + "\"";
+
+    }
+
+    /**
+     * One member of a struct - the type is padded, so the names line up.
+     *
+     * @param cppType
+     * @param declarator
+     * @return
+     */
+    auto memberLine( std::string cppType, const std::string & declarator ) -> std::string
+    {
+
+        cppType.resize( std::max<size_t>( cppType.length(), 20 ), ' ' );
+
+        return "            " + cppType + " " + declarator + " {};\n";
+
+    }
+
+    /**
+     * Generates the struct of one catalog entry. The struct name is the entry name with an upper case first letter -
+     * entries which differ only in the case of their first letter would get the same struct, so that's an error.
+     *
+     * @param catalog
+     * @param entryName
+     * @param structNames The entry name of each struct generated so far.
+     * @param header
+     */
+    auto generateStruct( const FaF::MySqlExtBindCatalog & catalog, std::string_view entryName,
+                         std::unordered_map<std::string, std::string_view> & structNames, std::string & header ) -> void
+    {
+
+        if ( false == isIdentifier( entryName ) ) {
+
+            throw CodegenError( "the name is not a C++ identifier" );
+
+        }
+
+        std::string structName { entryName };
+        structName.front() = static_cast<char>( std::toupper( static_cast<unsigned char>( structName.front() ) ) );
+
+        if ( const auto [foundStruct, inserted] = structNames.try_emplace( structName, entryName ); false == inserted ) {
+
+            throw CodegenError( "the struct name " + structName + " is already generated for the entry " + std::string( foundStruct->second ) );
+
+        }
+
+        const std::vector<Param> params = parseParams( catalog.command( entryName ) );
+
+        // Each bind variable gets its index + 1 as buffer, so the order of the placeholders can be read from the bind array.
+        FaF::MySqlExtBind fafExtBind( catalog.parsed( entryName ) );
+        for ( size_t index = 0; index < params.size(); index++ ) {
+
+            fafExtBind.assignBindData( params [index].name, MYSQL_TYPE_NULL, reinterpret_cast<void *>( static_cast<std::uintptr_t>( index + 1 ) ) );
+
+        }
+
+        const MYSQL_BIND * mysqlBindArray     = fafExtBind.checkedBindArray();
+        const u_int        bindVariablesCount = fafExtBind.bindVariablesCount();
+
+        header += "    using " + structName + " = struct " + structName + "\n    {\n\n";
+        header += "            static constexpr std::string_view mysqlCommand {\n                ";
+        header += stringLiterals( removeAnnotations( fafExtBind.adjustedMysqlCommand() ), "                " ) + "\n            };\n";
+        header += "            static constexpr unsigned int     bindVariablesCount { " + std::to_string( bindVariablesCount ) + " };\n\n";
+
+        for ( const Param & param : params ) {
+
+            header += memberLine( param.paramType->cppType, param.name + ( param.paramType->sized ? " [" + std::to_string( param.size ) + "]" : "" ) );
+
+            if ( param.paramType->sized ) {
+
+                header += memberLine( "unsigned long", param.name + "Length" );
+
+            }
+
+            if ( param.nullable ) {
+
+                header += memberLine( "bool", param.name + "IsNull" );
+
+            }
+
+        }
+
+        if ( 0 == bindVariablesCount ) {
+
+            // A zero-length array isn't C++ - there is nothing to bind anyway.
+            header += "    };\n\n";
+            return;
+
+        }
+
+        header += "\n            /**\n"
+                  "             * Fills the MYSQL_BIND array in the order of the placeholders - pass it to mysql_stmt_bind_param().\n"
+                  "             */\n"
+                  "            auto bind( MYSQL_BIND ( & mysqlBindArray ) [bindVariablesCount] ) -> void\n"
+                  "            {\n\n";
+
+        for ( u_int position = 0; position < bindVariablesCount; position++ ) {
+
+            const Param &     param   = params [reinterpret_cast<std::uintptr_t>( mysqlBindArray [position].buffer ) - 1];
+            const std::string element = "                mysqlBindArray [" + std::to_string( position ) + "]";
+
+            header += element + "               = MYSQL_BIND {};\n";
+            header += element + ".buffer_type   = " + param.paramType->mysqlType + ";\n";
+            header += element + ".buffer        = " + ( param.paramType->sized ? "" : "&" ) + param.name + ";\n";
+
+            if ( param.paramType->sized ) {
+
+                header += element + ".buffer_length = sizeof( " + param.name + " );\n";
+                header += element + ".length        = &" + param.name + "Length;\n";
+
+            }
+
+            if ( param.nullable ) {
+
+                header += element + ".is_null       = &" + param.name + "IsNull;\n";
+
+            }
+
+            if ( param.paramType->isUnsigned ) {
+
+                header += element + ".is_unsigned   = true;\n";
+
+            }
+
+        }
+
+        header += "\n            }\n\n    };\n\n";
+
+    }
+
+    /**
+     * Writes the header only if the content has changed.
+     *
+     * @param outputPath
+     * @param header
+     * @return False if the file couldn't be written.
+     */
+    auto writeIfChanged( const std::string & outputPath, const std::string & header ) -> bool
+    {
+
+        std::ifstream existingFile( outputPath, std::ios::binary );
+        const std::string existingHeader { std::istreambuf_iterator<char>( existingFile ), std::istreambuf_iterator<char>() };
+
+        if ( existingHeader == header ) {
+
+            return true;
+
+        }
+
+        std::ofstream outputFile( outputPath, std::ios::binary | std::ios::trunc );
+        outputFile << header;
+
+        return outputFile.flush().good();
+
+    }
+
+}
+
+int main( int argc, char * argv [] )
+{
+
+    std::string              outputPath;
+    std::string              namespaceName { "Sql" };
+    std::vector<std::string> catalogPaths;
+
+    for ( int index = 1; index < argc; index++ ) {
+
+        const std::string option { argv [index] };
+
+        if ( "--output" == option && index + 1 < argc ) {
+
+            outputPath = argv [++index];
+
+        } else if ( "--namespace" == option && index + 1 < argc ) {
+
+            namespaceName = argv [++index];
+
+        } else {
+
+            catalogPaths.push_back( option );
+
+        }
+
+    }
+
+    if ( outputPath.empty() || catalogPaths.empty() ) {
+
+        std::fprintf( stderr, "Usage: MySqlExtBindCodegen --output HEADER [--namespace NAME] CATALOG.sql ...\n" );
+        return 2;
+
+    }
+
+    FaF::MySqlExtBindCatalog catalog;
+
+    try {
+
+        catalog.load( catalogPaths );
+
+    } catch ( const FaF::Exception & ) {
+
+        // The reason has already been printed.
+        return 1;
+
+    }
+
+    std::string guard { "FAF_GENERATED_" };
+    for ( const char character : outputPath.substr( outputPath.find_last_of( '/' ) + 1 ) ) {
+
+        guard += 0 != std::isalnum( static_cast<unsigned char>( character ) ) ? static_cast<char>( std::toupper( static_cast<unsigned char>( character ) ) ) : '_';
+
+    }
+
+    std::string header;
+    header += "/**\n * " + outputPath.substr( outputPath.find_last_of( '/' ) + 1 ) + "\n *\n * Generated by MySqlExtBindCodegen - do not edit. Sources:\n";
+    for ( const std::string & catalogPath : catalogPaths ) {
+
+        header += " *   " + catalogPath + "\n";
+
+    }
+    header += " *\n */\n\n#ifndef " + guard + "\n#define " + guard + "\n\n#include <string_view>\n\n#include <mysql.h>\n\n";
+    header += "namespace " + namespaceName + "\n{\n\n";
+
+    std::unordered_map<std::string, std::string_view> structNames;
+
+    for ( const std::string_view entryName : catalog.entryNames() ) {
+
+        try {
+
+            generateStruct( catalog, entryName, structNames, header );
+
+        } catch ( const CodegenError & codegenError ) {
+
+            std::fprintf( stderr, "MySqlExtBindCodegen: entry %.*s: %s\n", static_cast<int>( entryName.length() ), entryName.data(), codegenError.what() );
+            return 1;
+
+        } catch ( const FaF::Exception & ) {
+
+            std::fprintf( stderr, "MySqlExtBindCodegen: entry %.*s: see the exception above\n", static_cast<int>( entryName.length() ), entryName.data() );
+            return 1;
+
+        }
+
+    }
+
+    header += "}\n\n#endif\n";
+
+    if ( false == writeIfChanged( outputPath, header ) ) {
+
+        std::fprintf( stderr, "MySqlExtBindCodegen: cannot write %s\n", outputPath.c_str() );
+        return 1;
+
+    }
+
+    return 0;
+
+}
@@ -0,0 +1,834 @@
+/**
+ * MySqlClientStub.cpp
+ *
+ * Link-time stand-in for the libmysqlclient statement functions used by the extension.
+ * Link this file instead of -lmysqlclient, so tests and benchmarks run without a MySQL server.
+ * The stub records the prepared SQL commands and the bind arrays, simulates a configurable
+ * latency and counts the calls. See MySqlClientStub.h for the control interface.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlClientStub.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cctype>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+
+    enum CounterIndex : size_t
+    {
+        statementsInitialised,
+        statementsClosed,
+        prepareCalls,
+        bindParamCalls,
+        bindNamedParamCalls,
+        executeCalls,
+        boundParameters,
+        queryCalls,
+        counterIndexCount
+    };
+
+    using CounterValues = std::array< size_t, counterIndexCount >;
+
+    /**
+     * Each thread counts in its own block, so the counters do not add contention to concurrency benchmarks.
+     * The blocks are registered in a list which is only locked when a thread starts, finishes or the counters are read.
+     */
+    struct ThreadCounters
+    {
+
+            ThreadCounters();
+            ~ThreadCounters();
+
+            std::array< std::atomic<size_t>, counterIndexCount > values {};
+
+    };
+
+    std::mutex                      g_countersMutex;
+    std::vector< ThreadCounters * > g_threadCounters;
+    // The counters of the already finished threads.
+    CounterValues                   g_retiredCounters {};
+
+    ThreadCounters::ThreadCounters()
+    {
+
+        const std::lock_guard<std::mutex> lock( g_countersMutex );
+        g_threadCounters.push_back( this );
+
+    }
+
+    ThreadCounters::~ThreadCounters()
+    {
+
+        const std::lock_guard<std::mutex> lock( g_countersMutex );
+
+        for ( size_t index = 0; index < counterIndexCount; index++ ) {
+
+            g_retiredCounters [index] += values [index].load( std::memory_order_relaxed );
+
+        }
+        g_threadCounters.erase( std::find( g_threadCounters.begin(), g_threadCounters.end(), this ) );
+
+    }
+
+    auto count( CounterIndex counterIndex, size_t increment = 1 ) -> void
+    {
+
+        thread_local ThreadCounters threadCounters;
+
+        // Only the owning thread writes, so load and store are sufficient.
+        auto & counter = threadCounters.values [counterIndex];
+        counter.store( counter.load( std::memory_order_relaxed ) + increment, std::memory_order_relaxed );
+
+    }
+
+    std::array< std::atomic<std::chrono::nanoseconds::rep>, static_cast<size_t>( FaF::MySqlClientStub::Function::count ) > g_latencies {};
+    std::atomic<bool> g_recording { true };
+
+    // The mutex is only taken while an execute result function is set, so benchmarks stay free of contention.
+    std::atomic<bool>                               g_executeResultSet {};
+    std::mutex                                      g_executeResultMutex;
+    std::function<unsigned int( MYSQL_STMT * )>     g_executeResult;
+
+    std::atomic<bool>                               g_prepareResultSet {};
+    std::mutex                                      g_prepareResultMutex;
+    std::function<unsigned int( std::string_view )> g_prepareResult;
+
+    std::atomic<bool>                               g_queryResultSet {};
+    std::mutex                                      g_queryResultMutex;
+    std::function<unsigned int( std::string_view )> g_queryResult;
+
+    auto simulateLatency( FaF::MySqlClientStub::Function stubFunction ) -> void
+    {
+
+        const auto latency = g_latencies [static_cast<size_t>( stubFunction )].load( std::memory_order_relaxed );
+
+        if ( 0 != latency ) {
+
+            std::this_thread::sleep_for( std::chrono::nanoseconds( latency ) );
+
+        }
+
+    }
+
+    /**
+     * The recorded data of each statement. It is attached to MYSQL_STMT::extension, so no global lookup is needed.
+     */
+    struct StatementState
+    {
+
+            std::mutex              mutex;
+            bool                    prepared {};
+            std::string             preparedCommand;
+            std::vector<MYSQL_BIND> boundParameters;
+
+    };
+
+    /**
+     * The local infile handler and the data read by the last LOAD DATA LOCAL INFILE command of a connection.
+     */
+    struct ConnectionState
+    {
+
+            int  ( * localInfileInit  )( void **, const char *, void * ) {};
+            int  ( * localInfileRead  )( void *, char *, unsigned int )  {};
+            void ( * localInfileEnd   )( void * )                        {};
+            int  ( * localInfileError )( void *, char *, unsigned int )  {};
+            void *      userData {};
+            std::string localInfileData;
+
+    };
+
+    std::mutex                                   g_connectionStatesMutex;
+    std::unordered_map<MYSQL *, ConnectionState> g_connectionStates;
+
+    /**
+     * Reads the whole local infile like libmysqlclient does for LOAD DATA LOCAL INFILE.
+     *
+     * @param mysql
+     * @return The error code of the handler or 0.
+     */
+    auto readLocalInfile( MYSQL * mysql ) -> unsigned int
+    {
+
+        ConnectionState connectionState;
+        {
+
+            const std::lock_guard<std::mutex> lock( g_connectionStatesMutex );
+            connectionState = g_connectionStates [mysql];
+
+        }
+
+        if ( nullptr == connectionState.localInfileInit ) {
+
+            // CR_LOAD_DATA_LOCAL_INFILE_REJECTED
+            return 2068;
+
+        }
+
+        std::string data;
+        void *      handle {};
+        char        buffer [4096];
+        int         length {};
+
+        unsigned int errorCode {};
+        if ( 0 != connectionState.localInfileInit( &handle, "", connectionState.userData ) ) {
+
+            errorCode = static_cast<unsigned int>( connectionState.localInfileError( handle, buffer, sizeof( buffer ) ) );
+
+        } else {
+
+            while ( 0 < ( length = connectionState.localInfileRead( handle, buffer, sizeof( buffer ) ) ) ) {
+
+                data.append( buffer, static_cast<size_t>( length ) );
+
+            }
+            if ( 0 > length ) {
+
+                errorCode = static_cast<unsigned int>( connectionState.localInfileError( handle, buffer, sizeof( buffer ) ) );
+
+            }
+
+        }
+        connectionState.localInfileEnd( handle );
+
+        const std::lock_guard<std::mutex> lock( g_connectionStatesMutex );
+        g_connectionStates [mysql].localInfileData = std::move( data );
+
+        return errorCode;
+
+    }
+
+    auto statementState( MYSQL_STMT * mysqlStatement ) -> StatementState *
+    {
+
+        return reinterpret_cast<StatementState *>( mysqlStatement->extension );
+
+    }
+
+    /**
+     * Counts the <?> placeholders outside of quoted strings, identifiers and comments - like the server does.
+     *
+     * @param mysqlCommand
+     * @param length
+     * @return
+     */
+    auto countPlaceholders( const char * mysqlCommand, unsigned long length ) -> unsigned int
+    {
+
+        unsigned int placeholders {};
+        char         quote        {};
+
+        for ( unsigned long index = 0; index < length; index++ ) {
+
+            const char character = mysqlCommand [index];
+
+            if ( 0 != quote ) {
+
+                if ( '\\' == character && '`' != quote ) {
+
+                    index++;
+
+                } else if ( quote == character ) {
+
+                    quote = 0;
+
+                }
+
+            } else if ( '\'' == character || '"' == character || '`' == character ) {
+
+                quote = character;
+
+            } else if ( '#' == character || ( '-' == character && index + 1 < length && '-' == mysqlCommand [index + 1] &&
+                                              ( index + 2 == length || std::isspace( static_cast<unsigned char>( mysqlCommand [index + 2] ) ) ) ) ) {
+
+                const size_t lineEnd = std::string_view( mysqlCommand, length ).find( '\n', index );
+                index = std::string_view::npos == lineEnd ? length : lineEnd;
+
+            } else if ( '/' == character && index + 1 < length && '*' == mysqlCommand [index + 1] ) {
+
+                const size_t commentEnd = std::string_view( mysqlCommand, length ).find( "*/", index + 2 );
+                index = std::string_view::npos == commentEnd ? length : commentEnd + 1;
+
+            } else if ( '?' == character ) {
+
+                placeholders++;
+
+            }
+
+        }
+
+        return placeholders;
+
+    }
+
+    auto recordBindArray( MYSQL_STMT * mysqlStatement, const MYSQL_BIND * mysqlBindArray, unsigned int bindCount ) -> void
+    {
+
+        count( boundParameters, bindCount );
+
+        if ( g_recording.load( std::memory_order_relaxed ) ) {
+
+            StatementState * state = statementState( mysqlStatement );
+            const std::lock_guard<std::mutex> lock( state->mutex );
+            state->boundParameters.assign( mysqlBindArray, mysqlBindArray + bindCount );
+
+        }
+
+    }
+
+}
+
+namespace FaF::MySqlClientStub
+{
+
+    auto counters() -> Counters
+    {
+
+        const std::lock_guard<std::mutex> lock( g_countersMutex );
+
+        CounterValues values { g_retiredCounters };
+        for ( const ThreadCounters * threadCounters : g_threadCounters ) {
+
+            for ( size_t index = 0; index < counterIndexCount; index++ ) {
+
+                values [index] += threadCounters->values [index].load( std::memory_order_relaxed );
+
+            }
+
+        }
+
+        return Counters {
+            values [CounterIndex::statementsInitialised],
+            values [CounterIndex::statementsClosed],
+            values [CounterIndex::prepareCalls],
+            values [CounterIndex::bindParamCalls],
+            values [CounterIndex::bindNamedParamCalls],
+            values [CounterIndex::executeCalls],
+            values [CounterIndex::boundParameters],
+            values [CounterIndex::queryCalls]
+        };
+
+    }
+
+    auto resetCounters() -> void
+    {
+
+        const std::lock_guard<std::mutex> lock( g_countersMutex );
+
+        g_retiredCounters = {};
+        for ( ThreadCounters * threadCounters : g_threadCounters ) {
+
+            for ( auto & counter : threadCounters->values ) {
+
+                counter.store( 0, std::memory_order_relaxed );
+
+            }
+
+        }
+
+    }
+
+    auto setLatency( Function stubFunction, std::chrono::nanoseconds latency ) -> void
+    {
+
+        g_latencies [static_cast<size_t>( stubFunction )].store( latency.count(), std::memory_order_relaxed );
+
+    }
+
+    auto setRecording( bool recording ) -> void
+    {
+
+        g_recording.store( recording, std::memory_order_relaxed );
+
+    }
+
+    auto setExecuteResult( std::function<unsigned int( MYSQL_STMT * mysqlStatement )> executeResult ) -> void
+    {
+
+        const std::lock_guard<std::mutex> lock( g_executeResultMutex );
+        g_executeResultSet.store( static_cast<bool>( executeResult ), std::memory_order_relaxed );
+        g_executeResult = std::move( executeResult );
+
+    }
+
+    auto setPrepareResult( std::function<unsigned int( std::string_view mysqlCommand )> prepareResult ) -> void
+    {
+
+        const std::lock_guard<std::mutex> lock( g_prepareResultMutex );
+        g_prepareResultSet.store( static_cast<bool>( prepareResult ), std::memory_order_relaxed );
+        g_prepareResult = std::move( prepareResult );
+
+    }
+
+    auto setQueryResult( std::function<unsigned int( std::string_view mysqlCommand )> queryResult ) -> void
+    {
+
+        const std::lock_guard<std::mutex> lock( g_queryResultMutex );
+        g_queryResultSet.store( static_cast<bool>( queryResult ), std::memory_order_relaxed );
+        g_queryResult = std::move( queryResult );
+
+    }
+
+    auto localInfileData( MYSQL * mysql ) -> std::string
+    {
+
+        const std::lock_guard<std::mutex> lock( g_connectionStatesMutex );
+
+        return g_connectionStates [mysql].localInfileData;
+
+    }
+
+    auto preparedCommand( MYSQL_STMT * mysqlStatement ) -> std::string
+    {
+
+        StatementState * state = statementState( mysqlStatement );
+        const std::lock_guard<std::mutex> lock( state->mutex );
+
+        return state->preparedCommand;
+
+    }
+
+    auto boundParameters( MYSQL_STMT * mysqlStatement ) -> std::vector<MYSQL_BIND>
+    {
+
+        StatementState * state = statementState( mysqlStatement );
+        const std::lock_guard<std::mutex> lock( state->mutex );
+
+        return state->boundParameters;
+
+    }
+
+}
+
+extern "C"
+{
+
+    /**
+     * Returns a zero initialised statement handle with the attached StatementState. The connection is not used.
+     *
+     * @param mysql
+     * @return
+     */
+    MYSQL_STMT * mysql_stmt_init( MYSQL * mysql )
+    {
+
+        MYSQL_STMT * mysqlStatement = new MYSQL_STMT {};
+        mysqlStatement->mysql       = mysql;
+        mysqlStatement->extension   = reinterpret_cast<decltype( mysqlStatement->extension )>( new StatementState );
+
+        count( statementsInitialised );
+
+        return mysqlStatement;
+
+    }
+
+    bool mysql_stmt_close( MYSQL_STMT * mysqlStatement )
+    {
+
+        count( statementsClosed );
+
+        // libmysqlclient calls net_clear_error() - the error of a failed prepare is lost afterwards.
+        if ( nullptr != mysqlStatement->mysql ) {
+
+            mysqlStatement->mysql->net.last_errno = 0;
+
+        }
+
+        delete statementState( mysqlStatement );
+        delete mysqlStatement;
+
+        return false;
+
+    }
+
+    int mysql_stmt_prepare( MYSQL_STMT * mysqlStatement, const char * mysqlCommand, unsigned long length )
+    {
+
+        count( prepareCalls );
+        simulateLatency( FaF::MySqlClientStub::Function::prepare );
+
+        mysqlStatement->param_count = countPlaceholders( mysqlCommand, length );
+        mysqlStatement->last_errno  = 0;
+
+        if ( g_prepareResultSet.load( std::memory_order_relaxed ) ) {
+
+            const std::lock_guard<std::mutex> lock( g_prepareResultMutex );
+            mysqlStatement->last_errno = g_prepareResult ? g_prepareResult( std::string_view( mysqlCommand, length ) ) : 0;
+
+        }
+
+        if ( nullptr != mysqlStatement->mysql ) {
+
+            mysqlStatement->mysql->net.last_errno = mysqlStatement->last_errno;
+
+        }
+
+        if ( 0 != mysqlStatement->last_errno ) {
+
+            mysqlStatement->param_count = 0;
+            return 1;
+
+        }
+
+        StatementState * state = statementState( mysqlStatement );
+        const std::lock_guard<std::mutex> lock( state->mutex );
+
+        state->prepared = true;
+        if ( g_recording.load( std::memory_order_relaxed ) ) {
+
+            state->preparedCommand.assign( mysqlCommand, length );
+
+        }
+
+        return 0;
+
+    }
+
+    bool mysql_stmt_bind_param( MYSQL_STMT * mysqlStatement, MYSQL_BIND * mysqlBindArray )
+    {
+
+        count( bindParamCalls );
+        simulateLatency( FaF::MySqlClientStub::Function::bindParam );
+
+        recordBindArray( mysqlStatement, mysqlBindArray, mysqlStatement->param_count );
+
+        return false;
+
+    }
+
+    /**
+     * Like libmysqlclient, the call fails if a prepared statement expects a different number of parameters.
+     *
+     * @param mysqlStatement
+     * @param mysqlBindArray
+     * @param bindCount
+     * @return
+     */
+    bool mysql_stmt_bind_named_param( MYSQL_STMT * mysqlStatement, MYSQL_BIND * mysqlBindArray, unsigned bindCount, const char ** )
+    {
+
+        count( bindNamedParamCalls );
+        simulateLatency( FaF::MySqlClientStub::Function::bindParam );
+
+        {
+
+            StatementState * state = statementState( mysqlStatement );
+            const std::lock_guard<std::mutex> lock( state->mutex );
+
+            if ( state->prepared && bindCount != mysqlStatement->param_count ) {
+
+                // CR_INVALID_PARAMETER_NO
+                mysqlStatement->last_errno = 2034;
+                return true;
+
+            }
+
+        }
+
+        recordBindArray( mysqlStatement, mysqlBindArray, bindCount );
+
+        return false;
+
+    }
+
+    int mysql_stmt_execute( MYSQL_STMT * mysqlStatement )
+    {
+
+        count( executeCalls );
+        simulateLatency( FaF::MySqlClientStub::Function::execute );
+
+        mysqlStatement->last_errno = 0;
+        if ( g_executeResultSet.load( std::memory_order_relaxed ) ) {
+
+            const std::lock_guard<std::mutex> lock( g_executeResultMutex );
+            mysqlStatement->last_errno = g_executeResult ? g_executeResult( mysqlStatement ) : 0;
+
+        }
+
+        return 0 == mysqlStatement->last_errno ? 0 : 1;
+
+    }
+
+    bool mysql_stmt_reset( MYSQL_STMT * )
+    {
+
+        return false;
+
+    }
+
+    unsigned long mysql_stmt_param_count( MYSQL_STMT * mysqlStatement )
+    {
+
+        return mysqlStatement->param_count;
+
+    }
+
+    unsigned int mysql_stmt_field_count( MYSQL_STMT * )
+    {
+
+        return 0;
+
+    }
+
+    unsigned int mysql_stmt_errno( MYSQL_STMT * mysqlStatement )
+    {
+
+        return mysqlStatement->last_errno;
+
+    }
+
+    const char * mysql_stmt_error( MYSQL_STMT * mysqlStatement )
+    {
+
+        return 0 == mysqlStatement->last_errno ? "" : "Stubbed client error";
+
+    }
+
+    const char * mysql_stmt_sqlstate( MYSQL_STMT * mysqlStatement )
+    {
+
+        return 0 == mysqlStatement->last_errno ? "00000" : "HY000";
+
+    }
+
+    my_ulonglong mysql_stmt_affected_rows( MYSQL_STMT * )
+    {
+
+        return 1;
+
+    }
+
+    bool mysql_stmt_free_result( MYSQL_STMT * )
+    {
+
+        return false;
+
+    }
+
+    bool mysql_stmt_bind_result( MYSQL_STMT *, MYSQL_BIND * )
+    {
+
+        return false;
+
+    }
+
+    int mysql_stmt_store_result( MYSQL_STMT * )
+    {
+
+        return 0;
+
+    }
+
+    /**
+     * The stub statements have no result rows.
+     */
+    int mysql_stmt_fetch( MYSQL_STMT * )
+    {
+
+        return MYSQL_NO_DATA;
+
+    }
+
+    /**
+     * Accepts every command unless setQueryResult() decides otherwise - used for transaction control like
+     * START TRANSACTION and COMMIT.
+     * LOAD DATA LOCAL INFILE reads the data through the local infile handler of the connection.
+     *
+     * @param mysql
+     * @param mysqlCommand
+     * @return
+     */
+    int mysql_query( MYSQL * mysql, const char * mysqlCommand )
+    {
+
+        count( queryCalls );
+        simulateLatency( FaF::MySqlClientStub::Function::query );
+
+        unsigned int errorCode {};
+        if ( 0 == std::strncmp( mysqlCommand, "LOAD DATA ", 10 ) && nullptr != std::strstr( mysqlCommand, " LOCAL INFILE " ) ) {
+
+            errorCode = readLocalInfile( mysql );
+
+        }
+
+        if ( 0 == errorCode && g_queryResultSet.load( std::memory_order_relaxed ) ) {
+
+            const std::lock_guard<std::mutex> lock( g_queryResultMutex );
+            errorCode = g_queryResult ? g_queryResult( mysqlCommand ) : 0;
+
+        }
+
+        if ( nullptr != mysql ) {
+
+            mysql->net.last_errno = errorCode;
+
+        }
+
+        return 0 == errorCode ? 0 : 1;
+
+    }
+
+    /**
+     * Completes immediately like mysql_query() - the stub statements have no result set.
+     */
+    net_async_status mysql_real_query_nonblocking( MYSQL * mysql, const char * mysqlCommand, unsigned long length )
+    {
+
+        return 0 == mysql_query( mysql, std::string( mysqlCommand, length ).c_str() ) ? NET_ASYNC_COMPLETE : NET_ASYNC_ERROR;
+
+    }
+
+    net_async_status mysql_store_result_nonblocking( MYSQL *, MYSQL_RES ** mysqlResult )
+    {
+
+        *mysqlResult = nullptr;
+        return NET_ASYNC_COMPLETE;
+
+    }
+
+    net_async_status mysql_fetch_row_nonblocking( MYSQL_RES *, MYSQL_ROW * mysqlRow )
+    {
+
+        *mysqlRow = nullptr;
+        return NET_ASYNC_COMPLETE;
+
+    }
+
+    net_async_status mysql_free_result_nonblocking( MYSQL_RES * )
+    {
+
+        return NET_ASYNC_COMPLETE;
+
+    }
+
+    unsigned int mysql_field_count( MYSQL * )
+    {
+
+        return 0;
+
+    }
+
+    unsigned int mysql_num_fields( MYSQL_RES * )
+    {
+
+        return 0;
+
+    }
+
+    unsigned long * mysql_fetch_lengths( MYSQL_RES * )
+    {
+
+        return nullptr;
+
+    }
+
+    my_ulonglong mysql_affected_rows( MYSQL * mysql )
+    {
+
+        return 0 == mysql_errno( mysql ) ? 1 : 0;
+
+    }
+
+    my_ulonglong mysql_insert_id( MYSQL * )
+    {
+
+        return 0;
+
+    }
+
+    /**
+     * Escapes like a connection with the default sql_mode - the character set is ignored.
+     */
+    unsigned long mysql_real_escape_string_quote( MYSQL *, char * escaped, const char * value, unsigned long length, char )
+    {
+
+        char * position = escaped;
+
+        for ( unsigned long index = 0; index < length; index++ ) {
+
+            const char character = value [index];
+            const char * const replacement =
+                '\0'   == character ? "\\0"  : '\n' == character ? "\\n" : '\r' == character ? "\\r"  :
+                '\\'   == character ? "\\\\" : '\'' == character ? "\\'" : '"'  == character ? "\\\"" :
+                '\032' == character ? "\\Z"  : nullptr;
+
+            if ( nullptr == replacement ) {
+
+                *position++ = character;
+
+            } else {
+
+                *position++ = replacement [0];
+                *position++ = replacement [1];
+
+            }
+
+        }
+        *position = 0;
+
+        return static_cast<unsigned long>( position - escaped );
+
+    }
+
+    void mysql_set_local_infile_handler( MYSQL * mysql,
+                                         int  ( * localInfileInit  )( void **, const char *, void * ),
+                                         int  ( * localInfileRead  )( void *, char *, unsigned int ),
+                                         void ( * localInfileEnd   )( void * ),
+                                         int  ( * localInfileError )( void *, char *, unsigned int ),
+                                         void * userData )
+    {
+
+        const std::lock_guard<std::mutex> lock( g_connectionStatesMutex );
+
+        ConnectionState & connectionState = g_connectionStates [mysql];
+        connectionState.localInfileInit  = localInfileInit;
+        connectionState.localInfileRead  = localInfileRead;
+        connectionState.localInfileEnd   = localInfileEnd;
+        connectionState.localInfileError = localInfileError;
+        connectionState.userData         = userData;
+
+    }
+
+    void mysql_set_local_infile_default( MYSQL * mysql )
+    {
+
+        mysql_set_local_infile_handler( mysql, nullptr, nullptr, nullptr, nullptr, nullptr );
+
+    }
+
+    const char * mysql_get_ssl_cipher( MYSQL * )
+    {
+
+        return nullptr;
+
+    }
+
+    unsigned int mysql_errno( MYSQL * mysql )
+    {
+
+        return nullptr == mysql ? 0 : mysql->net.last_errno;
+
+    }
+
+    const char * mysql_error( MYSQL * mysql )
+    {
+
+        return 0 == mysql_errno( mysql ) ? "" : "Stubbed client error";
+
+    }
+
+}
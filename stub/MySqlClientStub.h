@@ -0,0 +1,97 @@
+/**
+ * MySqlClientStub.h
+ *
+ * Control interface of the libmysqlclient stand-in in MySqlClientStub.cpp.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef MYSQL_CLIENT_STUB_H
+#define MYSQL_CLIENT_STUB_H
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <mysql.h>
+
+namespace FaF::MySqlClientStub
+{
+
+    /**
+     * The stubbed client functions which can be delayed with setLatency().
+     */
+    enum class Function
+    {
+        prepare,
+        bindParam,
+        execute,
+        query,
+        count
+    };
+
+    /**
+     * Number of calls per stubbed function. boundParameters is the sum of all bound MYSQL_BIND items.
+     */
+    struct Counters
+    {
+
+            size_t statementsInitialised {};
+            size_t statementsClosed      {};
+            size_t prepareCalls          {};
+            size_t bindParamCalls        {};
+            size_t bindNamedParamCalls   {};
+            size_t executeCalls          {};
+            size_t boundParameters       {};
+            size_t queryCalls            {};
+
+    };
+
+    // Sums up the counters of all threads - also of threads which have already finished.
+    auto counters()      -> Counters;
+    auto resetCounters() -> void;
+
+    // The calling thread sleeps for <latency> in the given function. Simulates the server round trip.
+    auto setLatency( Function stubFunction, std::chrono::nanoseconds latency ) -> void;
+
+    /**
+     * If set, the prepared SQL command and the bind arrays are copied for each statement.
+     * Disable it in benchmarks - copying the arrays is not free. Default: enabled.
+     */
+    auto setRecording( bool recording ) -> void;
+
+    /**
+     * Decides the result of each mysql_stmt_execute() call - the returned MySQL error code, 0 for success.
+     * Use it to test error handling. An empty function resets it - all calls succeed.
+     */
+    auto setExecuteResult( std::function<unsigned int( MYSQL_STMT * mysqlStatement )> executeResult ) -> void;
+
+    /**
+     * Decides the result of each mysql_stmt_prepare() call - the returned MySQL error code, 0 for success.
+     * A failed prepare sets the error of the statement and of the connection, and mysql_stmt_close() clears the
+     * one of the connection like libmysqlclient does. An empty function resets it - all calls succeed.
+     */
+    auto setPrepareResult( std::function<unsigned int( std::string_view mysqlCommand )> prepareResult ) -> void;
+
+    /**
+     * Decides the result of each mysql_query() call - the MySQL error code of the connection, 0 for success.
+     * An empty function resets it - all calls succeed.
+     */
+    auto setQueryResult( std::function<unsigned int( std::string_view mysqlCommand )> queryResult ) -> void;
+
+    // The data read by the last LOAD DATA LOCAL INFILE command of this connection through the local infile handler.
+    auto localInfileData( MYSQL * mysql ) -> std::string;
+
+    // The last SQL command provided to mysql_stmt_prepare() for this statement.
+    auto preparedCommand( MYSQL_STMT * mysqlStatement ) -> std::string;
+    // The last MYSQL_BIND array provided to mysql_stmt_bind_param() or mysql_stmt_bind_named_param().
+    auto boundParameters( MYSQL_STMT * mysqlStatement ) -> std::vector<MYSQL_BIND>;
+
+}
+
+#endif
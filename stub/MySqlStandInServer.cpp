@@ -0,0 +1,976 @@
+/**
+ * MySqlStandInServer.cpp
+ *
+ * Each connection is served by its own thread, the commands of a connection are answered in the order they
+ * arrive - so pipelined requests work like with mysqld. The server doesn't execute anything: the replies are
+ * the defaults below unless the script changes them.
+ *   COM_QUERY              OK, no rows affected - LOAD DATA LOCAL INFILE reads the data and affects one row per line
+ *   COM_STMT_PREPARE       the parameters are the '?' outside of quotes, no result set
+ *   COM_STMT_EXECUTE       OK, one row affected
+ *   COM_STMT_CLOSE         no reply, like COM_STMT_SEND_LONG_DATA
+ *   other commands         OK - unknown commands get ER_UNKNOWN_COM_ERROR
+ * Result set columns are sent as VARCHAR, libmysqlclient converts them to the types of the result bind array.
+ * Any authentication is accepted.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include "MySqlStandInServer.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <system_error>
+#include <unistd.h>
+#include <unordered_map>
+
+#include <mysqld_error.h>
+
+#include "../MySqlExtBindProtocol.h"
+
+namespace
+{
+
+    using Protocol = FaF::MySqlExtBindProtocol;
+    using Buffer   = std::vector<unsigned char>;
+
+    constexpr unsigned long g_serverCapabilities {
+        CLIENT_LONG_PASSWORD | CLIENT_FOUND_ROWS | CLIENT_LONG_FLAG | CLIENT_CONNECT_WITH_DB | CLIENT_LOCAL_FILES |
+        CLIENT_PROTOCOL_41 | CLIENT_TRANSACTIONS | CLIENT_SECURE_CONNECTION | CLIENT_MULTI_STATEMENTS |
+        CLIENT_MULTI_RESULTS | CLIENT_PS_MULTI_RESULTS | CLIENT_PLUGIN_AUTH | CLIENT_CONNECT_ATTRS |
+        CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA | CLIENT_DEPRECATE_EOF | CLIENT_QUERY_ATTRIBUTES
+    };
+
+    constexpr unsigned char g_utf8mb4Collation { 255 };
+    constexpr unsigned char g_binaryCollation  { 63 };
+
+    const char * const g_authPluginName { "caching_sha2_password" };
+
+    using PreparedStatement = struct PreparedStatement
+    {
+
+            std::string                 query;
+            unsigned int                parametersCount {};
+            std::vector<std::string>    columns;
+
+    };
+
+    using ConnectionState = struct ConnectionState
+    {
+
+            int                                                   socket {};
+            unsigned long                                         clientFlags {};
+            unsigned long                                         nextStatementId { 1 };
+            std::unordered_map<unsigned long, PreparedStatement>  statements;
+
+            // The sequence id of the next packet sent to the client.
+            unsigned char                                         sequenceId {};
+            Buffer                                                request;
+            Buffer                                                response;
+
+    };
+
+    auto readFully( int socket, unsigned char * buffer, size_t length ) -> bool
+    {
+
+        while ( 0 < length ) {
+
+            const ssize_t received = recv( socket, buffer, length, 0 );
+
+            if ( 0 > received && EINTR == errno ) {
+
+                continue;
+
+            }
+            if ( 0 >= received ) {
+
+                return false;
+
+            }
+
+            buffer += received;
+            length -= static_cast<size_t>( received );
+
+        }
+
+        return true;
+
+    }
+
+    /**
+     * Reads one logical packet into <connectionState.request>. The sequence id of the reply follows the one of the
+     * last part.
+     *
+     * @param connectionState
+     * @return False if the connection has been closed.
+     */
+    auto readRequest( ConnectionState & connectionState ) -> bool
+    {
+
+        connectionState.request.clear();
+
+        while ( true ) {
+
+            unsigned char header [4];
+            if ( false == readFully( connectionState.socket, header, sizeof( header ) ) ) {
+
+                return false;
+
+            }
+
+            const size_t partLength = header [0] | ( header [1] << 8 ) | ( header [2] << 16 );
+            const size_t offset     = connectionState.request.size();
+
+            connectionState.request.resize( offset + partLength );
+            if ( false == readFully( connectionState.socket, connectionState.request.data() + offset, partLength ) ) {
+
+                return false;
+
+            }
+
+            connectionState.sequenceId = static_cast<unsigned char>( header [3] + 1 );
+
+            if ( Protocol::g_maxPayloadLength > partLength ) {
+
+                return true;
+
+            }
+
+        }
+
+    }
+
+    /**
+     * Appends <payload> as packet to the pending response - split if it's too long.
+     *
+     * @param connectionState
+     * @param payload
+     */
+    auto appendPacket( ConnectionState & connectionState, const Buffer & payload ) -> void
+    {
+
+        size_t offset {};
+
+        while ( true ) {
+
+            const size_t partLength = std::min( Protocol::g_maxPayloadLength, payload.size() - offset );
+
+            Protocol::appendInteger( connectionState.response, partLength, 3 );
+            connectionState.response.push_back( connectionState.sequenceId++ );
+            connectionState.response.insert( connectionState.response.end(), payload.begin() + static_cast<ptrdiff_t>( offset ),
+                                             payload.begin() + static_cast<ptrdiff_t>( offset + partLength ) );
+            offset += partLength;
+
+            if ( Protocol::g_maxPayloadLength > partLength ) {
+
+                return;
+
+            }
+
+        }
+
+    }
+
+    auto appendLengthEncodedString( Buffer & payload, const std::string & value ) -> void
+    {
+
+        Protocol::appendLengthEncoded( payload, value.length() );
+        payload.insert( payload.end(), value.begin(), value.end() );
+
+    }
+
+    /**
+     * @param header 0x00 for an OK packet, 0xFE for the OK packet which ends a result set with CLIENT_DEPRECATE_EOF.
+     */
+    auto appendOk( ConnectionState & connectionState, unsigned long long affectedRows, unsigned long long lastInsertId,
+                   unsigned char header = 0x00 ) -> void
+    {
+
+        Buffer payload { header };
+        Protocol::appendLengthEncoded( payload, affectedRows );
+        Protocol::appendLengthEncoded( payload, lastInsertId );
+        Protocol::appendInteger( payload, SERVER_STATUS_AUTOCOMMIT, 2 );
+        Protocol::appendInteger( payload, 0, 2 );
+
+        appendPacket( connectionState, payload );
+
+    }
+
+    auto appendError( ConnectionState & connectionState, unsigned int errorCode, const std::string & errorMessage ) -> void
+    {
+
+        Buffer payload { 0xFF };
+        Protocol::appendInteger( payload, errorCode, 2 );
+        payload.push_back( '#' );
+        payload.insert( payload.end(), { 'H', 'Y', '0', '0', '0' } );
+        payload.insert( payload.end(), errorMessage.begin(), errorMessage.end() );
+
+        appendPacket( connectionState, payload );
+
+    }
+
+    /**
+     * Appends the EOF packet which ends the column definitions and result sets of clients without CLIENT_DEPRECATE_EOF.
+     * With CLIENT_DEPRECATE_EOF, the column definitions end without packet and the rows with an OK packet.
+     *
+     * @param connectionState
+     * @param endOfRows
+     */
+    auto appendEof( ConnectionState & connectionState, bool endOfRows ) -> void
+    {
+
+        if ( 0 != ( connectionState.clientFlags & CLIENT_DEPRECATE_EOF ) ) {
+
+            if ( endOfRows ) {
+
+                appendOk( connectionState, 0, 0, 0xFE );
+
+            }
+            return;
+
+        }
+
+        Buffer payload { 0xFE };
+        Protocol::appendInteger( payload, 0, 2 );
+        Protocol::appendInteger( payload, SERVER_STATUS_AUTOCOMMIT, 2 );
+
+        appendPacket( connectionState, payload );
+
+    }
+
+    auto appendColumnDefinition( ConnectionState & connectionState, const std::string & name, unsigned char collation,
+                                 unsigned int flags ) -> void
+    {
+
+        Buffer payload;
+        appendLengthEncodedString( payload, "def" );
+        appendLengthEncodedString( payload, "" );
+        appendLengthEncodedString( payload, "" );
+        appendLengthEncodedString( payload, "" );
+        appendLengthEncodedString( payload, name );
+        appendLengthEncodedString( payload, name );
+        payload.push_back( 0x0C );
+        Protocol::appendInteger( payload, collation, 2 );
+        Protocol::appendInteger( payload, 1024, 4 );
+        payload.push_back( MYSQL_TYPE_VAR_STRING );
+        Protocol::appendInteger( payload, flags, 2 );
+        payload.push_back( 0 );
+        Protocol::appendInteger( payload, 0, 2 );
+
+        appendPacket( connectionState, payload );
+
+    }
+
+    /**
+     * Appends a result set - in the text protocol for COM_QUERY, in the binary protocol for COM_STMT_EXECUTE.
+     *
+     * @param connectionState
+     * @param columns
+     * @param rows
+     * @param binary
+     */
+    auto appendResultSet( ConnectionState & connectionState, const std::vector<std::string> & columns,
+                          const std::vector< std::vector< std::optional<std::string> > > & rows, bool binary ) -> void
+    {
+
+        Buffer payload;
+        Protocol::appendLengthEncoded( payload, columns.size() );
+        appendPacket( connectionState, payload );
+
+        for ( const auto & column : columns ) {
+
+            appendColumnDefinition( connectionState, column, g_utf8mb4Collation, 0 );
+
+        }
+        appendEof( connectionState, false );
+
+        for ( const auto & row : rows ) {
+
+            payload.clear();
+
+            // The NULL bitmap of the binary protocol starts at bit 2.
+            size_t nullBitmapOffset {};
+            if ( binary ) {
+
+                payload.push_back( 0x00 );
+                nullBitmapOffset = payload.size();
+                payload.resize( nullBitmapOffset + ( columns.size() + 9 ) / 8 );
+
+            }
+
+            for ( size_t index = 0; index < columns.size(); index++ ) {
+
+                const bool isNull = index >= row.size() || false == row [index].has_value();
+
+                if ( false == isNull ) {
+
+                    appendLengthEncodedString( payload, *row [index] );
+
+                } else if ( binary ) {
+
+                    payload [nullBitmapOffset + ( index + 2 ) / 8] |= static_cast<unsigned char>( 1 << ( ( index + 2 ) % 8 ) );
+
+                } else {
+
+                    payload.push_back( 0xFB );
+
+                }
+
+            }
+
+            appendPacket( connectionState, payload );
+
+        }
+
+        appendEof( connectionState, true );
+
+    }
+
+    /**
+     * Appends the COM_STMT_PREPARE response: the statement id and the definitions of the parameters and the columns.
+     *
+     * @param connectionState
+     * @param statementId
+     * @param preparedStatement
+     */
+    auto appendPrepareOk( ConnectionState & connectionState, unsigned long statementId, const PreparedStatement & preparedStatement ) -> void
+    {
+
+        Buffer payload { 0x00 };
+        Protocol::appendInteger( payload, statementId, 4 );
+        Protocol::appendInteger( payload, preparedStatement.columns.size(), 2 );
+        Protocol::appendInteger( payload, preparedStatement.parametersCount, 2 );
+        payload.push_back( 0 );
+        Protocol::appendInteger( payload, 0, 2 );
+        appendPacket( connectionState, payload );
+
+        if ( 0 < preparedStatement.parametersCount ) {
+
+            for ( unsigned int index = 0; index < preparedStatement.parametersCount; index++ ) {
+
+                appendColumnDefinition( connectionState, "?", g_binaryCollation, BINARY_FLAG );
+
+            }
+            appendEof( connectionState, false );
+
+        }
+
+        if ( false == preparedStatement.columns.empty() ) {
+
+            for ( const auto & column : preparedStatement.columns ) {
+
+                appendColumnDefinition( connectionState, column, g_utf8mb4Collation, 0 );
+
+            }
+            appendEof( connectionState, false );
+
+        }
+
+    }
+
+    /**
+     * Counts the '?' placeholders outside of quotes.
+     *
+     * @param query
+     * @return
+     */
+    auto countPlaceholders( const std::string & query ) -> unsigned int
+    {
+
+        unsigned int placeholders {};
+        char         quote        {};
+
+        for ( size_t index = 0; index < query.length(); index++ ) {
+
+            const char character = query [index];
+
+            if ( 0 != quote ) {
+
+                if ( '\\' == character && '`' != quote ) {
+
+                    index++;
+
+                } else if ( quote == character ) {
+
+                    quote = 0;
+
+                }
+
+            } else if ( '\'' == character || '"' == character || '`' == character ) {
+
+                quote = character;
+
+            } else if ( '?' == character ) {
+
+                placeholders++;
+
+            }
+
+        }
+
+        return placeholders;
+
+    }
+
+    /**
+     * Returns the file name if <query> is a LOAD DATA LOCAL INFILE command.
+     *
+     * @param query
+     * @return
+     */
+    auto localInfileName( const std::string & query ) -> std::optional<std::string>
+    {
+
+        std::string normalisedQuery;
+        for ( const char character : query ) {
+
+            const bool isSpace = ' ' == character || '\t' == character || '\n' == character || '\r' == character;
+
+            if ( isSpace && ( normalisedQuery.empty() || ' ' == normalisedQuery.back() ) ) {
+
+                continue;
+
+            }
+            normalisedQuery += isSpace ? ' ' : static_cast<char>( std::toupper( static_cast<unsigned char>( character ) ) );
+
+        }
+
+        if ( 0 != normalisedQuery.rfind( "LOAD DATA LOCAL INFILE ", 0 ) && 0 != normalisedQuery.rfind( "LOAD DATA LOW_PRIORITY LOCAL INFILE ", 0 ) &&
+             0 != normalisedQuery.rfind( "LOAD DATA CONCURRENT LOCAL INFILE ", 0 ) ) {
+
+            return std::nullopt;
+
+        }
+
+        const size_t nameStart = query.find_first_of( "'\"" );
+        const size_t nameEnd   = std::string::npos == nameStart ? std::string::npos : query.find( query [nameStart], nameStart + 1 );
+        if ( std::string::npos == nameEnd ) {
+
+            return std::nullopt;
+
+        }
+
+        return query.substr( nameStart + 1, nameEnd - nameStart - 1 );
+
+    }
+
+    /**
+     * Parses the HandshakeResponse41 and sends the reply - fast authentication for caching_sha2_password with a
+     * password, otherwise OK.
+     *
+     * @param connectionState
+     * @return False if the connection has been closed.
+     */
+    auto authenticate( ConnectionState & connectionState ) -> bool
+    {
+
+        if ( false == readRequest( connectionState ) || 32 > connectionState.request.size() ) {
+
+            return false;
+
+        }
+
+        const Buffer &        request  = connectionState.request;
+        const unsigned char * position = request.data();
+        const unsigned char * end      = position + request.size();
+
+        connectionState.clientFlags = ( position [0] | ( position [1] << 8 ) | ( position [2] << 16 ) |
+                                        ( static_cast<unsigned long>( position [3] ) << 24 ) ) & g_serverCapabilities;
+
+        // Skips the max packet size, the character set, the filler and the user name.
+        position += 32;
+        position  = std::find( position, end, 0 ) + 1;
+
+        unsigned long long authResponseLength {};
+        if ( position < end ) {
+
+            if ( 0 == ( connectionState.clientFlags & CLIENT_PLUGIN_AUTH_LENENC_CLIENT_DATA ) ) {
+
+                authResponseLength = *position++;
+
+            } else if ( false == Protocol::readLengthEncoded( position, end, authResponseLength ) ) {
+
+                return false;
+
+            }
+
+        }
+
+        const bool hasPassword = 0 < authResponseLength && position < end && ( 1 < authResponseLength || 0 != *position );
+        position += std::min( authResponseLength, static_cast<unsigned long long>( std::max( end - position, ptrdiff_t {} ) ) );
+
+        if ( 0 != ( connectionState.clientFlags & CLIENT_CONNECT_WITH_DB ) && position < end ) {
+
+            position = std::find( position, end, 0 ) + 1;
+
+        }
+
+        std::string pluginName;
+        if ( 0 != ( connectionState.clientFlags & CLIENT_PLUGIN_AUTH ) && position < end ) {
+
+            pluginName.assign( position, std::find( position, end, 0 ) );
+
+        }
+
+        connectionState.response.clear();
+        if ( hasPassword && g_authPluginName == pluginName ) {
+
+            // AuthMoreData with fast_auth_success.
+            appendPacket( connectionState, Buffer { 0x01, 0x03 } );
+
+        }
+        appendOk( connectionState, 0, 0 );
+
+        return Protocol::writePacket( connectionState.socket, connectionState.response );
+
+    }
+
+    /**
+     * Sends the protocol version 10 handshake.
+     *
+     * @param connectionState
+     * @param connectionId
+     * @return
+     */
+    auto sendHandshake( ConnectionState & connectionState, size_t connectionId ) -> bool
+    {
+
+        const std::string serverVersion { "8.2.0-MySqlStandInServer" };
+
+        Buffer payload { 10 };
+        payload.insert( payload.end(), serverVersion.begin(), serverVersion.end() );
+        payload.push_back( 0 );
+        Protocol::appendInteger( payload, connectionId + 1, 4 );
+        // The first 8 bytes of the 20 byte scramble.
+        payload.insert( payload.end(), { 'M', 'y', 'S', 'q', 'l', 'E', 'x', 't' } );
+        payload.push_back( 0 );
+        Protocol::appendInteger( payload, g_serverCapabilities, 2 );
+        payload.push_back( g_utf8mb4Collation );
+        Protocol::appendInteger( payload, SERVER_STATUS_AUTOCOMMIT, 2 );
+        Protocol::appendInteger( payload, g_serverCapabilities >> 16, 2 );
+        payload.push_back( 21 );
+        payload.insert( payload.end(), 10, 0 );
+        payload.insert( payload.end(), { 'B', 'i', 'n', 'd', 'S', 't', 'a', 'n', 'd', 'I', 'n', '!', 0 } );
+        payload.insert( payload.end(), g_authPluginName, g_authPluginName + std::strlen( g_authPluginName ) + 1 );
+
+        connectionState.sequenceId = 0;
+        connectionState.response.clear();
+        appendPacket( connectionState, payload );
+
+        return Protocol::writePacket( connectionState.socket, connectionState.response );
+
+    }
+
+}
+
+namespace FaF
+{
+
+    /**
+     * Listens on <socketPath> - an existing socket file is replaced. The server runs until it's destroyed.
+     * std::system_error is thrown if the socket cannot be created.
+     *
+     * @param socketPath
+     * @param standInScript Changes the replies, may be empty.
+     */
+    MySqlStandInServer::MySqlStandInServer( std::string socketPath, StandInScript standInScript )
+    :
+        m_socketPath( std::move( socketPath ) ),
+        m_script    ( standInScript ? std::make_shared<const StandInScript>( std::move( standInScript ) ) : nullptr )
+    {
+
+        sockaddr_un socketAddress {};
+        socketAddress.sun_family = AF_UNIX;
+        if ( sizeof( socketAddress.sun_path ) <= m_socketPath.length() ) {
+
+            throw std::system_error( ENAMETOOLONG, std::generic_category(), m_socketPath );
+
+        }
+        std::memcpy( socketAddress.sun_path, m_socketPath.c_str(), m_socketPath.length() + 1 );
+
+        unlink( m_socketPath.c_str() );
+
+        m_listenSocket = socket( AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0 );
+        if ( 0 > m_listenSocket ||
+             0 != bind( m_listenSocket, reinterpret_cast<const sockaddr *>( &socketAddress ), sizeof( socketAddress ) ) ||
+             0 != listen( m_listenSocket, 64 ) ) {
+
+            const int errorNumber = errno;
+            if ( 0 <= m_listenSocket ) {
+
+                close( m_listenSocket );
+
+            }
+            throw std::system_error( errorNumber, std::generic_category(), m_socketPath );
+
+        }
+
+        m_acceptThread = std::thread( &MySqlStandInServer::acceptConnections, this );
+
+    }
+
+    /**
+     * Closes all connections and removes the socket file.
+     */
+    MySqlStandInServer::~MySqlStandInServer()
+    {
+
+        m_stopping = true;
+
+        shutdown( m_listenSocket, SHUT_RDWR );
+        m_acceptThread.join();
+        close( m_listenSocket );
+
+        std::unordered_map<size_t, std::thread> connectionThreads;
+        {
+
+            const std::lock_guard<std::mutex> lock( m_mutex );
+
+            for ( const int socket : m_connectionSockets ) {
+
+                shutdown( socket, SHUT_RDWR );
+
+            }
+            connectionThreads.swap( m_connectionThreads );
+
+        }
+
+        for ( auto & [connectionId, connectionThread] : connectionThreads ) {
+
+            // Avoid a warning which would be treated as an error.
+            (void) connectionId;
+
+            connectionThread.join();
+
+        }
+
+        unlink( m_socketPath.c_str() );
+
+    }
+
+    /**
+     * Replaces the script. Commands which are being answered still use the old one.
+     *
+     * @param standInScript
+     */
+    auto MySqlStandInServer::setScript( StandInScript standInScript ) -> void
+    {
+
+        std::shared_ptr<const StandInScript> script { standInScript ? std::make_shared<const StandInScript>( std::move( standInScript ) ) : nullptr };
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+        m_script.swap( script );
+
+    }
+
+    /**
+     * Closes all open connections like a restarted server - the clients get CR_SERVER_LOST or CR_SERVER_GONE_ERROR.
+     */
+    auto MySqlStandInServer::disconnectAll() -> void
+    {
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+
+        for ( const int socket : m_connectionSockets ) {
+
+            shutdown( socket, SHUT_RDWR );
+
+        }
+
+    }
+
+    auto MySqlStandInServer::acceptConnections() -> void
+    {
+
+        while ( false == m_stopping ) {
+
+            const int socket = accept4( m_listenSocket, nullptr, nullptr, SOCK_CLOEXEC );
+
+            if ( 0 > socket ) {
+
+                if ( EINTR == errno || ECONNABORTED == errno ) {
+
+                    continue;
+
+                }
+                return;
+
+            }
+
+            const std::lock_guard<std::mutex> lock( m_mutex );
+
+            if ( m_stopping ) {
+
+                close( socket );
+                return;
+
+            }
+
+            // The threads of closed connections have ended - they are joined, so only the open ones are kept.
+            for ( const size_t finishedConnection : m_finishedConnections ) {
+
+                m_connectionThreads [finishedConnection].join();
+                m_connectionThreads.erase( finishedConnection );
+
+            }
+            m_finishedConnections.clear();
+
+            const size_t connectionId = m_acceptedConnections++;
+
+            m_connectionSockets.insert( socket );
+            m_connectionThreads.emplace( connectionId, std::thread( &MySqlStandInServer::serveConnection, this, socket, connectionId ) );
+
+        }
+
+    }
+
+    auto MySqlStandInServer::runScript( const StandInCommand & standInCommand, StandInReply & standInReply ) -> void
+    {
+
+        std::shared_ptr<const StandInScript> script;
+        {
+
+            const std::lock_guard<std::mutex> lock( m_mutex );
+            script = m_script;
+
+        }
+
+        if ( script ) {
+
+            ( *script )( standInCommand, standInReply );
+
+        }
+
+    }
+
+    /**
+     * Runs the handshake and answers the commands of one connection until it's closed.
+     *
+     * @param socket
+     * @param connectionId
+     */
+    auto MySqlStandInServer::serveConnection( int socket, size_t connectionId ) -> void
+    {
+
+        ConnectionState connectionState;
+        connectionState.socket = socket;
+
+        bool connected = sendHandshake( connectionState, connectionId ) && authenticate( connectionState );
+
+        while ( connected && readRequest( connectionState ) && false == connectionState.request.empty() ) {
+
+            const Buffer & request = connectionState.request;
+
+            StandInCommand standInCommand;
+            standInCommand.connectionId = connectionId;
+            standInCommand.sequence     = m_receivedCommands++;
+            standInCommand.code         = request [0];
+            standInCommand.payload      = request;
+
+            StandInReply standInReply;
+            connectionState.response.clear();
+
+            if ( COM_QUIT == standInCommand.code ) {
+
+                break;
+
+            }
+
+            if ( COM_STMT_CLOSE == standInCommand.code || COM_STMT_SEND_LONG_DATA == standInCommand.code ) {
+
+                // No reply.
+                if ( COM_STMT_CLOSE == standInCommand.code && 5 <= request.size() ) {
+
+                    connectionState.statements.erase( request [1] | ( request [2] << 8 ) | ( request [3] << 16 ) |
+                                                      ( static_cast<unsigned long>( request [4] ) << 24 ) );
+
+                }
+                continue;
+
+            }
+
+            PreparedStatement * preparedStatement {};
+
+            switch ( standInCommand.code ) {
+
+                case COM_QUERY: {
+
+                    const unsigned char * position = request.data() + 1;
+                    const unsigned char * end      = request.data() + request.size();
+
+                    if ( 0 != ( connectionState.clientFlags & CLIENT_QUERY_ATTRIBUTES ) ) {
+
+                        unsigned long long attributesCount   {};
+                        unsigned long long parameterSetCount {};
+
+                        if ( false == Protocol::readLengthEncoded( position, end, attributesCount ) ||
+                             false == Protocol::readLengthEncoded( position, end, parameterSetCount ) ) {
+
+                            standInReply.errorCode    = ER_MALFORMED_PACKET;
+                            standInReply.errorMessage = "Malformed communication packet";
+                            break;
+
+                        }
+
+                        if ( 0 < attributesCount ) {
+
+                            standInReply.errorCode    = ER_NOT_SUPPORTED_YET;
+                            standInReply.errorMessage = "Query attributes are not supported by the stand-in server";
+                            break;
+
+                        }
+
+                    }
+                    standInCommand.query.assign( position, end );
+
+                    const std::optional<std::string> fileName = localInfileName( standInCommand.query );
+                    if ( false == fileName.has_value() ) {
+
+                        break;
+
+                    }
+
+                    if ( 0 == ( connectionState.clientFlags & CLIENT_LOCAL_FILES ) ) {
+
+                        standInReply.errorCode    = ER_CLIENT_LOCAL_FILES_DISABLED;
+                        standInReply.errorMessage = "Loading local data is disabled";
+                        break;
+
+                    }
+
+                    // Requests the file and reads it until the empty packet.
+                    Buffer payload { 0xFB };
+                    payload.insert( payload.end(), fileName->begin(), fileName->end() );
+                    appendPacket( connectionState, payload );
+                    if ( false == Protocol::writePacket( socket, connectionState.response ) ) {
+
+                        connected = false;
+                        break;
+
+                    }
+                    connectionState.response.clear();
+
+                    while ( ( connected = readRequest( connectionState ) ) && false == connectionState.request.empty() ) {
+
+                        standInCommand.localInfileData.append( connectionState.request.begin(), connectionState.request.end() );
+
+                    }
+
+                    standInReply.affectedRows = static_cast<unsigned long long>(
+                        std::count( standInCommand.localInfileData.begin(), standInCommand.localInfileData.end(), '\n' ) );
+                    break;
+
+                }
+
+                case COM_STMT_PREPARE:
+                    standInCommand.query.assign( request.begin() + 1, request.end() );
+                    break;
+
+                case COM_STMT_EXECUTE: {
+
+                    if ( 5 <= request.size() ) {
+
+                        standInCommand.statementId = request [1] | ( request [2] << 8 ) | ( request [3] << 16 ) |
+                                                     ( static_cast<unsigned long>( request [4] ) << 24 );
+
+                    }
+
+                    const auto statement = connectionState.statements.find( standInCommand.statementId );
+                    if ( connectionState.statements.end() == statement ) {
+
+                        standInReply.errorCode    = ER_UNKNOWN_STMT_HANDLER;
+                        standInReply.errorMessage = "Unknown prepared statement handler";
+                        break;
+
+                    }
+
+                    preparedStatement         = &statement->second;
+                    standInCommand.query      = preparedStatement->query;
+                    standInReply.affectedRows = 1;
+                    break;
+
+                }
+
+                case COM_RESET_CONNECTION:
+                    connectionState.statements.clear();
+                    break;
+
+                case COM_INIT_DB:
+                case COM_PING:
+                case COM_STMT_RESET:
+                case COM_SET_OPTION:
+                    break;
+
+                default:
+                    standInReply.errorCode    = ER_UNKNOWN_COM_ERROR;
+                    standInReply.errorMessage = "Unknown command";
+                    break;
+
+            }
+
+            if ( false == connected ) {
+
+                break;
+
+            }
+
+            runScript( standInCommand, standInReply );
+
+            if ( standInReply.disconnect ) {
+
+                break;
+
+            }
+
+            if ( 0 != standInReply.errorCode ) {
+
+                appendError( connectionState, standInReply.errorCode, standInReply.errorMessage );
+
+            } else if ( COM_STMT_PREPARE == standInCommand.code ) {
+
+                const unsigned long statementId = connectionState.nextStatementId++;
+                PreparedStatement & statement   = connectionState.statements [statementId];
+
+                statement.query           = standInCommand.query;
+                statement.parametersCount = countPlaceholders( standInCommand.query );
+                statement.columns         = standInReply.columns;
+                appendPrepareOk( connectionState, statementId, statement );
+
+            } else if ( nullptr != preparedStatement && false == preparedStatement->columns.empty() ) {
+
+                appendResultSet( connectionState, preparedStatement->columns, standInReply.rows, true );
+
+            } else if ( COM_QUERY == standInCommand.code && false == standInReply.columns.empty() ) {
+
+                appendResultSet( connectionState, standInReply.columns, standInReply.rows, false );
+
+            } else {
+
+                appendOk( connectionState, standInReply.affectedRows, standInReply.lastInsertId );
+
+            }
+
+            if ( 0 < standInReply.latency.count() ) {
+
+                std::this_thread::sleep_for( standInReply.latency );
+
+            }
+
+            connected = Protocol::writePacket( socket, connectionState.response );
+
+        }
+
+        const std::lock_guard<std::mutex> lock( m_mutex );
+        m_connectionSockets.erase( socket );
+        m_finishedConnections.push_back( connectionId );
+        close( socket );
+
+    }
+
+}
@@ -0,0 +1,121 @@
+/**
+ * MySqlStandInServer.h
+ *
+ * A server which speaks enough of the MySQL client/server protocol on a Unix socket to run the extension
+ * with the real libmysqlclient but without mysqld: handshake, COM_QUERY, COM_STMT_PREPARE, COM_STMT_EXECUTE,
+ * COM_STMT_CLOSE, LOAD DATA LOCAL INFILE and simple result sets. A script decides the reply to each command,
+ * so latency, errors and disconnects can be simulated deterministically.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef MYSQL_STAND_IN_SERVER_H
+#define MYSQL_STAND_IN_SERVER_H
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace FaF
+{
+
+    /**
+     * A command received from a client, as it's handed to the script.
+     */
+    using StandInCommand = struct StandInCommand
+    {
+
+            size_t                      connectionId {};
+            // Counts the commands of all connections, starting with 0.
+            size_t                      sequence     {};
+            unsigned char               code         {};
+            // The SQL command of COM_QUERY and COM_STMT_PREPARE - for COM_STMT_EXECUTE the one of the prepared statement.
+            std::string                 query;
+            unsigned long               statementId  {};
+            // The complete payload including the command byte - for example the encoded parameters of COM_STMT_EXECUTE.
+            std::vector<unsigned char>  payload;
+            // The data sent by the client for LOAD DATA LOCAL INFILE.
+            std::string                 localInfileData;
+
+    };
+
+    /**
+     * The reply to a command. The server fills in the defaults, the script can change them.
+     * <columns> and <rows> make a result set: for COM_QUERY and COM_STMT_EXECUTE the values are sent
+     * as strings, for COM_STMT_PREPARE only <columns> is used - it's the result set of the statement.
+     */
+    using StandInReply = struct StandInReply
+    {
+
+            std::chrono::nanoseconds    latency      {};
+            // Closes the connection instead of replying.
+            bool                        disconnect   {};
+            unsigned int                errorCode    {};
+            std::string                 errorMessage;
+            unsigned long long          affectedRows {};
+            unsigned long long          lastInsertId {};
+            std::vector<std::string>    columns;
+            std::vector< std::vector< std::optional<std::string> > > rows;
+
+    };
+
+    using StandInScript = std::function<void( const StandInCommand & standInCommand, StandInReply & standInReply )>;
+
+    class MySqlStandInServer
+    {
+
+        public:
+
+            explicit MySqlStandInServer( std::string socketPath, StandInScript standInScript = {} );
+            ~MySqlStandInServer();
+
+            MySqlStandInServer( const MySqlStandInServer & )             = delete;
+            MySqlStandInServer & operator=( const MySqlStandInServer & ) = delete;
+
+            auto setScript( StandInScript standInScript ) -> void;
+            auto disconnectAll()                          -> void;
+
+            auto socketPath()          const -> const std::string & { return m_socketPath; }
+            auto acceptedConnections() const -> size_t { return m_acceptedConnections.load(); }
+            auto receivedCommands()    const -> size_t { return m_receivedCommands.load(); }
+
+        private:
+
+            auto acceptConnections()                                                            -> void;
+            auto serveConnection( int socket, size_t connectionId )                             -> void;
+            auto runScript( const StandInCommand & standInCommand, StandInReply & standInReply ) -> void;
+
+            // constructor initialiser list - respect the order.
+
+                std::string                             m_socketPath;
+                std::shared_ptr<const StandInScript>    m_script;
+
+            int                                         m_listenSocket {-1};
+            std::atomic<bool>                           m_stopping     {};
+            std::atomic<size_t>                         m_acceptedConnections {};
+            std::atomic<size_t>                         m_receivedCommands    {};
+
+            // Protects <m_script>, <m_connectionSockets>, <m_connectionThreads> and <m_finishedConnections>.
+            std::mutex                                  m_mutex;
+            std::unordered_set<int>                     m_connectionSockets;
+            // The thread per connection id - the ids in <m_finishedConnections> are joined by the next accept.
+            std::unordered_map<size_t, std::thread>     m_connectionThreads;
+            std::vector<size_t>                         m_finishedConnections;
+            std::thread                                 m_acceptThread;
+
+    };
+
+}
+
+#endif
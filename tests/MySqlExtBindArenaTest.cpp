@@ -0,0 +1,198 @@
+/**
+ * MySqlExtBindArenaTest.cpp
+ *
+ * Regression tests for the statement arena of MySqlExtBind - the copy, the move and the swap of an instance, the
+ * bind variables used more than once and the names passed as string_view.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "MySqlExtBindTest.h"
+
+namespace
+{
+
+    constexpr const char * g_selectCommand { "SELECT * FROM t WHERE a = :id OR b = :id AND c = :name" };
+    constexpr const char * g_insertCommand { "INSERT INTO t (id) VALUES (:id)" };
+
+    /**
+     * Counts the bytes which are allocated and not yet given back.
+     */
+    class CountingResource : public std::pmr::memory_resource
+    {
+
+        public:
+
+            size_t  allocatedBytes {};
+            size_t  allocations    {};
+
+        private:
+
+            auto do_allocate( size_t bytes, size_t alignment ) -> void * override
+            {
+
+                allocatedBytes += bytes;
+                allocations++;
+
+                return std::pmr::new_delete_resource()->allocate( bytes, alignment );
+
+            }
+
+            auto do_deallocate( void * pointer, size_t bytes, size_t alignment ) -> void override
+            {
+
+                allocatedBytes -= bytes;
+                std::pmr::new_delete_resource()->deallocate( pointer, bytes, alignment );
+
+            }
+
+            auto do_is_equal( const std::pmr::memory_resource & other ) const noexcept -> bool override
+            {
+
+                return this == &other;
+
+            }
+
+    };
+
+    // The buffer bound at <position> - checkedBindArray() resets the assigned flags, so the values are assigned again.
+    auto boundBuffer( FaF::MySqlExtBind & extBind, u_int position ) -> const void *
+    {
+
+        return extBind.checkedBindArray() [position].buffer;
+
+    }
+
+    /**
+     * A bind variable used more than once is bound at each of its positions.
+     */
+    auto repeatedNames() -> void
+    {
+
+        FaF::MySqlExtBind extBind( nullptr, g_selectCommand );
+
+        FAF_CHECK( "SELECT * FROM t WHERE a = ? OR b = ? AND c = ?" == extBind.adjustedMysqlCommand() );
+        FAF_CHECK( 3 == extBind.bindVariablesCount() );
+        FAF_CHECK( 0 == extBind.bindPosition( "id" ) );
+        FAF_CHECK( 2 == extBind.bindPosition( "name" ) );
+
+        int  id { 7 };
+        char name [] { "name" };
+
+        extBind.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        extBind.assignBindData( "name", MYSQL_TYPE_STRING, name );
+
+        const MYSQL_BIND * mysqlBindArray = extBind.checkedBindArray();
+        FAF_CHECK( &id == mysqlBindArray [0].buffer );
+        FAF_CHECK( &id == mysqlBindArray [1].buffer );
+        FAF_CHECK( name == mysqlBindArray [2].buffer );
+        FAF_CHECK( MYSQL_TYPE_LONG == mysqlBindArray [1].buffer_type );
+
+        // Each name counts once - <id> is still missing although <name> has been assigned twice.
+        extBind.assignBindData( "name", MYSQL_TYPE_STRING, name );
+        extBind.assignBindData( "name", MYSQL_TYPE_STRING, name );
+        FAF_CHECK( FaF::Test::throwsException( [&extBind]() { extBind.checkedBindArray(); } ) );
+
+    }
+
+    /**
+     * The names are compared by their length - a string_view doesn't need to end with '\0'.
+     */
+    auto stringViewNames() -> void
+    {
+
+        FaF::MySqlExtBind extBind( nullptr, g_selectCommand );
+
+        const std::string names { "idname" };
+        const std::string_view allNames { names };
+        int                    id { 1 };
+        char                   name [] { "name" };
+
+        extBind.assignBindData( allNames.substr( 0, 2 ), MYSQL_TYPE_LONG, &id );
+        extBind.assignBindData( allNames.substr( 2 ), MYSQL_TYPE_STRING, name );
+        FAF_CHECK( &id == boundBuffer( extBind, 1 ) );
+
+        FAF_CHECK( FaF::Test::throwsException( [&]() { extBind.assignBindData( allNames.substr( 0, 1 ), MYSQL_TYPE_LONG, &id ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [&]() { extBind.assignBindData( allNames, MYSQL_TYPE_LONG, &id ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [&]() { extBind.assignBindData( std::string_view {}, MYSQL_TYPE_LONG, &id ); } ) );
+
+    }
+
+    /**
+     * A copy has its own arena from the same memory resource - with the values assigned so far. A move takes the
+     * arena over, a swap exchanges them.
+     */
+    auto copyMoveSwap() -> void
+    {
+
+        CountingResource countingResource;
+
+        {
+
+            int firstId  { 1 };
+            int secondId { 2 };
+
+            FaF::MySqlExtBind original( nullptr, g_insertCommand, &countingResource );
+            original.assignBindData( "id", MYSQL_TYPE_LONG, &firstId );
+
+            const size_t arenaBytes = countingResource.allocatedBytes;
+            FAF_CHECK( 1 == countingResource.allocations );
+
+            FaF::MySqlExtBind copy( original );
+            FAF_CHECK( 2 * arenaBytes == countingResource.allocatedBytes );
+            FAF_CHECK( original.adjustedMysqlCommand() == copy.adjustedMysqlCommand() );
+            FAF_CHECK( original.adjustedMysqlCommand().data() != copy.adjustedMysqlCommand().data() );
+
+            // The copy has taken over the value - assigning another one doesn't change the original.
+            FAF_CHECK( &firstId == copy.checkedBindArray() [0].buffer );
+            copy.assignBindData( "id", MYSQL_TYPE_LONG, &secondId );
+            FAF_CHECK( &firstId == boundBuffer( original, 0 ) );
+            FAF_CHECK( &secondId == copy.checkedBindArray() [0].buffer );
+
+            // The move takes the arena over - nothing is allocated.
+            const char *      originalCommand = original.adjustedMysqlCommand().data();
+            FaF::MySqlExtBind moved( std::move( original ) );
+            FAF_CHECK( originalCommand == moved.adjustedMysqlCommand().data() );
+            FAF_CHECK( 2 == countingResource.allocations );
+
+            FaF::MySqlExtBind other( nullptr, g_selectCommand, &countingResource );
+            std::swap( moved, other );
+            FAF_CHECK( "SELECT * FROM t WHERE a = ? OR b = ? AND c = ?" == moved.adjustedMysqlCommand() );
+            FAF_CHECK( originalCommand == other.adjustedMysqlCommand().data() );
+            FAF_CHECK( 3 == countingResource.allocations );
+
+            // The copy assignment frees the old arena of <copy>.
+            copy = other;
+            FAF_CHECK( "INSERT INTO t (id) VALUES (?)" == copy.adjustedMysqlCommand() );
+            copy = moved;
+            FAF_CHECK( 3 == copy.bindVariablesCount() );
+
+            copy = std::move( other );
+            FAF_CHECK( originalCommand == copy.adjustedMysqlCommand().data() );
+
+        }
+
+        FAF_CHECK( 0 == countingResource.allocatedBytes );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    repeatedNames();
+    stringViewNames();
+    copyMoveSwap();
+
+    return FaF::Test::result( "MySqlExtBindArenaTest" );
+
+}
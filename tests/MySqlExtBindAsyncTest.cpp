@@ -0,0 +1,120 @@
+/**
+ * MySqlExtBindAsyncTest.cpp
+ *
+ * Regression tests for MySqlExtBindIoThread without scheduler - the coroutines are resumed on the I/O thread and
+ * await it again while its queue is full. Needs -std=c++20 like MySqlExtBindAsync.cpp.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <thread>
+#include <unistd.h>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindAsync.h"
+
+namespace
+{
+
+    constexpr u_int g_roots    { 4 };
+    constexpr u_int g_children { 3 };
+    constexpr u_int g_calls    { 1000 };
+
+    /**
+     * A coroutine which runs until its first suspension when it's called and destroys itself at the end.
+     */
+    struct DetachedTask
+    {
+
+            struct promise_type
+            {
+
+                    auto get_return_object()            -> DetachedTask       { return {}; }
+                    auto initial_suspend()              -> std::suspend_never { return {}; }
+                    auto final_suspend() noexcept       -> std::suspend_never { return {}; }
+                    auto return_void()                  -> void               {}
+                    auto unhandled_exception()          -> void               { std::terminate(); }
+
+            };
+
+    };
+
+    /**
+     * After its first call - on the I/O thread - the coroutine starts a child, so two calls are queued for the one taken.
+     *
+     * @param ioThread
+     * @param calls
+     * @param finished
+     * @param children The depth of the chain of children.
+     */
+    auto callRepeatedly( FaF::MySqlExtBindIoThread & ioThread, std::atomic<u_int> & calls, std::atomic<u_int> & finished,
+                         u_int children ) -> DetachedTask
+    {
+
+        for ( u_int index = 0; index < g_calls; index++ ) {
+
+            co_await ioThread.run( [&calls]() { calls.fetch_add( 1, std::memory_order_relaxed ); } );
+
+            if ( 0 == index && 0 < children ) {
+
+                callRepeatedly( ioThread, calls, finished, children - 1 );
+
+            }
+
+        }
+
+        finished.fetch_add( 1, std::memory_order_release );
+
+    }
+
+    /**
+     * The coroutines await the I/O thread again from the I/O thread - with a queue of 2 calls it's full at once.
+     */
+    auto selfSubmission() -> void
+    {
+
+        MYSQL              mysqlConnection {};
+        std::atomic<u_int> calls    {};
+        std::atomic<u_int> finished {};
+
+        {
+
+            FaF::MySqlExtBindIoThread ioThread( &mysqlConnection, nullptr, 2 );
+
+            for ( u_int root = 0; root < g_roots; root++ ) {
+
+                callRepeatedly( ioThread, calls, finished, g_children );
+
+            }
+
+            while ( g_roots * ( g_children + 1 ) > finished.load( std::memory_order_acquire ) ) {
+
+                std::this_thread::yield();
+
+            }
+
+        }
+
+        FAF_CHECK( g_roots * ( g_children + 1 ) * g_calls == calls.load() );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    // A deadlock fails the test instead of hanging it.
+    alarm( 60 );
+
+    selfSubmission();
+
+    return FaF::Test::result( "MySqlExtBindAsyncTest" );
+
+}
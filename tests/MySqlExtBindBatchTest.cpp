@@ -0,0 +1,231 @@
+/**
+ * MySqlExtBindBatchTest.cpp
+ *
+ * Regression tests for the key order, the lock error bisection and the prepare errors of MySqlExtBindBatch - run
+ * against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <algorithm>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include <mysqld_error.h>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindBatch.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    constexpr const char * g_insertCommand { "INSERT INTO t (id) VALUES (:id)" };
+
+    // The ids of each executed statement.
+    std::vector<std::vector<int>> g_statements;
+
+    /**
+     * Records the ids of each executed statement - a statement with <failedId> fails with <errorCode>.
+     *
+     * @param failedId
+     * @param errorCode
+     */
+    auto recordStatements( int failedId, unsigned int errorCode ) -> void
+    {
+
+        g_statements.clear();
+
+        FaF::MySqlClientStub::setExecuteResult( [failedId, errorCode]( MYSQL_STMT * mysqlStatement ) -> unsigned int {
+
+            std::vector<int> ids;
+
+            for ( const MYSQL_BIND & mysqlBindItem : FaF::MySqlClientStub::boundParameters( mysqlStatement ) ) {
+
+                ids.push_back( *static_cast<const int *>( mysqlBindItem.buffer ) );
+
+            }
+
+            g_statements.push_back( ids );
+
+            return ids.end() != std::find( ids.begin(), ids.end(), failedId ) ? errorCode : 0;
+
+        } );
+
+    }
+
+    auto addRows( FaF::MySqlExtBindBatch & batch, const std::vector<int> & ids ) -> void
+    {
+
+        FaF::MySqlExtBind extBind( nullptr, g_insertCommand );
+
+        for ( int id : ids ) {
+
+            extBind.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+            batch.add( extBind );
+
+        }
+
+    }
+
+    auto orderByKey( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindBatch batch( mysqlConnection, g_insertCommand, 4 );
+
+        batch.orderByKey( { "id" } );
+        recordStatements( 0, 0 );
+        addRows( batch, { 9, -3, 7, 2, 100000, 0 } );
+
+        const std::vector<unsigned int> errorCodes = batch.execute();
+
+        FAF_CHECK( 6 == errorCodes.size() );
+        FAF_CHECK( 2 == g_statements.size() );
+        FAF_CHECK( ( std::vector<int> { -3, 0, 2, 7 } ) == g_statements [0] );
+        FAF_CHECK( ( std::vector<int> { 9, 100000 } ) == g_statements [1] );
+
+        FAF_CHECK( FaF::Test::throwsException( [&batch]() { batch.orderByKey( { "unknown" } ); } ) );
+
+    }
+
+    auto bisectDeadlockInAutocommit( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindBatch batch( mysqlConnection, g_insertCommand, 8 );
+
+        mysqlConnection->server_status = SERVER_STATUS_AUTOCOMMIT;
+        batch.bisectLockErrors( true );
+        recordStatements( 7, ER_LOCK_DEADLOCK );
+        addRows( batch, { 1, 2, 3, 4, 5, 6, 7, 8 } );
+
+        const std::vector<unsigned int> errorCodes = batch.execute();
+
+        // Only the row with the colliding key fails - 8 rows, then 4 + 4, 2 + 2 and 1 + 1.
+        FAF_CHECK( ( std::vector<unsigned int> { 0, 0, 0, 0, 0, 0, ER_LOCK_DEADLOCK, 0 } ) == errorCodes );
+        FAF_CHECK( 7 == g_statements.size() );
+
+    }
+
+    auto deadlockInTransaction( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindBatch batch( mysqlConnection, g_insertCommand, 8 );
+
+        // The deadlock has rolled back more than the statement - nothing is executed again.
+        mysqlConnection->server_status = SERVER_STATUS_AUTOCOMMIT | SERVER_STATUS_IN_TRANS;
+        batch.bisectLockErrors( true );
+        recordStatements( 7, ER_LOCK_DEADLOCK );
+        addRows( batch, { 1, 2, 3, 4, 5, 6, 7, 8 } );
+
+        FAF_CHECK( std::vector<unsigned int>( 8, ER_LOCK_DEADLOCK ) == batch.execute() );
+        FAF_CHECK( 1 == g_statements.size() );
+
+        mysqlConnection->server_status = 0;
+        addRows( batch, { 1, 2, 3, 4, 5, 6, 7, 8 } );
+
+        FAF_CHECK( std::vector<unsigned int>( 8, ER_LOCK_DEADLOCK ) == batch.execute() );
+        FAF_CHECK( 2 == g_statements.size() );
+
+    }
+
+    auto bisectLockWaitTimeout( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindBatch batch( mysqlConnection, g_insertCommand, 4 );
+
+        // Only the statement is rolled back, also inside a transaction.
+        mysqlConnection->server_status = SERVER_STATUS_IN_TRANS;
+        batch.bisectLockErrors( true );
+        recordStatements( 2, ER_LOCK_WAIT_TIMEOUT );
+        addRows( batch, { 1, 2, 3, 4, 5 } );
+
+        FAF_CHECK( ( std::vector<unsigned int> { 0, ER_LOCK_WAIT_TIMEOUT, 0, 0, 0 } ) == batch.execute() );
+
+        batch.bisectLockErrors( false );
+        recordStatements( 2, ER_LOCK_WAIT_TIMEOUT );
+        addRows( batch, { 1, 2, 3, 4, 5 } );
+
+        FAF_CHECK( ( std::vector<unsigned int> { ER_LOCK_WAIT_TIMEOUT, ER_LOCK_WAIT_TIMEOUT, ER_LOCK_WAIT_TIMEOUT, ER_LOCK_WAIT_TIMEOUT, 0 } )
+                   == batch.execute() );
+
+    }
+
+    /**
+     * The error of a failed prepare reaches the rows - mysql_stmt_close() has cleared the one of the connection.
+     */
+    auto prepareError( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindBatch batch( mysqlConnection, g_insertCommand, 4 );
+
+        recordStatements( 0, 0 );
+        FaF::MySqlClientStub::setPrepareResult( []( std::string_view ) -> unsigned int { return ER_NO_SUCH_TABLE; } );
+        addRows( batch, { 1, 2, 3, 4, 5 } );
+
+        FAF_CHECK( std::vector<unsigned int>( 5, ER_NO_SUCH_TABLE ) == batch.execute() );
+        FAF_CHECK( g_statements.empty() );
+        FAF_CHECK( 0 == mysql_errno( mysqlConnection ) );
+
+        // The failed statements aren't cached - they are prepared again.
+        FaF::MySqlClientStub::setPrepareResult( {} );
+        addRows( batch, { 1, 2, 3, 4, 5 } );
+
+        FAF_CHECK( std::vector<unsigned int>( 5, 0 ) == batch.execute() );
+        FAF_CHECK( 2 == g_statements.size() );
+
+    }
+
+    /**
+     * Only the VALUES keyword after the column list or the table name starts the tuple - not a column called value,
+     * and a <?> in a comment is no placeholder.
+     */
+    auto valuesClause( MYSQL * mysqlConnection ) -> void
+    {
+
+        const auto tupleOf = []( std::string_view adjustedMysqlCommand ) -> std::string_view {
+
+            const std::optional<FaF::ValuesClause> valuesClause = FaF::MySqlExtBindBatch::findValuesClause( adjustedMysqlCommand );
+            return valuesClause.has_value() ? valuesClause->tuple : "";
+
+        };
+
+        FAF_CHECK( "(?, ?)" == tupleOf( "INSERT INTO counters (name, value) VALUES (?, ?)" ) );
+        FAF_CHECK( "(?, ?)" == tupleOf( "INSERT INTO counters (`values`, value) VALUE (?, ?)" ) );
+        FAF_CHECK( "(?)" == tupleOf( "INSERT INTO value VALUES (?)" ) );
+        FAF_CHECK( "(?)" == tupleOf( "INSERT IGNORE INTO db.t /* VALUES (?) */ VALUES (?)" ) );
+        FAF_CHECK( "(?)" == tupleOf( "INSERT INTO t (a) VALUES (?) -- trailing ? comment" ) );
+        FAF_CHECK( "(?)" == tupleOf( "INSERT INTO t (a) VALUES (?) # trailing ? comment" ) );
+        FAF_CHECK( "" == tupleOf( "INSERT INTO t (a) VALUES (?) --? no comment" ) );
+        FAF_CHECK( "" == tupleOf( "INSERT INTO t (a) SELECT value FROM s WHERE id = ?" ) );
+
+        FaF::MySqlExtBindBatch batch( mysqlConnection, "INSERT INTO counters (id, value) VALUES (:id, 1) -- trailing ? comment", 4 );
+
+        recordStatements( 0, 0 );
+        addRows( batch, { 1, 2, 3 } );
+
+        FAF_CHECK( std::vector<unsigned int>( 3, 0 ) == batch.execute() );
+        FAF_CHECK( ( std::vector<std::vector<int>> { { 1, 2 }, { 3 } } ) == g_statements );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    orderByKey( &mysqlConnection );
+    bisectDeadlockInAutocommit( &mysqlConnection );
+    deadlockInTransaction( &mysqlConnection );
+    bisectLockWaitTimeout( &mysqlConnection );
+    prepareError( &mysqlConnection );
+    valuesClause( &mysqlConnection );
+
+    return FaF::Test::result( "MySqlExtBindBatchTest" );
+
+}
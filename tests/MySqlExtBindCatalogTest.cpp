@@ -0,0 +1,145 @@
+/**
+ * MySqlExtBindCatalogTest.cpp
+ *
+ * Regression tests for MySqlExtBindCatalog and MySqlExtBindSnapshot - entries with and without bind variables
+ * loaded from a .sql file, saved into a snapshot and opened again.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindCatalog.h"
+#include "../MySqlExtBindSnapshot.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    constexpr const char * g_catalogPath  { "/tmp/MySqlExtBindCatalogTest.sql" };
+    constexpr const char * g_snapshotPath { "/tmp/MySqlExtBindCatalogTest.snapshot" };
+
+    auto writeCatalog() -> void
+    {
+
+        std::ofstream catalogFile( g_catalogPath, std::ios::trunc );
+
+        catalogFile << "-- name: currentTime\n"
+                       "SELECT NOW();\n"
+                       "\n"
+                       "-- name: findCustomer\n"
+                       "SELECT * FROM customers\n"
+                       " WHERE id = :id;\n"
+                       "\n"
+                       "-- name: insertCustomer\n"
+                       "INSERT INTO customers SET id = :id, name = :name;\n";
+
+    }
+
+    /**
+     * Parameterless entries are taken as they are, the others are parsed.
+     */
+    auto catalog( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindCatalog catalog;
+        catalog.load( { g_catalogPath }, 2 );
+
+        FAF_CHECK( 3 == catalog.size() );
+        FAF_CHECK( catalog.contains( "currentTime" ) && false == catalog.contains( "currentDate" ) );
+        FAF_CHECK( 0 == catalog.parsed( "currentTime" ).bindVariablesCount() );
+        FAF_CHECK( 1 == catalog.parsed( "findCustomer" ).bindVariablesCount() );
+        FAF_CHECK( 2 == catalog.parsed( "insertCustomer" ).bindVariablesCount() );
+        FAF_CHECK( "INSERT INTO customers SET id = ?, name = ?" == catalog.parsed( "insertCustomer" ).adjustedMysqlCommand() );
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+
+        FaF::MySqlExtBind & currentTime = catalog.statement( "currentTime", statementCache );
+        FAF_CHECK( catalog.command( "currentTime" ) == currentTime.adjustedMysqlCommand() );
+        FAF_CHECK( 0 == statementCache.execute( currentTime, true ) );
+
+        int                 id { 7 };
+        FaF::MySqlExtBind & findCustomer = catalog.statement( "findCustomer", statementCache );
+        findCustomer.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FAF_CHECK( 0 == statementCache.execute( findCustomer, true ) );
+        FAF_CHECK( 2 == statementCache.size() );
+
+        // A duplicate name fails the load.
+        FAF_CHECK( FaF::Test::throwsException( [&catalog]() { catalog.load( { g_catalogPath } ); } ) );
+        FAF_CHECK( 3 == catalog.size() );
+
+    }
+
+    /**
+     * The snapshot holds the same templates as the catalog - with and without bind variables.
+     */
+    auto snapshot() -> void
+    {
+
+        FaF::MySqlExtBindCatalog catalog;
+        catalog.load( { g_catalogPath }, 1 );
+
+        std::vector<FaF::TemplateUse> templateUses;
+        unsigned long long            executions {};
+
+        for ( const std::string_view entryName : catalog.entryNames() ) {
+
+            templateUses.push_back( { std::string( catalog.command( entryName ) ), ++executions } );
+
+        }
+
+        FAF_CHECK( FaF::MySqlExtBindSnapshot::save( g_snapshotPath, templateUses ) );
+
+        FaF::MySqlExtBindSnapshot snapshot;
+        FAF_CHECK( snapshot.open( g_snapshotPath ) );
+        FAF_CHECK( templateUses.size() == snapshot.size() );
+
+        for ( const FaF::TemplateUse & templateUse : templateUses ) {
+
+            FAF_CHECK( snapshot.contains( templateUse.mysqlCommand ) );
+
+            const FaF::MySqlExtBind savedExtBind = snapshot.statement( templateUse.mysqlCommand, nullptr );
+            const FaF::MySqlExtBind & parsedExtBind = catalog.parsed( catalog.entryNames() [&templateUse - templateUses.data()] );
+
+            FAF_CHECK( parsedExtBind.adjustedMysqlCommand() == savedExtBind.adjustedMysqlCommand() );
+            FAF_CHECK( parsedExtBind.bindVariablesCount() == savedExtBind.bindVariablesCount() );
+
+        }
+
+        unsigned long long savedExecutions {};
+        for ( const FaF::TemplateUse & templateUse : snapshot.templateUses() ) {
+
+            savedExecutions += templateUse.executions;
+
+        }
+
+        FAF_CHECK( 6 == savedExecutions );
+        FAF_CHECK( false == snapshot.contains( "SELECT 1" ) );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    writeCatalog();
+
+    catalog( &mysqlConnection );
+    snapshot();
+
+    std::remove( g_catalogPath );
+    std::remove( g_snapshotPath );
+
+    return FaF::Test::result( "MySqlExtBindCatalogTest" );
+
+}
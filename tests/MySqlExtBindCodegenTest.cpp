@@ -0,0 +1,108 @@
+/**
+ * MySqlExtBindCodegenTest.cpp
+ *
+ * Regression tests for the code generator - this file includes the header generated from
+ * tests/MySqlExtBindCodegenTest.sql, so it compiles only if the header does. The generator itself is passed as the
+ * argument, it must fail for entries which would get the same struct name.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <string_view>
+
+#include "MySqlExtBindTest.h"
+#include "MySqlExtBindCodegenTest.h"
+
+namespace
+{
+
+    constexpr const char * g_collisionPath { "/tmp/MySqlExtBindCodegenCollision.sql" };
+    constexpr const char * g_headerPath    { "/tmp/MySqlExtBindCodegenCollision.h" };
+
+    /**
+     * The members are bound in the order of the placeholders - a bind variable used twice is bound twice.
+     */
+    auto sizedAndNullable() -> void
+    {
+
+        FAF_CHECK( "SELECT * FROM customers WHERE name = ? OR id = ? OR alias = ?" == Sql::FindCustomer::mysqlCommand );
+        FAF_CHECK( 3 == Sql::FindCustomer::bindVariablesCount );
+
+        Sql::FindCustomer findCustomer;
+        MYSQL_BIND        mysqlBindArray [Sql::FindCustomer::bindVariablesCount];
+
+        findCustomer.bind( mysqlBindArray );
+
+        FAF_CHECK( MYSQL_TYPE_STRING == mysqlBindArray [0].buffer_type );
+        FAF_CHECK( findCustomer.name == mysqlBindArray [0].buffer );
+        FAF_CHECK( 64 == mysqlBindArray [0].buffer_length );
+        FAF_CHECK( &findCustomer.nameLength == mysqlBindArray [0].length );
+        FAF_CHECK( &findCustomer.nameIsNull == mysqlBindArray [0].is_null );
+        FAF_CHECK( MYSQL_TYPE_LONG == mysqlBindArray [1].buffer_type );
+        FAF_CHECK( &findCustomer.id == mysqlBindArray [1].buffer );
+        FAF_CHECK( nullptr == mysqlBindArray [1].is_null );
+        FAF_CHECK( findCustomer.name == mysqlBindArray [2].buffer );
+
+    }
+
+    /**
+     * A name longer than any fixed buffer is generated in full, the unsigned types set is_unsigned.
+     */
+    auto longNames() -> void
+    {
+
+        FAF_CHECK( 2 == Sql::UpdateCounter::bindVariablesCount );
+
+        Sql::UpdateCounter updateCounter;
+        MYSQL_BIND         mysqlBindArray [Sql::UpdateCounter::bindVariablesCount];
+
+        updateCounter.bind( mysqlBindArray );
+
+        FAF_CHECK( &updateCounter.hits == mysqlBindArray [0].buffer );
+        FAF_CHECK( &updateCounter.counterIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifier == mysqlBindArray [1].buffer );
+        FAF_CHECK( MYSQL_TYPE_LONGLONG == mysqlBindArray [1].buffer_type );
+        FAF_CHECK( mysqlBindArray [1].is_unsigned );
+
+        FAF_CHECK( "SELECT NOW()" == Sql::CurrentTime::mysqlCommand );
+        FAF_CHECK( 0 == Sql::CurrentTime::bindVariablesCount );
+
+    }
+
+    /**
+     * <findCustomer> and <FindCustomer> would both become the struct FindCustomer - the generator fails and doesn't
+     * write the header.
+     */
+    auto structNameCollision( const std::string & generatorPath ) -> void
+    {
+
+        std::ofstream( g_collisionPath ) << "-- name: findCustomer\nSELECT 1\n\n-- name: FindCustomer\nSELECT 2\n";
+        std::remove( g_headerPath );
+
+        const std::string command { generatorPath + " --output " + g_headerPath + " " + g_collisionPath + " 2> /dev/null" };
+
+        FAF_CHECK( 0 != std::system( command.c_str() ) );
+        FAF_CHECK( false == std::ifstream( g_headerPath ).is_open() );
+
+        std::remove( g_collisionPath );
+
+    }
+
+}
+
+auto main( int argc, char * argv [] ) -> int
+{
+
+    sizedAndNullable();
+    longNames();
+    structNameCollision( 1 < argc ? argv [1] : "./MySqlExtBindCodegen" );
+
+    return FaF::Test::result( "MySqlExtBindCodegenTest" );
+
+}
@@ -0,0 +1,14 @@
+-- The catalog of MySqlExtBindCodegenTest - generated into tests/MySqlExtBindCodegenTest.generated.h
+
+-- name: findCustomer
+-- param: id   int32
+-- param: name string(64) null
+SELECT * FROM customers WHERE name = :name OR id = :id OR alias = :name
+
+-- name: updateCounter
+-- param: counterIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifier uint64
+-- param: hits uint32
+UPDATE counters SET hits = :hits WHERE id = :counterIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifierIdentifier
+
+-- name: currentTime
+SELECT NOW()
@@ -0,0 +1,229 @@
+/**
+ * MySqlExtBindGroupCommitTest.cpp
+ *
+ * Regression tests for the error handling and the statement invalidation of MySqlExtBindGroupCommit - run against
+ * the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <chrono>
+#include <future>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <errmsg.h>
+#include <mysqld_error.h>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindGroupCommit.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    constexpr const char * g_insertCommand { "INSERT INTO t (id) VALUES (:id)" };
+
+    // The group is committed when it's full - the window never ends during a test.
+    const FaF::GroupCommitOptions g_groupOf3 { std::chrono::seconds( 60 ), 3, 16 };
+
+    // The commands passed to mysql_query().
+    std::vector<std::string> g_queries;
+
+    /**
+     * Records the commands passed to mysql_query() - <failedCommand> fails with <errorCode>.
+     * The committer thread is the only caller, the futures synchronise the reads.
+     *
+     * @param failedCommand
+     * @param errorCode
+     */
+    auto recordQueries( std::string_view failedCommand, unsigned int errorCode ) -> void
+    {
+
+        g_queries.clear();
+
+        FaF::MySqlClientStub::setQueryResult( [failedCommand, errorCode]( std::string_view mysqlCommand ) -> unsigned int {
+
+            g_queries.emplace_back( mysqlCommand );
+
+            return failedCommand == mysqlCommand ? errorCode : 0;
+
+        } );
+
+    }
+
+    // A statement with the id <failedId> fails with <errorCode>.
+    auto failStatements( int failedId, unsigned int errorCode ) -> void
+    {
+
+        FaF::MySqlClientStub::setExecuteResult( [failedId, errorCode]( MYSQL_STMT * mysqlStatement ) -> unsigned int {
+
+            const std::vector<MYSQL_BIND> boundParameters = FaF::MySqlClientStub::boundParameters( mysqlStatement );
+
+            return false == boundParameters.empty() && failedId == *static_cast<const int *>( boundParameters.front().buffer ) ? errorCode : 0;
+
+        } );
+
+    }
+
+    auto transaction( int id ) -> FaF::MySqlExtBindTransaction
+    {
+
+        FaF::MySqlExtBind             extBind( nullptr, g_insertCommand );
+        FaF::MySqlExtBindTransaction  insertTransaction;
+
+        extBind.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        insertTransaction.add( extBind );
+
+        return insertTransaction;
+
+    }
+
+    // Commits the transactions with <ids> as one group and returns the outcome of each.
+    auto commitGroup( FaF::MySqlExtBindGroupCommit & groupCommit, const std::vector<int> & ids ) -> std::vector<unsigned int>
+    {
+
+        std::vector<std::future<unsigned int>>  completions;
+        std::vector<unsigned int>               errorCodes;
+
+        for ( int id : ids ) {
+
+            completions.push_back( groupCommit.commit( transaction( id ) ) );
+
+        }
+
+        for ( std::future<unsigned int> & completion : completions ) {
+
+            errorCodes.push_back( completion.get() );
+
+        }
+
+        return errorCodes;
+
+    }
+
+    auto commitGroup( MYSQL * mysqlConnection, const std::vector<int> & ids ) -> std::vector<unsigned int>
+    {
+
+        FaF::MySqlExtBindGroupCommit groupCommit( mysqlConnection, g_groupOf3 );
+
+        return commitGroup( groupCommit, ids );
+
+    }
+
+    /**
+     * A failed statement rolls the group back - each transaction is executed again on its own.
+     */
+    auto statementError( MYSQL * mysqlConnection ) -> void
+    {
+
+        recordQueries( {}, 0 );
+        failStatements( 2, ER_DUP_ENTRY );
+
+        FAF_CHECK( ( std::vector<unsigned int> { 0, ER_DUP_ENTRY, 0 } ) == commitGroup( mysqlConnection, { 1, 2, 3 } ) );
+        FAF_CHECK( ( std::vector<std::string> { "START TRANSACTION", "ROLLBACK",
+                                                "START TRANSACTION", "COMMIT",
+                                                "START TRANSACTION", "ROLLBACK",
+                                                "START TRANSACTION", "COMMIT" } ) == g_queries );
+
+        FaF::MySqlClientStub::setExecuteResult( {} );
+
+    }
+
+    /**
+     * A failed COMMIT isn't retried - the group may have been committed, so each caller gets the error.
+     */
+    auto commitError( MYSQL * mysqlConnection ) -> void
+    {
+
+        recordQueries( "COMMIT", CR_SERVER_LOST );
+
+        FAF_CHECK( std::vector<unsigned int>( 3, CR_SERVER_LOST ) == commitGroup( mysqlConnection, { 1, 2, 3 } ) );
+        FAF_CHECK( ( std::vector<std::string> { "START TRANSACTION", "COMMIT" } ) == g_queries );
+
+    }
+
+    /**
+     * The error of a failed prepare reaches the callers - mysql_stmt_close() has cleared the one of the connection.
+     */
+    auto prepareError( MYSQL * mysqlConnection ) -> void
+    {
+
+        recordQueries( {}, 0 );
+        FaF::MySqlClientStub::setPrepareResult( []( std::string_view ) -> unsigned int { return ER_NO_SUCH_TABLE; } );
+
+        FAF_CHECK( std::vector<unsigned int>( 3, ER_NO_SUCH_TABLE ) == commitGroup( mysqlConnection, { 1, 2, 3 } ) );
+        FAF_CHECK( 0 == mysql_errno( mysqlConnection ) );
+
+        FaF::MySqlClientStub::setPrepareResult( {} );
+
+        FAF_CHECK( std::vector<unsigned int>( 3, 0 ) == commitGroup( mysqlConnection, { 1, 2, 3 } ) );
+
+    }
+
+    /**
+     * A statement invalidated by the server is prepared again - the group is retried transaction by transaction.
+     */
+    auto needReprepare( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindGroupCommit groupCommit( mysqlConnection, g_groupOf3 );
+
+        recordQueries( {}, 0 );
+        FAF_CHECK( std::vector<unsigned int>( 3, 0 ) == commitGroup( groupCommit, { 1, 2, 3 } ) );
+
+        FaF::MySqlClientStub::resetCounters();
+        FaF::MySqlClientStub::setExecuteResult( [failures = 1]( MYSQL_STMT * ) mutable -> unsigned int {
+
+            return 0 < failures-- ? ER_NEED_REPREPARE : 0;
+
+        } );
+
+        FAF_CHECK( std::vector<unsigned int>( 3, 0 ) == commitGroup( groupCommit, { 4, 5, 6 } ) );
+        FAF_CHECK( 1 == FaF::MySqlClientStub::counters().prepareCalls );
+
+        FaF::MySqlClientStub::setExecuteResult( {} );
+
+    }
+
+    /**
+     * After a lost connection the next group prepares its statements again instead of using the dead handles.
+     */
+    auto serverLost( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindGroupCommit groupCommit( mysqlConnection, g_groupOf3 );
+
+        recordQueries( "COMMIT", CR_SERVER_LOST );
+        FAF_CHECK( std::vector<unsigned int>( 3, CR_SERVER_LOST ) == commitGroup( groupCommit, { 1, 2, 3 } ) );
+
+        FaF::MySqlClientStub::resetCounters();
+        recordQueries( {}, 0 );
+
+        FAF_CHECK( std::vector<unsigned int>( 3, 0 ) == commitGroup( groupCommit, { 4, 5, 6 } ) );
+        FAF_CHECK( 1 == FaF::MySqlClientStub::counters().prepareCalls );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    statementError( &mysqlConnection );
+    commitError( &mysqlConnection );
+    prepareError( &mysqlConnection );
+    needReprepare( &mysqlConnection );
+    serverLost( &mysqlConnection );
+
+    FaF::MySqlClientStub::setQueryResult( {} );
+
+    return FaF::Test::result( "MySqlExtBindGroupCommitTest" );
+
+}
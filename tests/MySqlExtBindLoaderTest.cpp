@@ -0,0 +1,174 @@
+/**
+ * MySqlExtBindLoaderTest.cpp
+ *
+ * Regression tests for MySqlExtBindLoader - the LOAD DATA command built from the INSERT modifiers and the rows
+ * streamed by load() through a bounded buffer. The client library stub reads the local infile in 4 KB parts.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindLoader.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    constexpr const char * g_insertCommand { "INSERT INTO t (id, name) VALUES (:id, :name)" };
+    constexpr size_t       g_streamedRows  { 100000 };
+    constexpr size_t       g_readLength    { 4096 };
+
+    auto loadDataCommand( const char * mysqlCommand ) -> std::string
+    {
+
+        MYSQL mysqlConnection {};
+
+        return FaF::MySqlExtBindLoader( &mysqlConnection, mysqlCommand ).loadDataCommand();
+
+    }
+
+    auto modifiers() -> void
+    {
+
+        const std::string columns = " INTO TABLE t CHARACTER SET binary FIELDS TERMINATED BY '\\t' ESCAPED BY '\\\\' LINES TERMINATED BY '\\n' (id, name)";
+
+        FAF_CHECK( "LOAD DATA LOCAL INFILE 'MySqlExtBindLoader'" + columns == loadDataCommand( g_insertCommand ) );
+        FAF_CHECK( "LOAD DATA LOW_PRIORITY LOCAL INFILE 'MySqlExtBindLoader' IGNORE" + columns ==
+                   loadDataCommand( "INSERT LOW_PRIORITY IGNORE INTO t (id, name) VALUES (:id, :name)" ) );
+        FAF_CHECK( "LOAD DATA LOCAL INFILE 'MySqlExtBindLoader'" + columns ==
+                   loadDataCommand( "insert delayed into t (id, name) values (:id, :name)" ) );
+        FAF_CHECK( "LOAD DATA LOCAL INFILE 'MySqlExtBindLoader'" + columns ==
+                   loadDataCommand( "INSERT HIGH_PRIORITY t (id, name) VALUE (:id, :name)" ) );
+        FAF_CHECK( "LOAD DATA LOW_PRIORITY LOCAL INFILE 'MySqlExtBindLoader' REPLACE" + columns ==
+                   loadDataCommand( "REPLACE LOW_PRIORITY INTO t (id, name) VALUES (:id, :name)" ) );
+
+        // A column called value isn't the VALUES keyword.
+        FAF_CHECK( "LOAD DATA LOCAL INFILE 'MySqlExtBindLoader'" + columns.substr( 0, columns.length() - 10 ) + "(id, value)" ==
+                   loadDataCommand( "INSERT INTO t (id, value) VALUES (:id, :value)" ) );
+
+        FAF_CHECK( FaF::Test::throwsException( []() { loadDataCommand( "INSERT INTO t (id, name) VALUES (:id, :name) ON DUPLICATE KEY UPDATE id = 1" ); } ) );
+
+    }
+
+    /**
+     * Streams g_streamedRows rows - no more than one read buffer and one row may be formatted at any time.
+     */
+    auto streaming() -> void
+    {
+
+        MYSQL                   mysqlConnection {};
+        FaF::MySqlExtBind       extBind( nullptr, g_insertCommand );
+        FaF::MySqlExtBindLoader loader( &mysqlConnection, g_insertCommand );
+
+        int           id         {};
+        std::string   name       ( "a\tb" );
+        unsigned long nameLength = name.length();
+        size_t        maxPending {};
+
+        // The bound values are checked and reset by each add().
+        const auto addRow = [&]( FaF::MySqlExtBindLoader & rowLoader ) {
+
+            extBind.assignBindData( "id",   MYSQL_TYPE_LONG,   &id );
+            extBind.assignBindData( "name", MYSQL_TYPE_STRING, name.data(), &nameLength );
+            rowLoader.add( extBind );
+
+        };
+
+        const unsigned int errorCode = loader.load( [&]( FaF::MySqlExtBindLoader & rowLoader ) {
+
+            maxPending = std::max( maxPending, rowLoader.pendingBytes() );
+
+            if ( g_streamedRows == static_cast<size_t>( id ) ) {
+
+                return false;
+
+            }
+
+            addRow( rowLoader );
+            id++;
+
+            return true;
+
+        } );
+
+        const std::string data = FaF::MySqlClientStub::localInfileData( &mysqlConnection );
+
+        FAF_CHECK( 0 == errorCode );
+        FAF_CHECK( g_streamedRows == static_cast<size_t>( std::count( data.begin(), data.end(), '\n' ) ) );
+        FAF_CHECK( 0 == data.rfind( "0\ta\\tb\n1\ta\\tb\n", 0 ) );
+        FAF_CHECK( std::string::npos != data.find( "\n99999\ta\\tb\n" ) );
+        FAF_CHECK( g_readLength + 32 > maxPending );
+        FAF_CHECK( 0 == loader.pendingRows() && 0 == loader.pendingBytes() );
+
+        // Rows added before are loaded first, execute() still loads them as one part.
+        id--;
+        addRow( loader );
+        FAF_CHECK( 0 == loader.load( []( FaF::MySqlExtBindLoader & ) { return false; } ) );
+        FAF_CHECK( "99999\ta\\tb\n" == FaF::MySqlClientStub::localInfileData( &mysqlConnection ) );
+
+        addRow( loader );
+        addRow( loader );
+        FAF_CHECK( 0 == loader.execute() );
+        FAF_CHECK( "99999\ta\\tb\n99999\ta\\tb\n" == FaF::MySqlClientStub::localInfileData( &mysqlConnection ) );
+
+    }
+
+    /**
+     * An exception of the callback ends the LOAD DATA command and reaches the caller of load().
+     */
+    auto failingCallback() -> void
+    {
+
+        MYSQL                   mysqlConnection {};
+        FaF::MySqlExtBindLoader loader( &mysqlConnection, g_insertCommand );
+
+        bool rethrown {};
+        try {
+
+            loader.load( []( FaF::MySqlExtBindLoader & ) -> bool { throw std::runtime_error( "no more rows" ); } );
+
+        } catch ( const std::runtime_error & ) {
+
+            rethrown = true;
+
+        }
+
+        FAF_CHECK( rethrown );
+        FAF_CHECK( 0 == loader.pendingRows() );
+
+        // A row of another command fails inside the callback as well.
+        FaF::MySqlExtBind otherExtBind( nullptr, "INSERT INTO t (id) VALUES (:id)" );
+        FAF_CHECK( FaF::Test::throwsException( [&]() {
+
+            loader.load( [&otherExtBind]( FaF::MySqlExtBindLoader & rowLoader ) {
+
+                int id {};
+                otherExtBind.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+                rowLoader.add( otherExtBind );
+                return true;
+
+            } );
+
+        } ) );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    modifiers();
+    streaming();
+    failingCallback();
+
+    return FaF::Test::result( "MySqlExtBindLoaderTest" );
+
+}
@@ -0,0 +1,142 @@
+/**
+ * MySqlExtBindMemoryUsageTest.cpp
+ *
+ * Regression tests for MySqlExtBind::memoryUsage(), globalMemoryUsage() and MySqlExtBindStatementCache::memoryUsage()
+ * - run against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <string>
+#include <utility>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindStatementCache.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    auto sameMemoryUsage( const FaF::MemoryUsage & left, const FaF::MemoryUsage & right ) -> bool
+    {
+
+        return left.sqlText == right.sqlText && left.nameTable == right.nameTable && left.bindArrays == right.bindArrays;
+
+    }
+
+    // <left> + <factor> * <right>
+    auto addMemoryUsage( const FaF::MemoryUsage & left, const FaF::MemoryUsage & right, size_t factor = 1 ) -> FaF::MemoryUsage
+    {
+
+        return FaF::MemoryUsage { left.sqlText + factor * right.sqlText, left.nameTable + factor * right.nameTable,
+                                  left.bindArrays + factor * right.bindArrays };
+
+    }
+
+    /**
+     * The parts grow with the command, the names and the bind variables - the bound values aren't copied.
+     */
+    auto instanceUsage() -> void
+    {
+
+        const FaF::MySqlExtBind shortExtBind( nullptr, "SELECT :a" );
+        const FaF::MySqlExtBind longExtBind( nullptr, "SELECT * FROM customers WHERE :customerName = name OR :customerName = alias" );
+        FaF::MySqlExtBind       manyExtBind( nullptr, "SELECT :a, :b, :c, :d" );
+
+        const FaF::MemoryUsage shortUsage = shortExtBind.memoryUsage();
+
+        FAF_CHECK( std::string_view( "SELECT ?" ).length() + 1 == shortUsage.sqlText );
+        FAF_CHECK( shortUsage.sqlText + shortUsage.nameTable + shortUsage.bindArrays == shortUsage.total() );
+
+        FAF_CHECK( longExtBind.adjustedMysqlCommand().length() + 1 == longExtBind.memoryUsage().sqlText );
+        FAF_CHECK( shortUsage.nameTable < longExtBind.memoryUsage().nameTable );
+        FAF_CHECK( shortUsage.bindArrays < longExtBind.memoryUsage().bindArrays );
+        FAF_CHECK( longExtBind.memoryUsage().bindArrays < manyExtBind.memoryUsage().bindArrays );
+
+        const FaF::MemoryUsage manyUsage = manyExtBind.memoryUsage();
+        const std::string      longText( 100000, 'x' );
+        unsigned long          longTextLength { longText.length() };
+
+        for ( const char * bindVariable : { "a", "b", "c", "d" } ) {
+
+            manyExtBind.assignBindData( bindVariable, MYSQL_TYPE_STRING, const_cast<char *>( longText.data() ), &longTextLength );
+
+        }
+
+        FAF_CHECK( sameMemoryUsage( manyUsage, manyExtBind.memoryUsage() ) );
+
+    }
+
+    /**
+     * The global counters follow the instances - a copy adds its arena, a move doesn't, a destruction removes it.
+     */
+    auto globalUsage() -> void
+    {
+
+        const FaF::MemoryUsage initialUsage = FaF::MySqlExtBind::globalMemoryUsage();
+
+        {
+
+            FaF::MySqlExtBind      extBind( nullptr, "INSERT INTO t (id, name) VALUES (:id, :name)" );
+            const FaF::MemoryUsage instanceUsage = extBind.memoryUsage();
+
+            FAF_CHECK( sameMemoryUsage( addMemoryUsage( initialUsage, instanceUsage ), FaF::MySqlExtBind::globalMemoryUsage() ) );
+
+            {
+
+                const FaF::MySqlExtBind copy( extBind );
+                FAF_CHECK( sameMemoryUsage( addMemoryUsage( initialUsage, instanceUsage, 2 ), FaF::MySqlExtBind::globalMemoryUsage() ) );
+
+            }
+
+            FAF_CHECK( sameMemoryUsage( addMemoryUsage( initialUsage, instanceUsage ), FaF::MySqlExtBind::globalMemoryUsage() ) );
+
+            FaF::MySqlExtBind moved( std::move( extBind ) );
+            FAF_CHECK( sameMemoryUsage( FaF::MemoryUsage {}, extBind.memoryUsage() ) );
+            FAF_CHECK( sameMemoryUsage( addMemoryUsage( initialUsage, instanceUsage ), FaF::MySqlExtBind::globalMemoryUsage() ) );
+
+            // The assignment frees the arena of <moved>.
+            moved = FaF::MySqlExtBind( nullptr, "SELECT :a" );
+            FAF_CHECK( sameMemoryUsage( addMemoryUsage( initialUsage, moved.memoryUsage() ), FaF::MySqlExtBind::globalMemoryUsage() ) );
+
+        }
+
+        FAF_CHECK( sameMemoryUsage( initialUsage, FaF::MySqlExtBind::globalMemoryUsage() ) );
+
+    }
+
+    /**
+     * The cache counts the parsed statement and the copy of each thread.
+     */
+    auto cacheUsage( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+
+        FAF_CHECK( 0 == statementCache.memoryUsage().total() );
+
+        FaF::MySqlExtBind & cachedExtBind = statementCache.statement( "SELECT * FROM t WHERE id = :id" );
+        FAF_CHECK( sameMemoryUsage( addMemoryUsage( FaF::MemoryUsage {}, cachedExtBind.memoryUsage(), 2 ), statementCache.memoryUsage() ) );
+
+        statementCache.release( cachedExtBind );
+        FAF_CHECK( 0 == statementCache.memoryUsage().total() );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    instanceUsage();
+    globalUsage();
+    cacheUsage( &mysqlConnection );
+
+    return FaF::Test::result( "MySqlExtBindMemoryUsageTest" );
+
+}
@@ -0,0 +1,227 @@
+/**
+ * MySqlExtBindNonblockingTest.cpp
+ *
+ * Regression tests for the SQL literals of MySqlExtBindRender and the completion order of MySqlExtBindPoller -
+ * run against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <cmath>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <mysqld_error.h>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindNonblocking.h"
+#include "../MySqlExtBindRender.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    auto bindItem( enum_field_types bufferType, const void * buffer, unsigned long bufferLength = 0, bool isUnsigned = false ) -> MYSQL_BIND
+    {
+
+        MYSQL_BIND mysqlBindItem {};
+        mysqlBindItem.buffer_type   = bufferType;
+        mysqlBindItem.buffer        = const_cast<void *>( buffer );
+        mysqlBindItem.buffer_length = bufferLength;
+        mysqlBindItem.is_unsigned   = isUnsigned;
+
+        return mysqlBindItem;
+
+    }
+
+    // The rendered command of <adjustedMysqlCommand> with the one value <mysqlBindItem>.
+    auto renderOne( std::string_view adjustedMysqlCommand, const MYSQL_BIND & mysqlBindItem ) -> std::string
+    {
+
+        std::string mysqlCommand;
+        FaF::MySqlExtBindRender::render( nullptr, adjustedMysqlCommand, &mysqlBindItem, 1, mysqlCommand );
+
+        return mysqlCommand;
+
+    }
+
+    auto literals() -> void
+    {
+
+        bool isNull { true };
+        MYSQL_BIND nullItem = bindItem( MYSQL_TYPE_LONG, &isNull );
+        nullItem.is_null    = &isNull;
+        FAF_CHECK( "SELECT NULL" == renderOne( "SELECT ?", nullItem ) );
+        FAF_CHECK( "SELECT NULL" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_NULL, nullptr ) ) );
+
+        const unsigned char blob [] { 0x00, 0x1F, 0xA0, 0xFF };
+        FAF_CHECK( "SELECT X'001FA0FF'" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_BLOB, blob, sizeof( blob ) ) ) );
+        FAF_CHECK( "SELECT X''" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_BLOB, blob, 0 ) ) );
+
+        const std::string text { std::string( "it's \\ \"quoted\"\n" ) + '\0' };
+        FAF_CHECK( R"(SELECT 'it\'s \\ \"quoted\"\n\0')" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_STRING, text.data(), text.length() ) ) );
+
+        MYSQL_TIME dateTime {};
+        dateTime.year   = 2026;
+        dateTime.month  = 10;
+        dateTime.day    = 17;
+        dateTime.hour   = 8;
+        dateTime.minute = 5;
+        dateTime.second = 9;
+        FAF_CHECK( "SELECT '2026-10-17 08:05:09'" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_DATETIME, &dateTime ) ) );
+        FAF_CHECK( "SELECT '2026-10-17'" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_DATE, &dateTime ) ) );
+
+        dateTime.second_part = 42;
+        FAF_CHECK( "SELECT '2026-10-17 08:05:09.000042'" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_DATETIME, &dateTime ) ) );
+
+        // A TIME value adds its days to the hours.
+        MYSQL_TIME time {};
+        time.neg    = true;
+        time.day    = 2;
+        time.hour   = 3;
+        time.minute = 4;
+        FAF_CHECK( "SELECT '-51:04:00'" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_TIME, &time ) ) );
+
+        const unsigned int       unsignedLong     { 4294967295U };
+        const int                signedLong       { -7 };
+        const unsigned long long unsignedLongLong { 18446744073709551615ULL };
+        const unsigned char      unsignedTiny     { 200 };
+        FAF_CHECK( "SELECT 4294967295" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_LONG, &unsignedLong, 0, true ) ) );
+        FAF_CHECK( "SELECT -7" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_LONG, &signedLong ) ) );
+        FAF_CHECK( "SELECT 18446744073709551615" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_LONGLONG, &unsignedLongLong, 0, true ) ) );
+        FAF_CHECK( "SELECT 200" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_TINY, &unsignedTiny, 0, true ) ) );
+        FAF_CHECK( "SELECT -56" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_TINY, &unsignedTiny ) ) );
+
+        // Without exponent the literal would be a DECIMAL.
+        const double number { 0.5 };
+        FAF_CHECK( "SELECT 0.5E0" == renderOne( "SELECT ?", bindItem( MYSQL_TYPE_DOUBLE, &number ) ) );
+
+        const double notANumber { std::nan( "" ) };
+        FAF_CHECK( FaF::Test::throwsException( [&notANumber]() { renderOne( "SELECT ?", bindItem( MYSQL_TYPE_DOUBLE, &notANumber ) ); } ) );
+
+    }
+
+    auto placeholders() -> void
+    {
+
+        const int values [] { 1, 2 };
+        const MYSQL_BIND mysqlBindArray [] { bindItem( MYSQL_TYPE_LONG, &values [0] ), bindItem( MYSQL_TYPE_LONG, &values [1] ) };
+        std::string mysqlCommand;
+
+        // A '?' in quotes or comments is no placeholder.
+        FaF::MySqlExtBindRender::render( nullptr, "SELECT '?', \"?\", `?` /* ? */ FROM t WHERE a = ? AND b = ? -- ?\n", mysqlBindArray, 2,
+                                         mysqlCommand );
+        FAF_CHECK( "SELECT '?', \"?\", `?` /* ? */ FROM t WHERE a = 1 AND b = 2 -- ?\n" == mysqlCommand );
+
+        FAF_CHECK( FaF::Test::throwsException( [&]() { FaF::MySqlExtBindRender::render( nullptr, "SELECT ?", mysqlBindArray, 2, mysqlCommand ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [&]() { FaF::MySqlExtBindRender::render( nullptr, "SELECT ?, ?, ?", mysqlBindArray, 2, mysqlCommand ); } ) );
+
+        // The bound MySqlExtBind renders its adjusted command.
+        FaF::MySqlExtBind extBind( nullptr, "SELECT * FROM t WHERE name = :name AND id = :id" );
+        const char        name [] { "O'Brien" };
+        int               id { 3 };
+        unsigned long     nameLength { sizeof( name ) - 1 };
+
+        extBind.assignBindData( "name", MYSQL_TYPE_STRING, const_cast<char *>( name ), &nameLength );
+        extBind.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FaF::MySqlExtBindRender::render( nullptr, extBind, mysqlCommand );
+        FAF_CHECK( R"(SELECT * FROM t WHERE name = 'O\'Brien' AND id = 3)" == mysqlCommand );
+
+    }
+
+    /**
+     * Each connection completes its queries in the order of submit() - also the ones submitted by a completion.
+     */
+    auto completionOrder() -> void
+    {
+
+        int  sockets [2][2];
+        MYSQL firstConnection {};
+        MYSQL secondConnection {};
+
+        // epoll needs a socket per connection - the stub doesn't read from it.
+        FAF_CHECK( 0 == socketpair( AF_UNIX, SOCK_STREAM, 0, sockets [0] ) );
+        FAF_CHECK( 0 == socketpair( AF_UNIX, SOCK_STREAM, 0, sockets [1] ) );
+        firstConnection.net.fd  = sockets [0][0];
+        secondConnection.net.fd = sockets [1][0];
+
+        FaF::MySqlClientStub::setQueryResult( []( std::string_view mysqlCommand ) -> unsigned int {
+
+            return "SELECT 'a2'" == mysqlCommand ? ER_NO_SUCH_TABLE : 0;
+
+        } );
+
+        std::vector<std::pair<std::string, unsigned int>> firstCompletions;
+        std::vector<std::string>                          secondCompletions;
+
+        FaF::MySqlExtBindPoller poller;
+
+        auto recordFirst = [&firstCompletions]( const char * query ) {
+
+            return [&firstCompletions, query]( FaF::QueryResult & queryResult ) { firstCompletions.emplace_back( query, queryResult.errorCode ); };
+
+        };
+        auto recordSecond = [&secondCompletions]( const char * query ) {
+
+            return [&secondCompletions, query]( FaF::QueryResult & ) { secondCompletions.emplace_back( query ); };
+
+        };
+
+        poller.submit( &firstConnection, "SELECT 'a1'", [&]( FaF::QueryResult & queryResult ) {
+
+            recordFirst( "a1" )( queryResult );
+            poller.submit( &firstConnection, "SELECT 'a4'", recordFirst( "a4" ) );
+
+        } );
+        poller.submit( &secondConnection, "SELECT 'b1'", recordSecond( "b1" ) );
+        poller.submit( &firstConnection, "SELECT 'a2'", recordFirst( "a2" ) );
+        poller.submit( &firstConnection, "SELECT 'a3'", recordFirst( "a3" ) );
+        poller.submit( &secondConnection, "SELECT 'b2'", recordSecond( "b2" ) );
+
+        FAF_CHECK( 5 == poller.pending() );
+
+        size_t completedQueries {};
+        for ( int round = 0; round < 100 && 0 < poller.pending(); round++ ) {
+
+            completedQueries += poller.poll( 10 );
+
+        }
+
+        FAF_CHECK( 6 == completedQueries );
+        FAF_CHECK( ( std::vector<std::pair<std::string, unsigned int>> { { "a1", 0 }, { "a2", ER_NO_SUCH_TABLE }, { "a3", 0 }, { "a4", 0 } } )
+                   == firstCompletions );
+        FAF_CHECK( ( std::vector<std::string> { "b1", "b2" } ) == secondCompletions );
+
+        poller.removeConnection( &firstConnection );
+        poller.removeConnection( &secondConnection );
+        FaF::MySqlClientStub::setQueryResult( {} );
+
+        for ( auto & socketPair : sockets ) {
+
+            close( socketPair [0] );
+            close( socketPair [1] );
+
+        }
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    literals();
+    placeholders();
+    completionOrder();
+
+    return FaF::Test::result( "MySqlExtBindNonblockingTest" );
+
+}
@@ -0,0 +1,190 @@
+/**
+ * MySqlExtBindParameterSetsTest.cpp
+ *
+ * Regression tests for the order and the error reporting of MySqlExtBindParameterSets - run against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <mysqld_error.h>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindParameterSets.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    using Row = struct Row
+    {
+
+            int     id {};
+
+    };
+
+    constexpr const char * g_insertCommand { "INSERT INTO t (id) VALUES (:id)" };
+
+    // The ids in the order of their execution - written by the I/O thread, read after flush().
+    std::vector<int> g_executedIds;
+
+    auto bindRow( FaF::MySqlExtBind & fafExtBind, Row & row ) -> void
+    {
+
+        fafExtBind.assignBindData( "id", MYSQL_TYPE_LONG, &row.id );
+
+    }
+
+    // Records the executed ids - the set with <failedId> fails with <errorCode>.
+    auto recordExecutions( int failedId, unsigned int errorCode ) -> void
+    {
+
+        g_executedIds.clear();
+
+        FaF::MySqlClientStub::setExecuteResult( [failedId, errorCode]( MYSQL_STMT * mysqlStatement ) -> unsigned int {
+
+            const int id = *static_cast<const int *>( FaF::MySqlClientStub::boundParameters( mysqlStatement ).front().buffer );
+            g_executedIds.push_back( id );
+
+            return failedId == id ? errorCode : 0;
+
+        } );
+
+    }
+
+    template < typename ParameterSets >
+    auto submitIds( ParameterSets & parameterSets, int firstId, int lastId ) -> void
+    {
+
+        for ( int id = firstId; id <= lastId; id++ ) {
+
+            parameterSets.parameterSet().id = id;
+            parameterSets.submit();
+
+        }
+
+    }
+
+    /**
+     * The sets are executed in the order of submit() - also when more sets are submitted than there are slots.
+     */
+    auto submitOrder( MYSQL * mysqlConnection ) -> void
+    {
+
+        MYSQL_STMT *     mysqlStatement = mysql_stmt_init( mysqlConnection );
+        std::vector<int> completedIds;
+
+        {
+
+            FaF::MySqlExtBindParameterSets<Row> parameterSets( mysqlStatement, g_insertCommand, bindRow, 3,
+                [&completedIds]( Row & row, unsigned int errorCode ) { completedIds.push_back( 0 == errorCode ? row.id : -row.id ); } );
+
+            FAF_CHECK( 0 == parameterSets.prepareStatement() );
+
+            recordExecutions( 0, 0 );
+            submitIds( parameterSets, 1, 10 );
+
+            FAF_CHECK( 0 == parameterSets.flush() );
+            FAF_CHECK( ( std::vector<int> { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 } ) == g_executedIds );
+            FAF_CHECK( g_executedIds == completedIds );
+
+            // The destructor executes the sets which haven't been flushed.
+            submitIds( parameterSets, 11, 12 );
+
+        }
+
+        FAF_CHECK( ( std::vector<int> { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12 } ) == completedIds );
+
+        mysql_stmt_close( mysqlStatement );
+
+    }
+
+    /**
+     * flush() reports the first failed set - also without a completion.
+     */
+    auto errorReporting( MYSQL * mysqlConnection ) -> void
+    {
+
+        MYSQL_STMT * mysqlStatement = mysql_stmt_init( mysqlConnection );
+
+        {
+
+            FaF::MySqlExtBindParameterSets<Row> parameterSets( mysqlStatement, g_insertCommand, bindRow );
+            parameterSets.prepareStatement();
+
+            recordExecutions( 3, ER_DUP_ENTRY );
+            submitIds( parameterSets, 1, 5 );
+
+            FAF_CHECK( ER_DUP_ENTRY == parameterSets.flush() );
+            FAF_CHECK( 5 == g_executedIds.size() );
+
+            // The error has been reported - the next flush() only covers the following sets.
+            submitIds( parameterSets, 4, 5 );
+            FAF_CHECK( 0 == parameterSets.flush() );
+
+        }
+
+        mysql_stmt_close( mysqlStatement );
+
+    }
+
+    /**
+     * An exception of the completion doesn't end the I/O thread - flush() rethrows it.
+     */
+    auto completionException( MYSQL * mysqlConnection ) -> void
+    {
+
+        MYSQL_STMT * mysqlStatement = mysql_stmt_init( mysqlConnection );
+
+        {
+
+            FaF::MySqlExtBindParameterSets<Row> parameterSets( mysqlStatement, g_insertCommand, bindRow, 2,
+                []( Row & row, unsigned int ) { if ( 2 == row.id ) { throw std::runtime_error( "completion" ); } } );
+            parameterSets.prepareStatement();
+
+            recordExecutions( 0, 0 );
+            submitIds( parameterSets, 1, 4 );
+
+            bool rethrown {};
+            try {
+
+                parameterSets.flush();
+
+            } catch ( const std::runtime_error & ) {
+
+                rethrown = true;
+
+            }
+
+            FAF_CHECK( rethrown );
+            FAF_CHECK( ( std::vector<int> { 1, 2, 3, 4 } ) == g_executedIds );
+            FAF_CHECK( 0 == parameterSets.flush() );
+
+        }
+
+        mysql_stmt_close( mysqlStatement );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    submitOrder( &mysqlConnection );
+    errorReporting( &mysqlConnection );
+    completionException( &mysqlConnection );
+
+    FaF::MySqlClientStub::setExecuteResult( {} );
+
+    return FaF::Test::result( "MySqlExtBindParameterSetsTest" );
+
+}
@@ -0,0 +1,170 @@
+/**
+ * MySqlExtBindPipelineTest.cpp
+ *
+ * Regression tests for MySqlExtBindPipeline against a peer on a socket pair which answers each request before it
+ * reads the next one - like the server, which blocks writing responses nobody reads.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <errmsg.h>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindPipeline.h"
+
+namespace
+{
+
+    using Bytes    = std::vector<unsigned char>;
+    using Protocol = FaF::MySqlExtBindProtocol;
+
+    constexpr size_t g_requestsCount  { 2000 };
+    constexpr int    g_socketBuffer   { 4096 };
+    constexpr size_t g_messageLength  { 1000 };
+
+    /**
+     * Answers <answeredRequests> requests - odd ones with OK, even ones with a long ERR - then closes the socket.
+     *
+     * @param socket
+     * @param answeredRequests
+     */
+    auto answerRequests( int socket, size_t answeredRequests ) -> void
+    {
+
+        Bytes request;
+
+        for ( size_t index = 0; index < answeredRequests && Protocol::readPacket( socket, request ); index++ ) {
+
+            Bytes payload;
+
+            if ( 0 == index % 2 ) {
+
+                payload = { 0xFF, 0x26, 0x04, '#', '2', '3', '0', '0', '0' };
+                payload.insert( payload.end(), g_messageLength, 'e' );
+
+            } else {
+
+                payload = { 0x00, 0x01, 0x02, 0x02, 0x00, 0x00, 0x00 };
+
+            }
+
+            Bytes packet;
+            Protocol::appendInteger( packet, payload.size(), 3 );
+            packet.push_back( 1 );
+            packet.insert( packet.end(), payload.begin(), payload.end() );
+
+            Protocol::writePacket( socket, packet );
+
+        }
+
+        close( socket );
+
+    }
+
+    /**
+     * Sends g_requestsCount requests in one flush to a peer which answers <answeredRequests> of them.
+     *
+     * @param answeredRequests
+     * @return
+     */
+    auto runPipeline( size_t answeredRequests ) -> std::vector<FaF::ExecuteResult>
+    {
+
+        int sockets [2];
+        FAF_CHECK( 0 == socketpair( AF_UNIX, SOCK_STREAM, 0, sockets ) );
+
+        for ( const int socket : sockets ) {
+
+            setsockopt( socket, SOL_SOCKET, SO_SNDBUF, &g_socketBuffer, sizeof( g_socketBuffer ) );
+            setsockopt( socket, SOL_SOCKET, SO_RCVBUF, &g_socketBuffer, sizeof( g_socketBuffer ) );
+
+        }
+
+        std::thread peerThread( answerRequests, sockets [1], answeredRequests );
+
+        MYSQL      mysqlConnection {};
+        MYSQL_STMT mysqlStatement  {};
+
+        mysqlConnection.net.fd     = sockets [0];
+        mysqlStatement.mysql       = &mysqlConnection;
+        mysqlStatement.stmt_id     = 1;
+        mysqlStatement.param_count = 1;
+
+        FaF::MySqlExtBind          extBind( nullptr, "INSERT INTO t (name) VALUES (:name)" );
+        FaF::MySqlExtBindPipeline  pipeline( &mysqlConnection, g_requestsCount );
+        std::string                name( 200, 'n' );
+        unsigned long              nameLength = name.length();
+
+        for ( size_t index = 0; index < g_requestsCount; index++ ) {
+
+            extBind.assignBindData( "name", MYSQL_TYPE_STRING, name.data(), &nameLength );
+            pipeline.add( &mysqlStatement, extBind );
+
+        }
+
+        std::vector<FaF::ExecuteResult> results = pipeline.finish();
+
+        peerThread.join();
+        close( sockets [0] );
+
+        return results;
+
+    }
+
+    auto fullBuffers() -> void
+    {
+
+        const std::vector<FaF::ExecuteResult> results = runPipeline( g_requestsCount );
+
+        FAF_CHECK( g_requestsCount == results.size() );
+
+        size_t errors  {};
+        size_t inserts {};
+        for ( size_t index = 0; index < results.size(); index++ ) {
+
+            errors  += 0 == index % 2 && 1062 == results [index].errorCode && g_messageLength == results [index].errorMessage.length() ? 1 : 0;
+            inserts += 1 == index % 2 && 0 == results [index].errorCode && 2 == results [index].lastInsertId ? 1 : 0;
+
+        }
+
+        FAF_CHECK( g_requestsCount / 2 == errors );
+        FAF_CHECK( g_requestsCount / 2 == inserts );
+
+    }
+
+    auto lostConnection() -> void
+    {
+
+        const std::vector<FaF::ExecuteResult> results = runPipeline( 11 );
+
+        FAF_CHECK( g_requestsCount == results.size() );
+        FAF_CHECK( 0 == results [9].errorCode );
+        FAF_CHECK( 1062 == results [10].errorCode );
+        FAF_CHECK( CR_SERVER_LOST == results [11].errorCode );
+        FAF_CHECK( CR_SERVER_LOST == results.back().errorCode );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    // A deadlock fails the test instead of hanging it.
+    alarm( 60 );
+
+    fullBuffers();
+    lostConnection();
+
+    return FaF::Test::result( "MySqlExtBindPipelineTest" );
+
+}
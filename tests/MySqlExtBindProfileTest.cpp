@@ -0,0 +1,152 @@
+/**
+ * MySqlExtBindProfileTest.cpp
+ *
+ * Regression tests for the profile file of MySqlExtBindProfile and the warm-up of the statement caches - run
+ * against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindProfile.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    constexpr const char * g_profilePath { "/tmp/MySqlExtBindProfileTest.profile" };
+
+    auto sameTemplateUses( const std::vector<FaF::TemplateUse> & left, const std::vector<FaF::TemplateUse> & right ) -> bool
+    {
+
+        if ( left.size() != right.size() ) {
+
+            return false;
+
+        }
+
+        for ( size_t index = 0; index < left.size(); index++ ) {
+
+            if ( left [index].mysqlCommand != right [index].mysqlCommand || left [index].executions != right [index].executions ) {
+
+                return false;
+
+            }
+
+        }
+
+        return true;
+
+    }
+
+    auto writeFile( const std::string & content ) -> void
+    {
+
+        std::ofstream( g_profilePath, std::ios::binary | std::ios::trunc ) << content;
+
+    }
+
+    /**
+     * save() and load() return the same commands, the most executed first - also commands with line breaks.
+     */
+    auto roundTrip() -> void
+    {
+
+        const std::vector<FaF::TemplateUse> templateUses {
+            { "SELECT * FROM t WHERE id = :id", 7 },
+            { "UPDATE t\nSET name = :name\nWHERE id = :id", 42 },
+            { "DELETE FROM t WHERE id = :id", 7 }
+        };
+
+        FAF_CHECK( FaF::MySqlExtBindProfile::save( g_profilePath, templateUses ) );
+
+        const std::vector<FaF::TemplateUse> expectedTemplateUses { templateUses [1], templateUses [2], templateUses [0] };
+        FAF_CHECK( sameTemplateUses( expectedTemplateUses, FaF::MySqlExtBindProfile::load( g_profilePath ) ) );
+        FAF_CHECK( sameTemplateUses( { templateUses [1] }, FaF::MySqlExtBindProfile::load( g_profilePath, 1 ) ) );
+
+        FAF_CHECK( FaF::MySqlExtBindProfile::save( g_profilePath, {} ) );
+        FAF_CHECK( FaF::MySqlExtBindProfile::load( g_profilePath ).empty() );
+
+    }
+
+    /**
+     * A missing or damaged profile is empty - the statements are prepared on demand.
+     */
+    auto damagedProfile() -> void
+    {
+
+        std::remove( g_profilePath );
+        FAF_CHECK( FaF::MySqlExtBindProfile::load( g_profilePath ).empty() );
+
+        writeFile( "MySqlExtBindProfile 2\n1 8\nSELECT 1\n" );
+        FAF_CHECK( FaF::MySqlExtBindProfile::load( g_profilePath ).empty() );
+
+        // The command is shorter than its length.
+        writeFile( "MySqlExtBindProfile 1\n3 30\nSELECT 1\n" );
+        FAF_CHECK( FaF::MySqlExtBindProfile::load( g_profilePath ).empty() );
+
+        // A damaged length larger than the file - nothing is allocated for it.
+        writeFile( "MySqlExtBindProfile 1\n3 18446744073709551615\nSELECT 1\n" );
+        FAF_CHECK( FaF::MySqlExtBindProfile::load( g_profilePath ).empty() );
+        writeFile( "MySqlExtBindProfile 1\n3 4000000000000\nSELECT 1\n" );
+        FAF_CHECK( FaF::MySqlExtBindProfile::load( g_profilePath ).empty() );
+
+        writeFile( "MySqlExtBindProfile 1\n3 8\nSELECT 1\nnot a number\n" );
+        FAF_CHECK( FaF::MySqlExtBindProfile::load( g_profilePath ).empty() );
+
+        writeFile( "MySqlExtBindProfile 1\n3 8\nSELECT 1\n" );
+        FAF_CHECK( sameTemplateUses( { { "SELECT 1", 3 } }, FaF::MySqlExtBindProfile::load( g_profilePath ) ) );
+
+    }
+
+    /**
+     * record() sums up the executions of all caches, warmUp() prepares the commands on each of them.
+     */
+    auto recordAndWarmUp( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache firstCache( mysqlConnection );
+        FaF::MySqlExtBindStatementCache secondCache( mysqlConnection );
+
+        firstCache.warmUp( { { "SELECT * FROM a WHERE id = :id", 5 } } );
+        secondCache.warmUp( { { "SELECT * FROM a WHERE id = :id", 3 }, { "SELECT * FROM b WHERE id = :id", 10 } } );
+
+        const std::vector<FaF::TemplateUse> recordedTemplateUses = FaF::MySqlExtBindProfile::record( { &firstCache, &secondCache } );
+        FAF_CHECK( sameTemplateUses( { { "SELECT * FROM b WHERE id = :id", 10 }, { "SELECT * FROM a WHERE id = :id", 8 } }, recordedTemplateUses ) );
+
+        FAF_CHECK( FaF::MySqlExtBindProfile::save( g_profilePath, recordedTemplateUses ) );
+
+        FaF::MySqlExtBindStatementCache firstRestartedCache( mysqlConnection );
+        FaF::MySqlExtBindStatementCache secondRestartedCache( mysqlConnection );
+
+        FAF_CHECK( 4 == FaF::MySqlExtBindProfile::warmUp( FaF::MySqlExtBindProfile::load( g_profilePath ),
+                                                           { &firstRestartedCache, &secondRestartedCache } ) );
+        FAF_CHECK( 2 == firstRestartedCache.size() );
+        FAF_CHECK( 2 == secondRestartedCache.size() );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    roundTrip();
+    damagedProfile();
+    recordAndWarmUp( &mysqlConnection );
+
+    std::remove( g_profilePath );
+
+    return FaF::Test::result( "MySqlExtBindProfileTest" );
+
+}
@@ -0,0 +1,181 @@
+/**
+ * MySqlExtBindProtocolClientTest.cpp
+ *
+ * Compares the COM_STMT_EXECUTE packets of MySqlExtBindProtocol byte for byte with the packets libmysqlclient sends
+ * for the same bind array - the stand-in server records them. Needs the real libmysqlclient, not the stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindProtocol.h"
+#include "../stub/MySqlStandInServer.h"
+
+namespace
+{
+
+    using Bytes = std::vector<unsigned char>;
+
+    constexpr const char * g_socketPath { "/tmp/MySqlExtBindProtocolClientTest.sock" };
+
+    std::mutex  g_mutex;
+    Bytes       g_executePayload;
+
+    auto bindItem( enum_field_types bufferType, void * buffer, unsigned long * length = nullptr, bool * isNull = nullptr,
+                   bool isUnsigned = false ) -> MYSQL_BIND
+    {
+
+        MYSQL_BIND mysqlBindItem {};
+
+        mysqlBindItem.buffer_type = bufferType;
+        mysqlBindItem.buffer      = buffer;
+        mysqlBindItem.length      = length;
+        mysqlBindItem.is_null     = isNull;
+        mysqlBindItem.is_unsigned = isUnsigned;
+
+        return mysqlBindItem;
+
+    }
+
+    /**
+     * Executes <mysqlBindArray> with libmysqlclient and compares the recorded payload with the encoded one.
+     * The first execution after binding sends the types, like MySqlExtBindProtocol always does.
+     *
+     * @param mysqlConnection
+     * @param mysqlBindArray
+     * @param bindVariablesCount
+     */
+    auto compareExecute( MYSQL * mysqlConnection, MYSQL_BIND * mysqlBindArray, u_int bindVariablesCount ) -> void
+    {
+
+        std::string mysqlCommand( "INSERT INTO t VALUES (?" );
+        for ( u_int index = 1; index < bindVariablesCount; index++ ) {
+
+            mysqlCommand.append( ", ?" );
+
+        }
+        mysqlCommand.append( ")" );
+
+        MYSQL_STMT * mysqlStatement = mysql_stmt_init( mysqlConnection );
+        if ( false == FAF_CHECK( nullptr != mysqlStatement ) ) {
+
+            return;
+
+        }
+
+        FAF_CHECK( 0 == mysql_stmt_prepare( mysqlStatement, mysqlCommand.c_str(), mysqlCommand.length() ) );
+        FAF_CHECK( false == mysql_stmt_bind_param( mysqlStatement, mysqlBindArray ) );
+        FAF_CHECK( 0 == mysql_stmt_execute( mysqlStatement ) );
+
+        Bytes packet;
+        FaF::MySqlExtBindProtocol::encodeExecute( packet, mysqlStatement->stmt_id, mysqlBindArray, bindVariablesCount,
+                                                  0 != ( mysqlConnection->client_flag & CLIENT_QUERY_ATTRIBUTES ) );
+
+        const std::lock_guard<std::mutex> lock( g_mutex );
+        FAF_CHECK( Bytes( packet.begin() + 4, packet.end() ) == g_executePayload );
+
+        mysql_stmt_close( mysqlStatement );
+
+    }
+
+    auto compareTypes( MYSQL * mysqlConnection ) -> void
+    {
+
+        signed char        tinyValue      { -5 };
+        unsigned short     shortValue     { 65535 };
+        int                longValue      { -7 };
+        unsigned long long longLongValue  { 0xFFFFFFFFFFFFFFFFULL };
+        float              floatValue     { 0.25f };
+        double             doubleValue    { -1.5 };
+        std::string        stringValue    ( 300, 's' );
+        unsigned long      stringLength   = stringValue.length();
+        char               decimalValue [] { "12.50" };
+        unsigned long      decimalLength  { 5 };
+        bool               isNull         { true };
+
+        MYSQL_TIME dateTime     { 2026, 10, 17, 12, 34, 56, 0,      false, MYSQL_TIMESTAMP_DATETIME, 0 };
+        MYSQL_TIME microseconds { 2026, 10, 17, 12, 34, 56, 123456, false, MYSQL_TIMESTAMP_DATETIME, 0 };
+        MYSQL_TIME date         { 2026, 10, 17, 0,  0,  0,  0,      false, MYSQL_TIMESTAMP_DATE,     0 };
+        MYSQL_TIME time         { 0,    0,  1,  2,  3,  4,  5,      true,  MYSQL_TIMESTAMP_TIME,     0 };
+        MYSQL_TIME zeroTime     {};
+
+        MYSQL_BIND mysqlBindArray [] {
+            bindItem( MYSQL_TYPE_TINY,       &tinyValue ),
+            bindItem( MYSQL_TYPE_SHORT,      &shortValue, nullptr, nullptr, true ),
+            bindItem( MYSQL_TYPE_LONG,       &longValue ),
+            bindItem( MYSQL_TYPE_LONG,       &longValue, nullptr, &isNull ),
+            bindItem( MYSQL_TYPE_LONGLONG,   &longLongValue, nullptr, nullptr, true ),
+            bindItem( MYSQL_TYPE_FLOAT,      &floatValue ),
+            bindItem( MYSQL_TYPE_DOUBLE,     &doubleValue ),
+            bindItem( MYSQL_TYPE_STRING,     stringValue.data(), &stringLength ),
+            bindItem( MYSQL_TYPE_NEWDECIMAL, decimalValue, &decimalLength ),
+            bindItem( MYSQL_TYPE_BLOB,       stringValue.data(), &stringLength, &isNull ),
+            bindItem( MYSQL_TYPE_DATETIME,   &dateTime ),
+            bindItem( MYSQL_TYPE_DATETIME,   &microseconds ),
+            bindItem( MYSQL_TYPE_DATE,       &date ),
+            bindItem( MYSQL_TYPE_TIME,       &time ),
+            bindItem( MYSQL_TYPE_TIME,       &zeroTime )
+        };
+
+        compareExecute( mysqlConnection, mysqlBindArray, 15 );
+
+        // One parameter - the NULL bitmap has one byte, all NULL.
+        compareExecute( mysqlConnection, &mysqlBindArray [3], 1 );
+
+    }
+
+    auto connect() -> MYSQL *
+    {
+
+        MYSQL * mysqlConnection = mysql_init( nullptr );
+
+        const unsigned int protocol = MYSQL_PROTOCOL_SOCKET;
+        mysql_options( mysqlConnection, MYSQL_OPT_PROTOCOL, &protocol );
+
+        if ( nullptr == mysql_real_connect( mysqlConnection, "localhost", "test", "", nullptr, 0, g_socketPath, 0 ) ) {
+
+            std::fprintf( stderr, "%s\n", mysql_error( mysqlConnection ) );
+            mysql_close( mysqlConnection );
+            return nullptr;
+
+        }
+
+        return mysqlConnection;
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    FaF::MySqlStandInServer standInServer( g_socketPath, []( const FaF::StandInCommand & standInCommand, FaF::StandInReply & ) {
+
+        if ( COM_STMT_EXECUTE == standInCommand.code ) {
+
+            const std::lock_guard<std::mutex> lock( g_mutex );
+            g_executePayload = standInCommand.payload;
+
+        }
+
+    } );
+
+    // The stand-in server offers CLIENT_QUERY_ATTRIBUTES - libmysqlclient 8.0.23 and later uses it.
+    MYSQL * mysqlConnection = connect();
+    if ( FAF_CHECK( nullptr != mysqlConnection ) ) {
+
+        compareTypes( mysqlConnection );
+        mysql_close( mysqlConnection );
+
+    }
+
+    return FaF::Test::result( "MySqlExtBindProtocolClientTest" );
+
+}
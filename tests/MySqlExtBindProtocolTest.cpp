@@ -0,0 +1,297 @@
+/**
+ * MySqlExtBindProtocolTest.cpp
+ *
+ * Regression tests for the COM_STMT_EXECUTE encoding and the response parsing of MySqlExtBindProtocol. The expected
+ * bytes are written out by hand from the protocol description - the direct executor talks to a socket pair.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <string>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include <errmsg.h>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindProtocol.h"
+
+namespace
+{
+
+    using Bytes    = std::vector<unsigned char>;
+    using Protocol = FaF::MySqlExtBindProtocol;
+
+    auto bindItem( enum_field_types bufferType, const void * buffer, unsigned long * length = nullptr, bool * isNull = nullptr,
+                   bool isUnsigned = false ) -> MYSQL_BIND
+    {
+
+        MYSQL_BIND mysqlBindItem {};
+
+        mysqlBindItem.buffer_type = bufferType;
+        mysqlBindItem.buffer      = const_cast<void *>( buffer );
+        mysqlBindItem.length      = length;
+        mysqlBindItem.is_null     = isNull;
+        mysqlBindItem.is_unsigned = isUnsigned;
+
+        return mysqlBindItem;
+
+    }
+
+    auto lengthEncoded() -> void
+    {
+
+        for ( const unsigned long long value : { 0ULL, 250ULL, 251ULL, 0xFFFFULL, 0x10000ULL, 0xFFFFFFULL, 0x1000000ULL, ~0ULL } ) {
+
+            Bytes packet;
+            Protocol::appendLengthEncoded( packet, value );
+
+            const unsigned char * position = packet.data();
+            unsigned long long    readValue {};
+
+            FAF_CHECK( Protocol::readLengthEncoded( position, packet.data() + packet.size(), readValue ) );
+            FAF_CHECK( value == readValue );
+            FAF_CHECK( packet.data() + packet.size() == position );
+
+            // A truncated integer is not read and the position stays.
+            position = packet.data();
+            FAF_CHECK( false == Protocol::readLengthEncoded( position, packet.data() + packet.size() - 1, readValue ) );
+            FAF_CHECK( packet.data() == position );
+
+        }
+
+        Bytes packet;
+        Protocol::appendLengthEncoded( packet, 300 );
+        FAF_CHECK( ( Bytes { 0xFC, 0x2C, 0x01 } ) == packet );
+
+    }
+
+    auto encodeTypes() -> void
+    {
+
+        int           longValue     { 7 };
+        unsigned char tinyValue     { 200 };
+        long long     longLongValue { -2 };
+        double        doubleValue   { 1.5 };
+        char          stringValue [] { "abc" };
+        unsigned long stringLength  { 3 };
+        bool          isNull        { true };
+
+        MYSQL_TIME dateTime { 2026, 10, 17, 12, 34, 56, 0, false, MYSQL_TIMESTAMP_DATETIME, 0 };
+        MYSQL_TIME date     { 2026, 10, 17, 0,  0,  0,  0, false, MYSQL_TIMESTAMP_DATE,     0 };
+        MYSQL_TIME time     { 0,    0,  1,  2,  3,  4,  5, true,  MYSQL_TIMESTAMP_TIME,     0 };
+
+        const MYSQL_BIND mysqlBindArray [] {
+            bindItem( MYSQL_TYPE_LONG,     &longValue ),
+            bindItem( MYSQL_TYPE_LONG,     &longValue, nullptr, &isNull ),
+            bindItem( MYSQL_TYPE_TINY,     &tinyValue, nullptr, nullptr, true ),
+            bindItem( MYSQL_TYPE_LONGLONG, &longLongValue ),
+            bindItem( MYSQL_TYPE_DOUBLE,   &doubleValue ),
+            bindItem( MYSQL_TYPE_STRING,   stringValue, &stringLength ),
+            bindItem( MYSQL_TYPE_DATETIME, &dateTime ),
+            bindItem( MYSQL_TYPE_DATE,     &date ),
+            bindItem( MYSQL_TYPE_TIME,     &time ),
+            bindItem( MYSQL_TYPE_STRING,   stringValue, &stringLength, &isNull )
+        };
+
+        Bytes packet;
+        Protocol::encodeExecute( packet, 0x01020304, mysqlBindArray, 10, false );
+
+        const Bytes expected {
+            0x54, 0x00, 0x00, 0x00,                             // header - 84 bytes, sequence 0
+            0x17, 0x04, 0x03, 0x02, 0x01,                       // COM_STMT_EXECUTE, statement id
+            0x00, 0x01, 0x00, 0x00, 0x00,                       // flags, iteration count
+            0x02, 0x02,                                         // NULL bitmap - parameters 1 and 9
+            0x01,                                               // new params bound
+            0x03, 0x00,  0x03, 0x00,  0x01, 0x80,  0x08, 0x00,  0x05, 0x00,
+            0xFE, 0x00,  0x0C, 0x00,  0x0A, 0x00,  0x0B, 0x00,  0xFE, 0x00,
+            0x07, 0x00, 0x00, 0x00,                             // LONG 7
+            0xC8,                                               // TINY UNSIGNED 200
+            0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,     // LONGLONG -2
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F,     // DOUBLE 1.5
+            0x03, 'a', 'b', 'c',                                // STRING
+            0x07, 0xEA, 0x07, 0x0A, 0x11, 0x0C, 0x22, 0x38,     // DATETIME 2026-10-17 12:34:56
+            0x04, 0xEA, 0x07, 0x0A, 0x11,                       // DATE 2026-10-17
+            0x0C, 0x01, 0x01, 0x00, 0x00, 0x00, 0x02, 0x03, 0x04, 0x05, 0x00, 0x00, 0x00  // TIME -1 02:03:04.000005
+        };
+
+        FAF_CHECK( expected == packet );
+
+        // The zero values have the short forms.
+        MYSQL_TIME       zeroTime {};
+        const MYSQL_BIND zeroBindArray [] { bindItem( MYSQL_TYPE_DATETIME, &zeroTime ), bindItem( MYSQL_TYPE_TIME, &zeroTime ) };
+
+        packet.clear();
+        Protocol::encodeExecute( packet, 1, zeroBindArray, 2, false );
+        FAF_CHECK( ( Bytes { 0x12, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+                             0x00, 0x01, 0x0C, 0x00, 0x0B, 0x00, 0x00, 0x00 } ) == packet );
+
+    }
+
+    auto encodeQueryAttributes() -> void
+    {
+
+        int              longValue { 7 };
+        const MYSQL_BIND mysqlBindItem = bindItem( MYSQL_TYPE_LONG, &longValue );
+
+        Bytes packet;
+        Protocol::encodeExecute( packet, 1, &mysqlBindItem, 1, true );
+
+        // PARAMETER_COUNT_AVAILABLE, the parameter count and an empty name after the type.
+        FAF_CHECK( ( Bytes { 0x14, 0x00, 0x00, 0x00, 0x17, 0x01, 0x00, 0x00, 0x00, 0x08, 0x01, 0x00, 0x00, 0x00,
+                             0x01, 0x00, 0x01, 0x03, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00 } ) == packet );
+
+        // Without parameters there is neither a NULL bitmap nor types - packets are appended.
+        Protocol::encodeExecute( packet, 2, nullptr, 0, false );
+        FAF_CHECK( 24 + 14 == packet.size() );
+        FAF_CHECK( ( Bytes { 0x0A, 0x00, 0x00, 0x00, 0x17, 0x02, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00 } )
+                   == Bytes( packet.begin() + 24, packet.end() ) );
+
+    }
+
+    auto splitPackets() -> void
+    {
+
+        // 18 bytes besides the string: command, id, flags, count, bitmap, bound flag, type and the 4 byte length.
+        for ( const unsigned long stringLength : { 0xFFFFFFUL, 0xFFFFFFUL - 18 } ) {
+
+            const std::string value( stringLength, 'x' );
+            unsigned long     valueLength   = stringLength;
+            const MYSQL_BIND  mysqlBindItem = bindItem( MYSQL_TYPE_STRING, value.data(), &valueLength );
+            const size_t      payloadLength = 18 + stringLength;
+
+            Bytes packet;
+            Protocol::encodeExecute( packet, 1, &mysqlBindItem, 1, false );
+
+            // A payload of exactly 0xFFFFFF bytes is followed by an empty packet.
+            FAF_CHECK( payloadLength + 8 == packet.size() );
+            FAF_CHECK( ( Bytes { 0xFF, 0xFF, 0xFF, 0x00 } ) == Bytes( packet.begin(), packet.begin() + 4 ) );
+            FAF_CHECK( ( Bytes { static_cast<unsigned char>( payloadLength - 0xFFFFFF ), 0x00, 0x00, 0x01 } )
+                       == Bytes( packet.begin() + 4 + 0xFFFFFF, packet.begin() + 8 + 0xFFFFFF ) );
+            FAF_CHECK( ( Bytes { 0xFD, static_cast<unsigned char>( stringLength ), static_cast<unsigned char>( stringLength >> 8 ), 0xFF } )
+                       == Bytes( packet.begin() + 18, packet.begin() + 22 ) );
+
+            // The framing finds the end of the packet only when all parts are there - joined in place the parts are the payload.
+            size_t missingLength {};
+            FAF_CHECK( 0 == Protocol::framePacket( packet.data(), packet.data() + 2, missingLength ) );
+            FAF_CHECK( 2 == missingLength );
+            FAF_CHECK( 0 == Protocol::framePacket( packet.data(), packet.data() + packet.size() - 1, missingLength ) );
+            FAF_CHECK( 1 == missingLength );
+            FAF_CHECK( packet.size() == Protocol::framePacket( packet.data(), packet.data() + packet.size(), missingLength ) );
+
+            const Bytes packetCopy( packet );
+            packet.resize( Protocol::joinParts( packet.data(), packet.size(), packet.data() ) );
+            FAF_CHECK( payloadLength == packet.size() );
+            FAF_CHECK( Bytes( packetCopy.begin() + 4, packetCopy.begin() + 4 + 0xFFFFFF ) == Bytes( packet.begin(), packet.begin() + 0xFFFFFF ) );
+            FAF_CHECK( 'x' == packet.back() );
+
+        }
+
+    }
+
+    auto parseResponses() -> void
+    {
+
+        FaF::ExecuteResult executeResult;
+
+        Protocol::parseResponse( Bytes { 0x00, 0x03, 0xFC, 0x10, 0x27, 0x02, 0x00, 0x00, 0x00 }, executeResult );
+        FAF_CHECK( 0 == executeResult.errorCode );
+        FAF_CHECK( 3 == executeResult.affectedRows );
+        FAF_CHECK( 10000 == executeResult.lastInsertId );
+
+        Protocol::parseResponse( Bytes { 0xFF, 0x62, 0x04, '#', '2', '3', '0', '0', '0', 'd', 'u', 'p' }, executeResult );
+        FAF_CHECK( 1122 == executeResult.errorCode );
+        FAF_CHECK( "dup" == executeResult.errorMessage );
+
+        // Truncated OK packets are not read past their end.
+        Protocol::parseResponse( Bytes { 0x00 }, executeResult );
+        FAF_CHECK( CR_MALFORMED_PACKET == executeResult.errorCode );
+        Protocol::parseResponse( Bytes { 0x00, 0x01, 0xFE, 0x01 }, executeResult );
+        FAF_CHECK( CR_MALFORMED_PACKET == executeResult.errorCode );
+        FAF_CHECK( 0 == executeResult.affectedRows );
+
+        Protocol::parseResponse( Bytes {}, executeResult );
+        FAF_CHECK( CR_SERVER_LOST == executeResult.errorCode );
+
+        // A result set starts with its column count.
+        Protocol::parseResponse( Bytes { 0x01 }, executeResult );
+        FAF_CHECK( CR_COMMANDS_OUT_OF_SYNC == executeResult.errorCode );
+
+    }
+
+    auto directExecutor() -> void
+    {
+
+        int sockets [2];
+        FAF_CHECK( 0 == socketpair( AF_UNIX, SOCK_STREAM, 0, sockets ) );
+
+        MYSQL      mysqlConnection {};
+        MYSQL_STMT mysqlStatement  {};
+
+        mysqlConnection.net.fd     = sockets [0];
+        mysqlStatement.mysql       = &mysqlConnection;
+        mysqlStatement.stmt_id     = 5;
+        mysqlStatement.param_count = 1;
+
+        // Compression is only used if both sides have it.
+        mysqlConnection.server_capabilities = CLIENT_COMPRESS;
+        FAF_CHECK( false == FaF::Test::throwsException( [&mysqlStatement]() { FaF::MySqlExtBindDirectExecutor executor( &mysqlStatement ); } ) );
+        mysqlConnection.client_flag = CLIENT_COMPRESS;
+        FAF_CHECK( FaF::Test::throwsException( [&mysqlStatement]() { FaF::MySqlExtBindDirectExecutor executor( &mysqlStatement ); } ) );
+        mysqlConnection.client_flag = 0;
+
+        Bytes receivedPayload;
+        std::thread serverThread( [&receivedPayload, serverSocket = sockets [1]]() {
+
+            Protocol::readPacket( serverSocket, receivedPayload );
+            // OK - 1 affected row, last insert id 42.
+            Protocol::writePacket( serverSocket, Bytes { 0x07, 0x00, 0x00, 0x01, 0x00, 0x01, 0x2A, 0x02, 0x00, 0x00, 0x00 } );
+            close( serverSocket );
+
+        } );
+
+        int                             id { 9 };
+        FaF::MySqlExtBind               extBind( nullptr, "INSERT INTO t (id) VALUES (:id)" );
+        FaF::MySqlExtBindDirectExecutor executor( &mysqlStatement );
+
+        extBind.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FAF_CHECK( 0 == executor.execute( extBind ) );
+        FAF_CHECK( 1 == executor.result().affectedRows );
+        FAF_CHECK( 42 == executor.result().lastInsertId );
+
+        serverThread.join();
+        FAF_CHECK( ( Bytes { 0x17, 0x05, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x00, 0x09, 0x00, 0x00, 0x00 } )
+                   == receivedPayload );
+
+        // The server has closed the connection.
+        extBind.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FAF_CHECK( CR_SERVER_LOST == executor.execute( extBind ) );
+
+        mysqlStatement.param_count = 2;
+        extBind.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FAF_CHECK( CR_INVALID_PARAMETER_NO == executor.execute( extBind ) );
+
+        close( sockets [0] );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    lengthEncoded();
+    encodeTypes();
+    encodeQueryAttributes();
+    splitPackets();
+    parseResponses();
+    directExecutor();
+
+    return FaF::Test::result( "MySqlExtBindProtocolTest" );
+
+}
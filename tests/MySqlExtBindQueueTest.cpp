@@ -0,0 +1,130 @@
+/**
+ * MySqlExtBindQueueTest.cpp
+ *
+ * Regression tests for MpscWaitQueue - producers which block on a full queue, a consumer which sleeps
+ * until an item arrives and the deadline of waitUntil().
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <chrono>
+#include <thread>
+#include <vector>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindQueue.h"
+
+namespace
+{
+
+    constexpr size_t g_producers        { 8 };
+    constexpr size_t g_itemsPerProducer { 20000 };
+
+    /**
+     * Many producers on a queue with 2 cells - each item must arrive once, none may be lost by a missed wake-up.
+     */
+    auto fullQueue() -> void
+    {
+
+        FaF::MpscWaitQueue<size_t> waitQueue( 2 );
+        std::vector<std::thread>   producerThreads;
+
+        for ( size_t producer = 0; producer < g_producers; producer++ ) {
+
+            producerThreads.emplace_back( [&waitQueue, producer]() {
+
+                for ( size_t index = 0; index < g_itemsPerProducer; index++ ) {
+
+                    waitQueue.push( producer * g_itemsPerProducer + index );
+
+                }
+
+            } );
+
+        }
+
+        std::vector<bool> received( g_producers * g_itemsPerProducer );
+        size_t            receivedItems {};
+        size_t            item          {};
+
+        while ( receivedItems < received.size() ) {
+
+            const size_t observed = waitQueue.observe();
+            bool         drained  {};
+
+            while ( waitQueue.tryPop( item ) ) {
+
+                receivedItems += received [item] ? 0 : 1;
+                received [item] = true;
+                drained         = true;
+
+            }
+
+            if ( drained ) {
+
+                waitQueue.popped();
+
+            } else {
+
+                waitQueue.wait( observed );
+
+            }
+
+        }
+
+        for ( std::thread & producerThread : producerThreads ) {
+
+            producerThread.join();
+
+        }
+
+        FAF_CHECK( false == waitQueue.tryPop( item ) );
+
+    }
+
+    auto wakeAndDeadline() -> void
+    {
+
+        FaF::MpscWaitQueue<size_t> waitQueue( 4 );
+
+        // A wake-up between observe() and wait() isn't lost.
+        size_t observed = waitQueue.observe();
+        waitQueue.wake();
+        waitQueue.wait( observed );
+
+        observed = waitQueue.observe();
+        std::thread wakeThread( [&waitQueue]() {
+
+            std::this_thread::sleep_for( std::chrono::milliseconds( 20 ) );
+            waitQueue.push( 7 );
+
+        } );
+        waitQueue.wait( observed );
+        wakeThread.join();
+
+        size_t item {};
+        FAF_CHECK( waitQueue.tryPop( item ) && 7 == item );
+
+        // Without a push the deadline ends the wait.
+        const auto start = std::chrono::steady_clock::now();
+        waitQueue.waitUntil( waitQueue.observe(), start + std::chrono::milliseconds( 20 ) );
+
+        FAF_CHECK( std::chrono::steady_clock::now() - start >= std::chrono::milliseconds( 20 ) );
+        FAF_CHECK( false == waitQueue.tryPop( item ) );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    fullQueue();
+    wakeAndDeadline();
+
+    return FaF::Test::result( "MySqlExtBindQueueTest" );
+
+}
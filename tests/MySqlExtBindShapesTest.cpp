@@ -0,0 +1,187 @@
+/**
+ * MySqlExtBindShapesTest.cpp
+ *
+ * Regression tests for MySqlExtBindShapes and the statement cache entries it shares - run against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <memory>
+#include <string>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindShapes.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    auto sharedShapes( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+
+        auto firstShapes  = std::make_unique<FaF::MySqlExtBindShapes>( statementCache, "SELECT * FROM :@table WHERE id = :id" );
+        auto secondShapes = std::make_unique<FaF::MySqlExtBindShapes>( statementCache, "SELECT * FROM :@table WHERE id = :id" );
+
+        int id { 7 };
+
+        firstShapes->assignIdentifier( "table", "customers" );
+        firstShapes->assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FaF::MySqlExtBind & firstStatement = firstShapes->statement();
+
+        secondShapes->assignIdentifier( "table", "customers" );
+        secondShapes->assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FaF::MySqlExtBind & secondStatement = secondShapes->statement();
+
+        // Both resolve to the same cache entry.
+        FAF_CHECK( &firstStatement == &secondStatement );
+        FAF_CHECK( 1 == statementCache.size() );
+
+        // Destroying one user must not free the statement of the other one.
+        firstShapes.reset();
+        FAF_CHECK( 1 == statementCache.size() );
+
+        secondShapes->assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FaF::MySqlExtBind & reusedStatement = secondShapes->statement();
+        FAF_CHECK( 0 == statementCache.execute( reusedStatement, true ) );
+
+        secondShapes.reset();
+        FAF_CHECK( 0 == statementCache.size() );
+
+        // A plain statement() user holds its entry for the lifetime of the cache.
+        FaF::MySqlExtBind & plainStatement = statementCache.statement( "SELECT * FROM `orders` WHERE id = :id" );
+        {
+
+            FaF::MySqlExtBindShapes shapes( statementCache, "SELECT * FROM :@table WHERE id = :id" );
+            shapes.assignIdentifier( "table", "orders" );
+            shapes.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+            shapes.statement();
+
+        }
+        FAF_CHECK( 1 == statementCache.size() );
+        FAF_CHECK( true  == statementCache.release( plainStatement ) );
+        FAF_CHECK( 0 == statementCache.size() );
+        FAF_CHECK( false == statementCache.release( plainStatement ) );
+
+    }
+
+    auto leastRecentlyUsed( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+        FaF::MySqlExtBindShapes         shapes( statementCache, "SELECT COUNT(*) FROM :@table", 2 );
+
+        for ( const char * table : { "a", "b", "a", "c" } ) {
+
+            shapes.assignIdentifier( "table", table );
+            shapes.statement();
+
+        }
+
+        // <b> has been released, <a> and <c> are kept.
+        FAF_CHECK( 2 == shapes.size() );
+        FAF_CHECK( 2 == statementCache.size() );
+
+        FaF::MySqlExtBind & shape = shapes.statement();
+        FAF_CHECK( "SELECT COUNT(*) FROM `c`" == shape.adjustedMysqlCommand() );
+
+    }
+
+    auto identifiers( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+        FaF::MySqlExtBindShapes         shapes( statementCache, "SELECT :@column FROM t WHERE id = :id" );
+
+        FAF_CHECK( FaF::Test::throwsException( [&shapes]() { shapes.assignIdentifier( "column", "name`; DROP TABLE t" ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [&shapes]() { shapes.assignIdentifier( "column", std::string( 65, 'c' ) ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [&shapes]() { shapes.assignIdentifier( "table", "t" ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [&shapes]() { shapes.statement(); } ) );
+
+        shapes.assignIdentifier( "column", "name_1$" );
+        FAF_CHECK( "SELECT `name_1$` FROM t WHERE id = ?" == shapes.statement().adjustedMysqlCommand() );
+
+    }
+
+    auto optionalFragments( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+        FaF::MySqlExtBindShapes         shapes( statementCache, "SELECT * FROM t WHERE 1 = 1 [[ AND city = :city ]]"
+                                                                " [[ AND age >= :minAge AND age <= :maxAge ]]" );
+
+        int age { 30 };
+
+        FAF_CHECK( "SELECT * FROM t WHERE 1 = 1  " == shapes.statement().adjustedMysqlCommand() );
+
+        shapes.assignBindData( "minAge", MYSQL_TYPE_LONG, &age );
+        shapes.assignBindData( "maxAge", MYSQL_TYPE_LONG, &age );
+        FAF_CHECK( "SELECT * FROM t WHERE 1 = 1   AND age >= ? AND age <= ? " == shapes.statement().adjustedMysqlCommand() );
+
+        // A fragment is only included as a whole.
+        shapes.assignBindData( "minAge", MYSQL_TYPE_LONG, &age );
+        FAF_CHECK( FaF::Test::throwsException( [&shapes]() { shapes.statement(); } ) );
+
+        FAF_CHECK( FaF::Test::throwsException( [&statementCache]() { FaF::MySqlExtBindShapes( statementCache, "SELECT 1 [[ AND a = 1 ]]" ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [&statementCache]() { FaF::MySqlExtBindShapes( statementCache, "SELECT 1 [[ AND a = :a" ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [&statementCache]() { FaF::MySqlExtBindShapes( statementCache, "SELECT 1 [[ [[ :a ]] ]]" ); } ) );
+
+    }
+
+    auto partialUpdate( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+        FaF::MySqlExtBindShapes         shapes( statementCache, "UPDATE t SET rate = :rate, rate_limit = :limit WHERE id = :id", 64, true );
+
+        int value { 1 };
+
+        // :limit is a placeholder, not the LIMIT keyword which ends the SET clause.
+        shapes.assignBindData( "limit", MYSQL_TYPE_LONG, &value );
+        shapes.assignBindData( "id", MYSQL_TYPE_LONG, &value );
+        FAF_CHECK( "UPDATE t SET rate_limit = ? WHERE id = ?" == shapes.statement().adjustedMysqlCommand() );
+
+        shapes.assignBindData( "rate", MYSQL_TYPE_LONG, &value );
+        shapes.assignBindData( "limit", MYSQL_TYPE_LONG, &value );
+        shapes.assignBindData( "id", MYSQL_TYPE_LONG, &value );
+        FAF_CHECK( "UPDATE t SET rate = ?, rate_limit = ? WHERE id = ?" == shapes.statement().adjustedMysqlCommand() );
+
+        FaF::MySqlExtBindShapes commentShapes( statementCache, "UPDATE t SET a = :where /* WHERE, */, b = :order -- LIMIT\n WHERE id = :id",
+                                               64, true );
+
+        commentShapes.assignBindData( "order", MYSQL_TYPE_LONG, &value );
+        commentShapes.assignBindData( "id", MYSQL_TYPE_LONG, &value );
+        FAF_CHECK( "UPDATE t SET b = ? -- LIMIT\n WHERE id = ?" == commentShapes.statement().adjustedMysqlCommand() );
+
+        // The placeholders are recognised with the current delimiters - $limit isn't the LIMIT keyword either.
+        FaF::MySqlExtBind::setDelimiters( "\\$", "" );
+        FaF::MySqlExtBindShapes delimiterShapes( statementCache, "UPDATE t SET rate_limit = $limit, a = $a WHERE id = $id", 64, true );
+
+        delimiterShapes.assignBindData( "a", MYSQL_TYPE_LONG, &value );
+        delimiterShapes.assignBindData( "id", MYSQL_TYPE_LONG, &value );
+        FAF_CHECK( "UPDATE t SET a = ? WHERE id = ?" == delimiterShapes.statement().adjustedMysqlCommand() );
+
+        FaF::MySqlExtBind::setDelimiters();
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    sharedShapes( &mysqlConnection );
+    leastRecentlyUsed( &mysqlConnection );
+    identifiers( &mysqlConnection );
+    optionalFragments( &mysqlConnection );
+    partialUpdate( &mysqlConnection );
+
+    return FaF::Test::result( "MySqlExtBindShapesTest" );
+
+}
@@ -0,0 +1,158 @@
+/**
+ * MySqlExtBindSnapshotTest.cpp
+ *
+ * Regression tests for opening a MySqlExtBindSnapshot and the fallback to parsing when the file doesn't match -
+ * run against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindSnapshot.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    constexpr const char * g_snapshotPath { "/tmp/MySqlExtBindSnapshotTest.snapshot" };
+
+    // The offsets of the format version, the template image version and the byte order mark in the file header.
+    constexpr std::streamoff g_formatVersionOffset        { 8 };
+    constexpr std::streamoff g_templateImageVersionOffset { 12 };
+    constexpr std::streamoff g_byteOrderMarkOffset        { 16 };
+
+    const std::vector<FaF::TemplateUse> g_templateUses {
+        { "SELECT * FROM t WHERE id = :id AND name = :name", 12 },
+        { "UPDATE t SET name = :name WHERE id = :id", 3 },
+        { "SELECT NOW()", 1 }
+    };
+
+    auto saveSnapshot() -> void
+    {
+
+        FAF_CHECK( FaF::MySqlExtBindSnapshot::save( g_snapshotPath, g_templateUses ) );
+
+    }
+
+    auto patchFile( std::streamoff offset, u_int value ) -> void
+    {
+
+        std::fstream snapshotFile( g_snapshotPath, std::ios::binary | std::ios::in | std::ios::out );
+        snapshotFile.seekp( offset );
+        snapshotFile.write( reinterpret_cast<const char *>( &value ), sizeof( value ) );
+
+    }
+
+    auto fileLength() -> std::streamoff
+    {
+
+        return std::ifstream( g_snapshotPath, std::ios::binary | std::ios::ate ).tellg();
+
+    }
+
+    /**
+     * The snapshot isn't used - the commands are parsed as usual.
+     */
+    auto checkFallback( FaF::MySqlExtBindSnapshot & snapshot ) -> void
+    {
+
+        FAF_CHECK( false == snapshot.open( g_snapshotPath ) );
+        FAF_CHECK( 0 == snapshot.size() );
+        FAF_CHECK( false == snapshot.contains( g_templateUses [0].mysqlCommand ) );
+        FAF_CHECK( "SELECT * FROM t WHERE id = ? AND name = ?" == snapshot.statement( g_templateUses [0].mysqlCommand, nullptr ).adjustedMysqlCommand() );
+
+    }
+
+    auto openSnapshot() -> void
+    {
+
+        saveSnapshot();
+
+        FaF::MySqlExtBindSnapshot snapshot;
+        FAF_CHECK( snapshot.open( g_snapshotPath ) );
+        FAF_CHECK( g_templateUses.size() == snapshot.size() );
+
+        for ( const FaF::TemplateUse & templateUse : g_templateUses ) {
+
+            FAF_CHECK( snapshot.contains( templateUse.mysqlCommand ) );
+
+        }
+
+        const FaF::MySqlExtBind savedExtBind = snapshot.statement( g_templateUses [0].mysqlCommand, nullptr );
+        FAF_CHECK( "SELECT * FROM t WHERE id = ? AND name = ?" == savedExtBind.adjustedMysqlCommand() );
+        FAF_CHECK( 2 == savedExtBind.bindVariablesCount() );
+
+        // A command which isn't in the snapshot is parsed.
+        FAF_CHECK( "DELETE FROM t WHERE id = ?" == snapshot.statement( "DELETE FROM t WHERE id = :id", nullptr ).adjustedMysqlCommand() );
+
+        // The statement cache gets the instance of the snapshot.
+        MYSQL                           mysqlConnection {};
+        FaF::MySqlExtBindStatementCache statementCache( &mysqlConnection );
+        FaF::MySqlExtBind &             cachedExtBind = snapshot.statement( g_templateUses [1].mysqlCommand, statementCache );
+        FAF_CHECK( "UPDATE t SET name = ? WHERE id = ?" == cachedExtBind.adjustedMysqlCommand() );
+        FAF_CHECK( 1 == statementCache.size() );
+
+        // A failed open() empties the snapshot - instances created before stay valid.
+        std::remove( g_snapshotPath );
+        checkFallback( snapshot );
+        FAF_CHECK( "UPDATE t SET name = ? WHERE id = ?" == cachedExtBind.adjustedMysqlCommand() );
+
+    }
+
+    /**
+     * A snapshot of another format, template image version, byte order or delimiters isn't used, nor a damaged one.
+     */
+    auto mismatches() -> void
+    {
+
+        FaF::MySqlExtBindSnapshot snapshot;
+
+        for ( const std::streamoff offset : { g_formatVersionOffset, g_templateImageVersionOffset, g_byteOrderMarkOffset } ) {
+
+            saveSnapshot();
+            patchFile( offset, 0x04030201 );
+            checkFallback( snapshot );
+
+        }
+
+        // Another delimiter would parse the commands differently.
+        saveSnapshot();
+        FaF::MySqlExtBind::setDelimiters( "@" );
+        FAF_CHECK( false == snapshot.open( g_snapshotPath ) );
+        FaF::MySqlExtBind::setDelimiters();
+        FAF_CHECK( snapshot.open( g_snapshotPath ) );
+
+        // The hash of the content doesn't match.
+        patchFile( fileLength() - 4, 0xFFFFFFFF );
+        checkFallback( snapshot );
+
+        // A truncated file.
+        saveSnapshot();
+        std::ifstream savedFile( g_snapshotPath, std::ios::binary );
+        const std::string content { std::istreambuf_iterator<char>( savedFile ), std::istreambuf_iterator<char>() };
+        std::ofstream( g_snapshotPath, std::ios::binary | std::ios::trunc ) << content.substr( 0, content.length() / 2 );
+        checkFallback( snapshot );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    openSnapshot();
+    mismatches();
+
+    std::remove( g_snapshotPath );
+
+    return FaF::Test::result( "MySqlExtBindSnapshotTest" );
+
+}
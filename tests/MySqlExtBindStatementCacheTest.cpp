@@ -0,0 +1,265 @@
+/**
+ * MySqlExtBindStatementCacheTest.cpp
+ *
+ * Regression tests for the warm-up, the retries, the reconnect and the thread copies of MySqlExtBindStatementCache - run
+ * against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <errmsg.h>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindShapes.h"
+#include "../MySqlExtBindStatementCache.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    /**
+     * Warmed statements are owned by their first user - the bound of MySqlExtBindShapes still holds.
+     */
+    auto warmUpKeepsShapesBound( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+
+        const std::vector<FaF::TemplateUse> templateUses {
+            { "SELECT * FROM `a` WHERE id = :id", 30 },
+            { "SELECT * FROM `b` WHERE id = :id", 20 },
+            { "SELECT * FROM `c` WHERE id = :id", 10 },
+            { "SELECT * FROM `d` WHERE id = ", 5 }
+        };
+
+        // The command without bind variable of an outdated profile is skipped.
+        FAF_CHECK( 3 == statementCache.warmUp( templateUses ) );
+        FAF_CHECK( 3 == statementCache.size() );
+
+        auto shapes = std::make_unique<FaF::MySqlExtBindShapes>( statementCache, "SELECT * FROM :@table WHERE id = :id", 2 );
+        int  id { 1 };
+
+        for ( const char * table : { "a", "b", "c" } ) {
+
+            shapes->assignIdentifier( "table", table );
+            shapes->assignBindData( "id", MYSQL_TYPE_LONG, &id );
+            shapes->statement();
+
+        }
+
+        // <a> has been released by the shapes - it's removed like a statement which hasn't been warmed.
+        FAF_CHECK( 2 == statementCache.size() );
+
+        shapes.reset();
+        FAF_CHECK( 0 == statementCache.size() );
+
+        // A statement() user keeps the warmed statement and the executions taken over.
+        FAF_CHECK( 1 == statementCache.warmUp( { templateUses [0] } ) );
+        FaF::MySqlExtBind & warmedStatement = statementCache.statement( templateUses [0].mysqlCommand );
+        FAF_CHECK( 30 == statementCache.templateUses().front().executions );
+        FAF_CHECK( true == statementCache.release( warmedStatement ) );
+        FAF_CHECK( 0 == statementCache.size() );
+
+    }
+
+    // The prepared commands in order.
+    std::vector<std::string> g_preparedCommands;
+
+    auto recordPrepares() -> void
+    {
+
+        g_preparedCommands.clear();
+
+        FaF::MySqlClientStub::setPrepareResult( []( std::string_view mysqlCommand ) -> unsigned int {
+
+            g_preparedCommands.emplace_back( mysqlCommand );
+            return 0;
+
+        } );
+
+    }
+
+    // The first <failures> executions fail with CR_SERVER_LOST.
+    auto loseConnection( int failures ) -> void
+    {
+
+        FaF::MySqlClientStub::setExecuteResult( [failures]( MYSQL_STMT * ) mutable -> unsigned int {
+
+            return 0 < failures-- ? CR_SERVER_LOST : 0;
+
+        } );
+
+    }
+
+    /**
+     * A lost connection is reconnected - only an idempotent execution is retried, the statement is prepared again before.
+     */
+    auto serverLostRetry( MYSQL * mysqlConnection ) -> void
+    {
+
+        int reconnects {};
+
+        FaF::StatementCacheOptions statementCacheOptions;
+        statementCacheOptions.reconnect = [&reconnects]( MYSQL * ) { reconnects++; return true; };
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection, statementCacheOptions );
+        FaF::MySqlExtBind &             insertStatement = statementCache.statement( "INSERT INTO t (id) VALUES (:id)" );
+        int                             id { 1 };
+
+        recordPrepares();
+        loseConnection( 1 );
+        insertStatement.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+
+        FAF_CHECK( 0 == statementCache.execute( insertStatement, true ) );
+        FAF_CHECK( 1 == reconnects );
+        FAF_CHECK( ( std::vector<std::string> { "INSERT INTO t (id) VALUES (?)" } ) == g_preparedCommands );
+
+        // The server may have executed it - the error is returned, but the statement is ready for the next execution.
+        recordPrepares();
+        loseConnection( 1 );
+        insertStatement.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+
+        FAF_CHECK( CR_SERVER_LOST == statementCache.execute( insertStatement, false ) );
+        FAF_CHECK( 2 == reconnects );
+        FAF_CHECK( 1 == g_preparedCommands.size() );
+
+        insertStatement.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FAF_CHECK( 0 == statementCache.execute( insertStatement, false ) );
+        FAF_CHECK( 1 == g_preparedCommands.size() );
+
+        // At most <maxRetries> reconnects.
+        loseConnection( 5 );
+        insertStatement.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+
+        FAF_CHECK( CR_SERVER_LOST == statementCache.execute( insertStatement, true ) );
+        FAF_CHECK( 4 == reconnects );
+
+        FaF::MySqlClientStub::setExecuteResult( {} );
+        FaF::MySqlClientStub::setPrepareResult( {} );
+
+    }
+
+    /**
+     * reconnected() prepares the <hotTemplates> most executed statements before it returns - the others on their next execution.
+     */
+    auto reconnectedReprepare( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::StatementCacheOptions statementCacheOptions;
+        statementCacheOptions.hotTemplates = 2;
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection, statementCacheOptions );
+
+        statementCache.warmUp( { { "SELECT * FROM a WHERE id = :id", 1 },
+                                 { "SELECT * FROM b WHERE id = :id", 30 },
+                                 { "SELECT * FROM c WHERE id = :id", 20 } } );
+
+        recordPrepares();
+        statementCache.reconnected();
+
+        FAF_CHECK( ( std::vector<std::string> { "SELECT * FROM b WHERE id = ?", "SELECT * FROM c WHERE id = ?" } ) == g_preparedCommands );
+
+        FaF::MySqlExtBind & coldStatement = statementCache.statement( "SELECT * FROM a WHERE id = :id" );
+        int                 id { 1 };
+
+        coldStatement.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+        FAF_CHECK( 0 == statementCache.execute( coldStatement, true ) );
+        FAF_CHECK( 3 == g_preparedCommands.size() );
+        FAF_CHECK( "SELECT * FROM a WHERE id = ?" == g_preparedCommands.back() );
+
+        FaF::MySqlClientStub::setPrepareResult( {} );
+
+    }
+
+    // The id the current thread assigns - each execution must bind it.
+    thread_local int g_threadId {};
+
+    /**
+     * Threads which share the cache get their own MySqlExtBind - each execution binds the values of its own thread.
+     */
+    auto threadsShareCache( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::MySqlExtBindStatementCache statementCache( mysqlConnection );
+        std::atomic<int>                foreignExecutions {};
+
+        FaF::MySqlClientStub::setExecuteResult( [&foreignExecutions]( MYSQL_STMT * mysqlStatement ) -> unsigned int {
+
+            const int id = *static_cast<const int *>( FaF::MySqlClientStub::boundParameters( mysqlStatement ).front().buffer );
+            foreignExecutions += g_threadId != id ? 1 : 0;
+
+            return 0;
+
+        } );
+
+        std::array<FaF::MySqlExtBind *, 2> threadStatements {};
+        std::array<std::thread, 2>         threads;
+
+        for ( size_t index = 0; index < threads.size(); index++ ) {
+
+            threads [index] = std::thread( [&statementCache, &threadStatements, index]() {
+
+                g_threadId = static_cast<int>( index ) + 1;
+
+                FaF::MySqlExtBind & insertStatement = statementCache.statement( "INSERT INTO t (id) VALUES (:id)" );
+                threadStatements [index] = &insertStatement;
+
+                for ( int execution = 0; execution < 10000; execution++ ) {
+
+                    int id = g_threadId;
+                    insertStatement.assignBindData( "id", MYSQL_TYPE_LONG, &id );
+                    statementCache.execute( insertStatement, true );
+
+                }
+
+            } );
+
+        }
+
+        for ( std::thread & thread : threads ) {
+
+            thread.join();
+
+        }
+
+        FAF_CHECK( 0 == foreignExecutions );
+        FAF_CHECK( threadStatements [0] != threadStatements [1] );
+        FAF_CHECK( 1 == statementCache.size() );
+        FAF_CHECK( 20000 == statementCache.templateUses().front().executions );
+
+        // Both threads hold the entry - it's removed with the last release().
+        FAF_CHECK( true == statementCache.release( *threadStatements [0] ) );
+        FAF_CHECK( 1 == statementCache.size() );
+        FAF_CHECK( true == statementCache.release( *threadStatements [1] ) );
+        FAF_CHECK( 0 == statementCache.size() );
+
+        FaF::MySqlClientStub::setExecuteResult( {} );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    warmUpKeepsShapesBound( &mysqlConnection );
+    serverLostRetry( &mysqlConnection );
+    reconnectedReprepare( &mysqlConnection );
+    threadsShareCache( &mysqlConnection );
+
+    return FaF::Test::result( "MySqlExtBindStatementCacheTest" );
+
+}
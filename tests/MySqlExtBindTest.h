@@ -0,0 +1,81 @@
+/**
+ * MySqlExtBindTest.h
+ *
+ * The checks shared by the regression tests in this directory. Each test is a program of its own which
+ * returns 0 if all checks have passed.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#ifndef FAF_MYSQL_EXT_BIND_TEST_H
+#define FAF_MYSQL_EXT_BIND_TEST_H
+
+#include <cstdio>
+#include <utility>
+
+#include "../MySqlExtBind.h"
+
+// The condition is printed with its location if it's false.
+#define FAF_CHECK( condition ) FaF::Test::check( ( condition ), #condition, __FILE__, __LINE__ )
+
+namespace FaF::Test
+{
+
+    inline size_t g_checks   {};
+    inline size_t g_failures {};
+
+    inline auto check( bool passed, const char * condition, const char * file, int line ) -> bool
+    {
+
+        g_checks++;
+
+        if ( false == passed ) {
+
+            g_failures++;
+            std::fprintf( stderr, "%s:%d: FAILED: %s\n", file, line, condition );
+
+        }
+
+        return passed;
+
+    }
+
+    /**
+     * True if <function> throws FaF::Exception - the message of the exception is printed by the extension.
+     *
+     * @param function
+     * @return
+     */
+    template < typename Function >
+    auto throwsException( Function && function ) -> bool
+    {
+
+        try {
+
+            std::forward<Function>( function )();
+
+        } catch ( const FaF::Exception & ) {
+
+            return true;
+
+        }
+
+        return false;
+
+    }
+
+    inline auto result( const char * testName ) -> int
+    {
+
+        std::printf( "%s: %zu checks, %zu failed\n", testName, g_checks, g_failures );
+
+        return 0 == g_failures ? 0 : 1;
+
+    }
+
+}
+
+#endif
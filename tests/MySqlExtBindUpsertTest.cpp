@@ -0,0 +1,186 @@
+/**
+ * MySqlExtBindUpsertTest.cpp
+ *
+ * Regression tests for the merged rows and the generated ON DUPLICATE KEY UPDATE clause of MySqlExtBindUpsert -
+ * run against the client stub.
+ *
+ * Created 2026-10-17
+ *
+ * Version 1.00
+ *
+ */
+
+#include <string>
+#include <vector>
+
+#include "MySqlExtBindTest.h"
+#include "../MySqlExtBindUpsert.h"
+#include "../stub/MySqlClientStub.h"
+
+namespace
+{
+
+    constexpr long long g_nullValue { -1 };
+
+    // The integer values of the executed statements - NULL is g_nullValue.
+    std::vector<long long> g_executedValues;
+
+    auto recordStatements() -> void
+    {
+
+        g_executedValues.clear();
+
+        FaF::MySqlClientStub::setExecuteResult( []( MYSQL_STMT * mysqlStatement ) -> unsigned int {
+
+            for ( const MYSQL_BIND & mysqlBindItem : FaF::MySqlClientStub::boundParameters( mysqlStatement ) ) {
+
+                if ( FaF::BoundRow::isNullValue( mysqlBindItem ) ) {
+
+                    g_executedValues.push_back( g_nullValue );
+
+                } else if ( MYSQL_TYPE_LONGLONG == mysqlBindItem.buffer_type ) {
+
+                    g_executedValues.push_back( *static_cast<const long long *>( mysqlBindItem.buffer ) );
+
+                } else if ( MYSQL_TYPE_LONG == mysqlBindItem.buffer_type ) {
+
+                    g_executedValues.push_back( *static_cast<const int *>( mysqlBindItem.buffer ) );
+
+                }
+
+            }
+
+            return 0;
+
+        } );
+
+    }
+
+    auto lastRowWins( MYSQL * mysqlConnection ) -> void
+    {
+
+        constexpr const char * mysqlCommand { "INSERT INTO counters (id, day, hits) VALUES (:id, :day, :hits)" };
+
+        FaF::UpsertOptions upsertOptions;
+        upsertOptions.keyVariables = { "id", "day" };
+
+        FaF::MySqlExtBindUpsert upsert( mysqlConnection, mysqlCommand, upsertOptions );
+        FaF::MySqlExtBind       extBind( nullptr, mysqlCommand );
+
+        FAF_CHECK( "INSERT INTO counters (id, day, hits) VALUES (:id, :day, :hits) AS new ON DUPLICATE KEY UPDATE hits = new.hits"
+                   == upsert.upsertCommand() );
+
+        int       id  {};
+        int       day { 1 };
+        long long hits {};
+
+        for ( int index = 0; index < 10; index++ ) {
+
+            id   = index % 3;
+            hits = index;
+            extBind.assignBindData( "id",   MYSQL_TYPE_LONG,     &id );
+            extBind.assignBindData( "day",  MYSQL_TYPE_LONG,     &day );
+            extBind.assignBindData( "hits", MYSQL_TYPE_LONGLONG, &hits );
+            upsert.add( extBind );
+
+        }
+
+        FAF_CHECK( 3 == upsert.pendingRows() );
+        FAF_CHECK( 7 == upsert.mergedRows() );
+
+        recordStatements();
+        FAF_CHECK( 3 == upsert.execute().size() );
+        FAF_CHECK( ( std::vector<long long> { 0, 1, 9, 1, 1, 7, 2, 1, 8 } ) == g_executedValues );
+        FAF_CHECK( 0 == upsert.pendingRows() );
+
+    }
+
+    auto combinedRows( MYSQL * mysqlConnection ) -> void
+    {
+
+        constexpr const char * mysqlCommand { "INSERT INTO c (id, hits) VALUES (:id, :hits) AS new ON DUPLICATE KEY UPDATE hits = hits + new.hits" };
+
+        FaF::UpsertOptions upsertOptions;
+        upsertOptions.keyVariables = { "id" };
+        upsertOptions.combine      = []( FaF::BoundRow & pendingRow, const FaF::BoundRow & addedRow )
+        {
+
+            *static_cast<long long *>( pendingRow.bindArray() [1].buffer ) += *static_cast<const long long *>( addedRow.bindArray() [1].buffer );
+
+        };
+
+        FaF::MySqlExtBindUpsert upsert( mysqlConnection, mysqlCommand, upsertOptions );
+        FaF::MySqlExtBind       extBind( nullptr, mysqlCommand );
+
+        // The own clause is kept.
+        FAF_CHECK( mysqlCommand == upsert.upsertCommand() );
+        FAF_CHECK( 1 == upsert.bindPosition( "hits" ) );
+
+        int       id     {};
+        long long hits   { 5 };
+        bool      isNull {};
+
+        for ( int index = 0; index < 6; index++ ) {
+
+            id     = index % 2;
+            isNull = 4 <= index;
+            extBind.assignBindData( "id",   MYSQL_TYPE_LONG,     &id, nullptr, &isNull );
+            extBind.assignBindData( "hits", MYSQL_TYPE_LONGLONG, &hits );
+            upsert.add( extBind );
+
+        }
+
+        // NULL is never a duplicate key.
+        FAF_CHECK( 4 == upsert.pendingRows() );
+        FAF_CHECK( 2 == upsert.mergedRows() );
+
+        recordStatements();
+        FAF_CHECK( 4 == upsert.execute().size() );
+        FAF_CHECK( ( std::vector<long long> { 0, 10, 1, 10, g_nullValue, 5, g_nullValue, 5 } ) == g_executedValues );
+
+    }
+
+    auto rejectedCommands( MYSQL * mysqlConnection ) -> void
+    {
+
+        FaF::UpsertOptions upsertOptions;
+        upsertOptions.keyVariables = { "id" };
+
+        // Last-wins would lose the hits of the replaced rows.
+        FAF_CHECK( FaF::Test::throwsException( [mysqlConnection, &upsertOptions]() {
+            FaF::MySqlExtBindUpsert( mysqlConnection, "INSERT INTO c (id, hits) VALUES (:id, :hits) ON DUPLICATE KEY UPDATE hits = hits + VALUES(hits)",
+                                     upsertOptions );
+        } ) );
+        FAF_CHECK( FaF::Test::throwsException( [mysqlConnection, &upsertOptions]() {
+            FaF::MySqlExtBindUpsert( mysqlConnection, "INSERT INTO c (id, hits) VALUES (:id, :hits) AS n (a, b) ON DUPLICATE KEY UPDATE hits = hits + n.b",
+                                     upsertOptions );
+        } ) );
+
+        FAF_CHECK( FaF::Test::throwsException( [mysqlConnection, &upsertOptions]() { FaF::MySqlExtBindUpsert( mysqlConnection, "INSERT INTO c (id, x) VALUES (:id + 1, :x)", upsertOptions ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [mysqlConnection, &upsertOptions]() { FaF::MySqlExtBindUpsert( mysqlConnection, "INSERT INTO c VALUES (:id, :x)", upsertOptions ); } ) );
+        FAF_CHECK( FaF::Test::throwsException( [mysqlConnection]() { FaF::MySqlExtBindUpsert( mysqlConnection, "INSERT INTO c (id, x) VALUES (:id, :x)", FaF::UpsertOptions {} ); } ) );
+
+        upsertOptions.keyVariables = { "unknown" };
+        FAF_CHECK( FaF::Test::throwsException( [mysqlConnection, &upsertOptions]() { FaF::MySqlExtBindUpsert( mysqlConnection, "INSERT INTO c (id, x) VALUES (:id, :x)", upsertOptions ); } ) );
+
+        // Only key columns - an existing row stays as it is.
+        upsertOptions.keyVariables = { "id" };
+        FaF::MySqlExtBindUpsert keysOnly( mysqlConnection, "INSERT INTO c (id) VALUES (:id)", upsertOptions );
+        FAF_CHECK( "INSERT INTO c (id) VALUES (:id) AS new ON DUPLICATE KEY UPDATE id = id" == keysOnly.upsertCommand() );
+
+    }
+
+}
+
+auto main() -> int
+{
+
+    MYSQL mysqlConnection {};
+
+    lastRowWins( &mysqlConnection );
+    combinedRows( &mysqlConnection );
+    rejectedCommands( &mysqlConnection );
+
+    return FaF::Test::result( "MySqlExtBindUpsertTest" );
+
+}